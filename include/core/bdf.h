@@ -44,6 +44,24 @@ Vector<double>
 bdf_coefficients(unsigned int order, const std::vector<double> time_steps);
 
 
+/**
+ * @brief Calculate the coefficients of the polynomial extrapolation of order n
+ * of the solution at time t from the n+1 previous solutions. These are the
+ * values at t of the Lagrange polynomials built on the previous times.
+ *
+ * @param order The order of the extrapolation. The extrapolation of order n requires n+1 previous solutions
+ *
+ * @param time_steps a vector containing all the time steps. The time steps should be in reverse order,
+ * as for the bdf coefficients. For example, if the extrapolation is of order
+ * 1, it uses the solutions at (t-dt_1) and (t-dt_1-dt_2). Thus the time step
+ * vector should contain dt_1 and dt_2. The first coefficient multiplies the
+ * most recent solution.
+ */
+Vector<double>
+extrapolation_coefficients(unsigned int              order,
+                           const std::vector<double> time_steps);
+
+
 /**
  * @brief Recursion function to calculate the bdf coefficient
  *
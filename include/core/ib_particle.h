@@ -36,8 +36,15 @@ public:
 
   double radius;
 
+  // Density of the particle, only used when the motion is integrated
+  double density;
+
   // Pressure imposition location
   Point<dim> pressure_location;
+
+  // Hydrodynamic force and torque obtained from the last force evaluation
+  Tensor<1, dim> forces;
+  Tensor<1, 3>   torques;
 };
 
 #endif
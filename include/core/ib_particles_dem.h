@@ -0,0 +1,188 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#include <deal.II/base/point.h>
+#include <deal.II/base/tensor.h>
+
+#include <deal.II/grid/tria.h>
+
+#include <core/ib_particle.h>
+#include <core/parameters.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#ifndef lethe_ib_particles_dem_h
+#  define lethe_ib_particles_dem_h
+
+using namespace dealii;
+
+/**
+ * @brief Integrates the rigid body motion of the immersed boundary particles.
+ * The hydrodynamic force and torque of the particles, evaluated on the fluid
+ * mesh, are kept constant during a time step of the fluid. The time step is
+ * split in sub-steps in which the gravity and the contact forces are updated.
+ * The collisions between particles and between the particles and the walls
+ * are resolved with the non-linear (Hertz-Mindlin) contact model of the DEM
+ * solver, with a spring-dashpot normal force and a tangential force limited
+ * by the Coulomb criterion.
+ *
+ * The sub-steps only manipulate the state of the few immersed particles,
+ * which every process stores, and of the walls. The walls are the boundary
+ * faces of the coarse mesh, which are known by every process, hence no
+ * communication is required. The faces are treated as planes bounded by
+ * their bounding box.
+ *
+ * The hydrodynamic forces are obtained with the kinematic pressure and
+ * viscosity. They are thus multiplied by the density of the fluid. The
+ * gravity force acting on a particle is its weight minus its buoyancy, the
+ * gravity must therefore not be included in the source term of the fluid.
+ *
+ * @tparam dim An integer that denotes the dimension of the space
+ */
+template <int dim>
+class IBParticlesDEM
+{
+public:
+  /**
+   * @param parameters The parameters of the immersed boundary particles
+   * @param fluid_density The density of the fluid
+   */
+  IBParticlesDEM(const Parameters::IBParticles<dim> &parameters,
+                 const double                        fluid_density);
+
+  /**
+   * @brief Stores the boundary faces of the coarse mesh of a triangulation as
+   * the walls of the domain.
+   *
+   * @param triangulation The triangulation of the fluid
+   */
+  void
+  update_walls(const Triangulation<dim> &triangulation);
+
+  /**
+   * @brief Integrates the position and the velocity of the particles over a
+   * time step with the symplectic Euler scheme.
+   *
+   * @param particles The particles, their forces and torques must contain the
+   * hydrodynamic force and torque of the time step
+   * @param dt The time step of the fluid
+   */
+  void
+  integrate(std::vector<IBParticle<dim>> &particles, const double dt);
+
+  /**
+   * @brief Writes the tangential overlaps of the contacts, which are the
+   * history of the contact model, to the restart file prefix.ib_particles_dem
+   *
+   * @param prefix The prefix of the restart files
+   */
+  void
+  save(const std::string &prefix) const;
+
+  /**
+   * @brief Reads the tangential overlaps of the contacts from the restart
+   * file prefix.ib_particles_dem
+   *
+   * @param prefix The prefix of the restart files
+   */
+  void
+  read(const std::string &prefix);
+
+private:
+  /**
+   * @brief A boundary face of the coarse mesh
+   */
+  struct Wall
+  {
+    Point<dim>     point;
+    Tensor<1, dim> normal;
+    Point<dim>     box_min;
+    Point<dim>     box_max;
+  };
+
+  /**
+   * @brief Calculates the force and the torque of a non-linear contact. The
+   * force acts on the first body of the contact. The spring and dashpot
+   * constants are those of the non-linear contact model of the DEM solver.
+   *
+   * @param normal_overlap The overlap of the bodies in the normal direction
+   * @param normal_unit_vector The normal of the contact, pointing from the
+   * first body to the second
+   * @param relative_velocity The velocity of the first body relative to the
+   * second at the contact point
+   * @param effective_radius The effective radius of the contact
+   * @param effective_mass The effective mass of the contact
+   * @param youngs_modulus The effective Young's modulus of the contact
+   * @param shear_modulus The effective shear modulus of the contact
+   * @param beta The damping parameter obtained from the restitution
+   * coefficient
+   * @param friction_coefficient The effective friction coefficient
+   * @param dt The sub-step
+   * @param tangential_overlap The tangential overlap of the contact, which is
+   * updated
+   * @param force The contact force
+   */
+  void
+  calculate_contact_force(const double          normal_overlap,
+                          const Tensor<1, dim> &normal_unit_vector,
+                          const Tensor<1, dim> &relative_velocity,
+                          const double          effective_radius,
+                          const double          effective_mass,
+                          const double          youngs_modulus,
+                          const double          shear_modulus,
+                          const double          beta,
+                          const double          friction_coefficient,
+                          const double          dt,
+                          Tensor<1, dim> &      tangential_overlap,
+                          Tensor<1, dim> &      force) const;
+
+  /**
+   * @brief Calculates the contact forces and torques of all the particles and
+   * updates the tangential overlaps of the contacts.
+   */
+  void
+  calculate_contact_forces(const std::vector<IBParticle<dim>> &particles,
+                           const double                        dt,
+                           std::vector<Tensor<1, dim>> &       forces,
+                           std::vector<Tensor<1, 3>> &         torques);
+
+  const Parameters::IBParticles<dim> &parameters;
+  const double                        fluid_density;
+
+  std::vector<Wall> walls;
+
+  // Effective properties of the particle-particle and particle-wall contacts
+  double pp_youngs_modulus;
+  double pp_shear_modulus;
+  double pp_beta;
+  double pp_friction_coefficient;
+  double pw_youngs_modulus;
+  double pw_shear_modulus;
+  double pw_beta;
+  double pw_friction_coefficient;
+
+  // Tangential overlap of the particle-particle and particle-wall contacts,
+  // indexed by the particle ids (smaller first) or by the particle and the
+  // wall ids. A contact is removed when the bodies separate.
+  std::map<std::pair<unsigned int, unsigned int>, Tensor<1, dim>>
+    pp_tangential_overlaps;
+  std::map<std::pair<unsigned int, unsigned int>, Tensor<1, dim>>
+    pw_tangential_overlaps;
+};
+
+#endif
@@ -57,12 +57,19 @@ public:
    * @param force_matrix_renewal Boolean variable that controls if the Newton non-linear
    * solver will force the re-caculation of the jacobian matrix and the
    * reconstruction of the preconditioner at every iteration.
+   *
+   * @param reuse_jacobian Boolean variable that controls if the jacobian matrix
+   * and the preconditioner of the previous solve are reused. The iterations
+   * then only assemble the right-hand side, until an iteration fails to
+   * decrease the residual by the step tolerance. The jacobian matrix is then
+   * assembled at every iteration.
    */
   void
   solve(const Parameters::SimulationControl::TimeSteppingMethod
                    time_stepping_method,
         const bool is_initial_step,
-        const bool force_matrix_renewal = true) override;
+        const bool force_matrix_renewal = true,
+        const bool reuse_jacobian       = false) override;
 };
 
 template <typename VectorType>
@@ -77,7 +84,8 @@ void
 NewtonNonLinearSolver<VectorType>::solve(
   const Parameters::SimulationControl::TimeSteppingMethod time_stepping_method,
   const bool                                              is_initial_step,
-  const bool)
+  const bool,
+  const bool reuse_jacobian)
 {
   double       current_res;
   double       last_res;
@@ -86,6 +94,10 @@ NewtonNonLinearSolver<VectorType>::solve(
   last_res                     = 1e6;
   current_res                  = 1e6;
 
+  // The jacobian matrix of the previous solve is only valid for the same
+  // constraints
+  bool frozen_jacobian = reuse_jacobian && !is_initial_step;
+
   PhysicsSolver<VectorType> *solver = this->physics_solver;
 
   auto &evaluation_point = solver->get_evaluation_point();
@@ -96,7 +108,12 @@ NewtonNonLinearSolver<VectorType>::solve(
     {
       evaluation_point = present_solution;
 
-      solver->assemble_matrix_and_rhs(time_stepping_method);
+      // With a frozen jacobian, the right-hand side of the later iterations
+      // was assembled at the present solution by the line search
+      if (!frozen_jacobian)
+        solver->assemble_matrix_and_rhs(time_stepping_method);
+      else if (outer_iteration == 0)
+        solver->assemble_rhs(time_stepping_method);
 
       if (outer_iteration == 0)
         {
@@ -111,7 +128,7 @@ NewtonNonLinearSolver<VectorType>::solve(
                         << "  - Residual:  " << current_res << std::endl;
         }
 
-      solver->solve_linear_system(first_step);
+      solver->solve_linear_system(first_step, !frozen_jacobian);
 
       for (double alpha = 1.0; alpha > 1e-1; alpha *= 0.5)
         {
@@ -141,6 +158,15 @@ NewtonNonLinearSolver<VectorType>::solve(
             }
         }
 
+      // The frozen jacobian is abandoned as soon as it stalls the convergence
+      if (frozen_jacobian &&
+          current_res > this->params.step_tolerance * last_res)
+        {
+          frozen_jacobian = false;
+          if (this->params.verbosity != Parameters::Verbosity::quiet)
+            solver->pcout << "\t\tAssembling the jacobian matrix" << std::endl;
+        }
+
       present_solution = evaluation_point;
       last_res         = current_res;
       ++outer_iteration;
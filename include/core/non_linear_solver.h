@@ -61,12 +61,18 @@ public:
    * @param force_matrix_renewal Boolean variable that controls if the Newton non-linear
    * solver will force the re-caculation of the jacobian matrix and the
    * reconstruction of the preconditioner at every iteration.
+   *
+   * @param reuse_jacobian Boolean variable that controls if the jacobian matrix
+   * and the preconditioner of the previous solve are used for the first
+   * iteration. This is used for the stages of the sdirk schemes, which share
+   * the same jacobian up to the variation of the solution.
    */
   virtual void
   solve(const Parameters::SimulationControl::TimeSteppingMethod
                    time_stepping_method,
         const bool is_initial_step,
-        const bool force_matrix_rewewal = true) = 0;
+        const bool force_matrix_rewewal = true,
+        const bool reuse_jacobian       = false) = 0;
 
 protected:
   PhysicsSolver<VectorType> * physics_solver;
@@ -91,12 +91,32 @@ namespace Parameters
     // Max CFL
     double maxCFL;
 
+    // Use the CFL accumulated by the assembly of the last non-linear iteration
+    // instead of an additional sweep over the mesh
+    bool assembly_CFL;
+
     // Aimed tolerance at which simulation is stopped
     double stop_tolerance;
 
     // Max CFL
     double adaptative_time_step_scaling;
 
+    // Quantity controlling the adaptative time step, either the CFL or an
+    // estimate of the time integration error
+    enum class TimeStepControl
+    {
+      cfl,
+      error
+    } time_step_control = TimeStepControl::cfl;
+
+    // Tolerance on the estimate of the time integration error relative to
+    // the norm of the solution (error-based adaptative time stepping)
+    double error_tolerance = 1e-3;
+
+    // Maximal number of times a time step is rejected and solved again with a
+    // smaller time step (error-based adaptative time stepping)
+    unsigned int max_time_step_rejections = 5;
+
     // BDF startup time scaling
     double startup_timestep_scaling;
 
@@ -325,6 +345,14 @@ namespace Parameters
     // Iterations to skip in the non-linear solver
     unsigned int skip_iterations;
 
+    // Extrapolate the initial guess of the bdf time steps from the previous
+    // solutions
+    bool extrapolate_initial_guess;
+
+    // Reuse the jacobian matrix and the preconditioner of the first stage for
+    // the other stages of the sdirk schemes
+    bool reuse_sdirk_jacobian;
+
     static void
     declare_parameters(ParameterHandler &prm);
     void
@@ -344,7 +372,8 @@ namespace Parameters
       bicgstab,
       amg,
       tfqmr,
-      direct
+      direct,
+      block_amg
     };
     SolverType solver;
 
@@ -395,6 +424,13 @@ namespace Parameters
     // AMG Smoother overalp
     unsigned int amg_smoother_overlap;
 
+    // Reuse the AMG aggregates when the matrix changes but not its sparsity
+    bool amg_reuse_hierarchy;
+
+    // Ratio of the number of iterations to the number of iterations obtained
+    // with a fresh AMG hierarchy above which the hierarchy is fully rebuilt
+    double amg_rebuild_iteration_ratio;
+
     static void
     declare_parameters(ParameterHandler &prm);
     void
@@ -485,6 +521,19 @@ namespace Parameters
     // Coarsening fraction
     double coarsening_fraction;
 
+    // Weight the cells by their computational cost when the triangulation is
+    // partitioned (immersed boundary cells are more expensive)
+    bool weighted_repartitioning;
+
+    // Additional weight of a cell cut by an immersed particle (sharp edge) or
+    // of each solid particle in a cell (Nitsche). The weight of a plain cell
+    // is 1000.
+    unsigned int immersed_cell_weight;
+
+    // Repartition the triangulation every repartition_frequency iterations to
+    // follow the motion of the immersed particles (0 to disable)
+    unsigned int repartition_frequency;
+
     static void
     declare_parameters(ParameterHandler &prm);
     void
@@ -564,6 +613,23 @@ namespace Parameters
     bool                         calculate_force_ib;
     std::string                  ib_force_output_file;
 
+    // Integrate the motion of the particles from the hydrodynamic forces,
+    // the gravity and the contact forces
+    bool           integrate_motion;
+    unsigned int   contact_substeps;
+    Tensor<1, dim> gravity;
+
+    // Properties of the particles and of the walls used by the non-linear
+    // (Hertz-Mindlin) contact model
+    double youngs_modulus;
+    double poisson_ratio;
+    double restitution_coefficient;
+    double friction_coefficient;
+    double wall_youngs_modulus;
+    double wall_poisson_ratio;
+    double wall_restitution_coefficient;
+    double wall_friction_coefficient;
+
 
     static void
     declare_parameters(ParameterHandler &prm);
@@ -40,7 +40,9 @@ namespace Parameters
 {
   enum class VoidFractionMode
   {
-    function
+    function,
+    pcm,
+    pcm_projection
   };
 
 
@@ -62,6 +64,9 @@ namespace Parameters
   public:
     VoidFractionMode               mode;
     Functions::ParsedFunction<dim> void_fraction;
+
+    // Smoothing length of the projection of the particle void fraction
+    double smoothing_length;
   };
 
 
@@ -178,6 +178,18 @@ namespace Parameters
       // particle diameter)
       double neighborhood_threshold;
 
+      // Polydisperse contact search: per-pair cutoff distances and size
+      // classes in the broad search
+      bool polydisperse_contact_search;
+
+      // Compact non-blocking update of the ghost particles between contact
+      // search steps
+      bool compact_ghost_update;
+
+      // Integration of the interior particles during the ghost particle
+      // update (enables the compact ghost update)
+      bool communication_computation_overlap;
+
       // Choosing particle-particle contact force model
       enum class PPContactForceModel
       {
@@ -200,6 +212,20 @@ namespace Parameters
         gear3
       } integration_method;
 
+      // Enables the deactivation (sleeping) of particles at rest
+      bool particle_sleeping;
+
+      // Translational and rotational velocity below which a particle is at
+      // rest
+      double sleeping_velocity_threshold;
+
+      // Acceleration (contact force imbalance) below which a particle is at
+      // rest
+      double sleeping_acceleration_threshold;
+
+      // Number of consecutive steps at rest before a particle goes to sleep
+      unsigned int sleeping_steps;
+
       static void
       declare_parameters(ParameterHandler &prm);
       void
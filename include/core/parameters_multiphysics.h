@@ -40,6 +40,20 @@ namespace Parameters
     bool               heat_transfer;
     const unsigned int number_physics_total = 1;
 
+    // Heat transfer is solved every heat_transfer_time_step_ratio fluid
+    // dynamics time steps, in heat_transfer_subcycles sub-steps
+    unsigned int heat_transfer_time_step_ratio;
+    unsigned int heat_transfer_subcycles;
+
+    // Preconditioner of the heat transfer linear system, independent of the
+    // one of the fluid dynamics
+    enum class HeatTransferPreconditioner
+    {
+      amg,
+      ilu
+    };
+    HeatTransferPreconditioner heat_transfer_preconditioner;
+
     static void
     declare_parameters(ParameterHandler &prm);
     void
@@ -22,11 +22,13 @@
 
 #include <deal.II/lac/affine_constraints.h>
 
+#include "bdf.h"
 #include "multiphysics.h"
 #include "newton_non_linear_solver.h"
 #include "non_linear_solver.h"
 #include "parameters.h"
 #include "skip_newton_non_linear_solver.h"
+#include "time_integration_utilities.h"
 
 /**
  * This interface class is used to house all the common elements of physics
@@ -86,12 +88,33 @@ public:
   solve_linear_system(const bool initial_step,
                       const bool renewed_matrix = true) = 0;
 
+  /**
+   * @brief Solves the non-linear system of equations of the physics
+   *
+   * @param reuse_jacobian Indicates that the jacobian matrix and the
+   * preconditioner of the previous solve can be reused
+   */
   void
   solve_non_linear_system(
     const Parameters::SimulationControl::TimeSteppingMethod
                time_stepping_method,
     const bool first_iteration,
-    const bool force_matrix_renewal);
+    const bool force_matrix_renewal,
+    const bool reuse_jacobian = false);
+
+  /**
+   * @brief Sets the present solution from which the non-linear solver starts.
+   * By default, the non-linear solver starts from the present solution, that
+   * is the solution of the previous time step. For the bdf time steps, if
+   * enabled, the previous solutions are extrapolated instead. The order of the
+   * extrapolation is the order of the bdf scheme, limited by the number of
+   * previous solutions available.
+   *
+   * @param time_stepping_method Time-Stepping method of the non-linear system
+   */
+  virtual void
+  set_initial_guess(const Parameters::SimulationControl::TimeSteppingMethod
+                      time_stepping_method);
 
   virtual void
   apply_constraints()
@@ -120,11 +143,69 @@ public:
   virtual AffineConstraints<double> &
   get_nonzero_constraints() = 0;
 
+  /**
+   * @brief Getter methods of the previous solutions and of the time steps,
+   * used to extrapolate the initial guess. The previous solutions are given
+   * with the most recent first and the time steps in reverse order, the
+   * present one first. The physics which do not provide them are not
+   * extrapolated.
+   */
+  virtual std::vector<const VectorType *>
+  get_previous_solutions()
+  {
+    return {};
+  }
+  virtual std::vector<double>
+  get_time_steps_vector() const
+  {
+    return {};
+  }
+
   // attributes
   // TODO std::unique or std::shared pointer
   ConditionalOStream pcout;
 
+protected:
+  /**
+   * @brief Sets the present solution to the polynomial extrapolation of the
+   * previous solutions. The order of the extrapolation is the number of
+   * previous solutions minus one.
+   *
+   * @param previous_solutions The previous solutions, the most recent first
+   *
+   * @param time_steps The time steps in reverse order, the present one first
+   */
+  void
+  extrapolate_present_solution(
+    const std::vector<const VectorType *> &previous_solutions,
+    const std::vector<double> &            time_steps);
+
+  /**
+   * @brief Calculates the polynomial extrapolation of the previous solutions
+   * at the present time. The order of the extrapolation is the number of
+   * previous solutions minus one.
+   *
+   * @param previous_solutions The previous solutions, the most recent first
+   *
+   * @param time_steps The time steps in reverse order, the present one first
+   *
+   * @param extrapolation The locally owned vector in which the extrapolation
+   * is stored. The constraints are not applied.
+   */
+  void
+  extrapolate_solution(
+    const std::vector<const VectorType *> &previous_solutions,
+    const std::vector<double> &            time_steps,
+    VectorType &                           extrapolation);
+
+  // Number of past solution vectors which hold a previous solution. It is
+  // incremented by the physics when the time vectors are percolated and it
+  // must be checkpointed with them.
+  unsigned int number_of_previous_solutions;
+
 private:
+  const bool extrapolate_initial_guess;
+
   NonLinearSolver<VectorType> *non_linear_solver;
 };
 
@@ -132,6 +213,9 @@ template <typename VectorType>
 PhysicsSolver<VectorType>::PhysicsSolver(
   const Parameters::NonLinearSolver non_linear_solver_parameters)
   : pcout({std::cout, Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0})
+  , number_of_previous_solutions(0)
+  , extrapolate_initial_guess(
+      non_linear_solver_parameters.extrapolate_initial_guess)
 {
   switch (non_linear_solver_parameters.solver)
     {
@@ -155,14 +239,81 @@ void
 PhysicsSolver<VectorType>::solve_non_linear_system(
   const Parameters::SimulationControl::TimeSteppingMethod time_stepping_method,
   const bool                                              first_iteration,
-  const bool                                              force_matrix_renewal)
+  const bool                                              force_matrix_renewal,
+  const bool                                              reuse_jacobian)
 {
+  set_initial_guess(time_stepping_method);
+
   // BB IMPORTANT
   // for (unsigned int iphys = 0; iphys < 1; iphys++)
   {
     this->non_linear_solver->solve(time_stepping_method,
                                    first_iteration,
-                                   force_matrix_renewal);
+                                   force_matrix_renewal,
+                                   reuse_jacobian);
   }
 }
+
+template <typename VectorType>
+void
+PhysicsSolver<VectorType>::set_initial_guess(
+  const Parameters::SimulationControl::TimeSteppingMethod time_stepping_method)
+{
+  if (!extrapolate_initial_guess || !is_bdf(time_stepping_method) ||
+      time_stepping_method ==
+        Parameters::SimulationControl::TimeSteppingMethod::steady_bdf)
+    return;
+
+  // The present solution is the solution of the previous time step, it is
+  // only extrapolated when at least one older solution is available
+  std::vector<const VectorType *> previous_solutions =
+    get_previous_solutions();
+  const unsigned int n_previous_solutions =
+    std::min<unsigned int>(number_of_previous_solutions,
+                           previous_solutions.size());
+  if (n_previous_solutions < 2)
+    return;
+
+  const unsigned int order =
+    std::min(bdf_order(time_stepping_method), n_previous_solutions - 1);
+  previous_solutions.resize(order + 1);
+
+  extrapolate_present_solution(previous_solutions, get_time_steps_vector());
+}
+
+template <typename VectorType>
+void
+PhysicsSolver<VectorType>::extrapolate_present_solution(
+  const std::vector<const VectorType *> &previous_solutions,
+  const std::vector<double> &            time_steps)
+{
+  auto &local_evaluation_point = get_local_evaluation_point();
+  extrapolate_solution(previous_solutions, time_steps, local_evaluation_point);
+
+  get_nonzero_constraints().distribute(local_evaluation_point);
+  get_present_solution() = local_evaluation_point;
+}
+
+template <typename VectorType>
+void
+PhysicsSolver<VectorType>::extrapolate_solution(
+  const std::vector<const VectorType *> &previous_solutions,
+  const std::vector<double> &            time_steps,
+  VectorType &                           extrapolation)
+{
+  const Vector<double> coefficients =
+    extrapolation_coefficients(previous_solutions.size() - 1, time_steps);
+
+  // The previous solutions contain the ghost values, they are copied to a
+  // locally owned vector before being added
+  VectorType previous_solution(extrapolation);
+
+  extrapolation = 0;
+  for (unsigned int i = 0; i < previous_solutions.size(); ++i)
+    {
+      previous_solution = *previous_solutions[i];
+      extrapolation.add(coefficients[i], previous_solution);
+    }
+}
+
 #endif
@@ -0,0 +1,137 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/base/point.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/numerics/rtree.h>
+
+#include <boost/signals2/connection.hpp>
+
+#include <vector>
+
+#ifndef lethe_point_locator_h
+#  define lethe_point_locator_h
+
+using namespace dealii;
+
+/**
+ * @brief Locates the active cells of a DoFHandler containing given points.
+ * The bounding boxes of the locally owned and ghost active cells are stored
+ * in an RTree which is built the first time a point is located and rebuilt
+ * lazily once the triangulation has changed. A hint cell can be provided, in
+ * which case the hint and its face neighbors are tested before the RTree is
+ * queried. When successive points are close to each other (e.g. points
+ * stepping along a normal direction), this avoids most of the tree queries.
+ *
+ * Artificial cells are not stored in the RTree. Points which do not lie in a
+ * locally owned or ghost cell are reported by returning dof_handler.end().
+ *
+ * @tparam dim An integer that denotes the dimension of the space
+ */
+template <int dim>
+class PointLocator
+{
+public:
+  using active_cell_iterator = typename DoFHandler<dim>::active_cell_iterator;
+
+  /**
+   * @param dof_handler The DoFHandler whose active cells are located. The
+   * DoFHandler must be attached to a triangulation.
+   * @param mapping The mapping used to decide if a point lies in a cell
+   */
+  PointLocator(const DoFHandler<dim> &dof_handler,
+               const Mapping<dim> &   mapping = StaticMappingQ1<dim>::mapping);
+
+  ~PointLocator();
+
+  /**
+   * @brief Returns the active cell containing a point, or dof_handler.end()
+   * if the point does not lie in a locally owned or ghost cell.
+   *
+   * @param point The point to locate
+   * @param hint A cell which is likely to contain the point, or to be a
+   * neighbor of the cell which contains it. An invalid iterator disables the
+   * hint.
+   */
+  active_cell_iterator
+  find_cell(const Point<dim> &          point,
+            const active_cell_iterator &hint = active_cell_iterator());
+
+  /**
+   * @brief Locates a batch of points. The cell found for a point is used as
+   * the hint of the next one, points should thus be ordered such that
+   * successive points are close to each other.
+   *
+   * @param points The points to locate
+   * @param cells The cells containing the points, dof_handler.end() for the
+   * points which could not be located
+   */
+  void
+  find_cells(const std::vector<Point<dim>> &    points,
+             std::vector<active_cell_iterator> &cells);
+
+  /**
+   * @brief Forces the reconstruction of the RTree at the next query. This is
+   * only required if the vertices are moved without the triangulation
+   * signaling a change.
+   */
+  void
+  clear();
+
+private:
+  /**
+   * @brief Packs the bounding boxes of the locally owned and ghost active
+   * cells into the RTree.
+   */
+  void
+  build_tree();
+
+  /**
+   * @brief Returns true if the point lies within the cell. The bounding box
+   * of the cell is tested before the (expensive) inverse mapping.
+   */
+  bool
+  point_is_in_cell(const active_cell_iterator &cell,
+                   const Point<dim> &          point) const;
+
+  /**
+   * @brief Tests the face neighbors of a cell. The finer neighbors are
+   * tested through the children which share the face. Returns
+   * dof_handler.end() if none of the neighbors contains the point.
+   */
+  active_cell_iterator
+  find_cell_in_neighbors(const active_cell_iterator &cell,
+                         const Point<dim> &          point) const;
+
+  const DoFHandler<dim> &dof_handler;
+  const Mapping<dim> &   mapping;
+
+  RTree<std::pair<BoundingBox<dim>, active_cell_iterator>> tree;
+  bool                                                     tree_is_outdated;
+
+  boost::signals2::connection tria_change_connection;
+
+  // Tolerance, in reference coordinates, used to accept a point as inside a
+  // cell. This prevents points lying on a face from being missed.
+  const double tolerance = 1e-10;
+};
+
+#endif
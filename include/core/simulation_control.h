@@ -113,6 +113,13 @@ protected:
   // Indicator to tell if this is the first assembly of a step
   bool first_assembly;
 
+  // Estimate of the time integration error of the present and the previous
+  // time steps relative to the tolerance, and order of this estimate. These
+  // are provided by the solver when the time step is controlled by the error.
+  double       error_ratio;
+  double       previous_error_ratio;
+  unsigned int error_order;
+
 
 
 public:
@@ -261,6 +268,33 @@ public:
   }
 
 
+  /**
+   * @brief Provide the estimate of the time integration error of the present
+   * time step to the simulation controller. The time step is accurate enough
+   * if the ratio of the error to the tolerance is smaller than one.
+   *
+   * @param p_error_ratio Ratio of the estimated error to the tolerance
+   *
+   * @param p_error_order Order of the estimate. The error scales with the
+   * time step to the power p_error_order + 1
+   */
+  void
+  set_time_step_error(const double       p_error_ratio,
+                      const unsigned int p_error_order)
+  {
+    error_ratio = p_error_ratio;
+    error_order = p_error_order;
+  }
+
+  /**
+   * @brief Rejects the present time step because its error is larger than the
+   * tolerance. The time step is reduced according to the error estimate and
+   * replaces the rejected one, the time steps of the previous iterations are
+   * unchanged. The solver must then solve the time step again.
+   */
+  void
+  reject_time_step();
+
   /**
    * @brief Provide the value of the residual at the beggining
    * of the iteration to the simulation controller
@@ -355,6 +389,10 @@ protected:
   // Time step scaling for adaptative time stepping
   double adaptative_time_step_scaling;
 
+  // The time step is controlled by the time integration error instead of the
+  // CFL
+  bool error_control;
+
   /**
    * @brief Calculates the next value of the time step. If adaptation
    * is enabled, the time step is calculated in order to ensure
@@ -362,7 +400,9 @@ protected:
    * The new time step is equal to adaptative_time_step_scaling * the previous
    * time step. If this surpasses the simulation time or if it surpasses the
    * maximal CFL value, the time step is scaled down to ensure that this is
-   * respected.
+   * respected. If the time step is controlled by the error, the new time step
+   * is calculated by a PI controller from the error of the last two time
+   * steps, and its growth is also bound by adaptative_time_step_scaling.
    */
   virtual double
   calculate_time_step() override;
@@ -416,7 +456,9 @@ protected:
    * The new time step is equal to adaptative_time_step_scaling * the previous
    * time step. If this surpasses the simulation time, the output_time or if it
    * surpasses the maximal CFL value, the time step is scaled down to ensure
-   * that these elements are respected.
+   * that these elements are respected. If the time step is controlled by the
+   * error, it is calculated by the PI controller of SimulationControlTransient
+   * instead of the CFL condition, and it is then bound by the output time.
    */
   virtual double
   calculate_time_step() override;
@@ -33,7 +33,8 @@ public:
   solve(const Parameters::SimulationControl::TimeSteppingMethod
                    time_stepping_method,
         const bool is_initial_step,
-        const bool force_matrix_renewal) override;
+        const bool force_matrix_renewal,
+        const bool reuse_jacobian = false) override;
 
 
 private:
@@ -55,7 +56,8 @@ void
 SkipNewtonNonLinearSolver<VectorType>::solve(
   const Parameters::SimulationControl::TimeSteppingMethod time_stepping_method,
   const bool                                              is_initial_step,
-  const bool                                              force_matrix_renewal)
+  const bool                                              force_matrix_renewal,
+  const bool                                              reuse_jacobian)
 {
   double       current_res;
   double       last_res;
@@ -64,8 +66,12 @@ SkipNewtonNonLinearSolver<VectorType>::solve(
   last_res                     = 1.0;
   current_res                  = 1.0;
 
+  // A reused jacobian takes precedence over the renewal of the matrix, except
+  // for the initial step whose constraints differ
   bool assembly_needed =
-    consecutive_iters == 0 || is_initial_step || force_matrix_renewal;
+    is_initial_step ||
+    (!reuse_jacobian && (consecutive_iters == 0 || force_matrix_renewal));
+  bool frozen_jacobian = !assembly_needed && reuse_jacobian;
 
   PhysicsSolver<VectorType> *solver = this->physics_solver;
 
@@ -124,10 +130,21 @@ SkipNewtonNonLinearSolver<VectorType>::solve(
             }
         }
 
+      // As for the Newton solver, the reused jacobian is abandoned as soon as
+      // it stalls the convergence
+      assembly_needed = false;
+      if (frozen_jacobian &&
+          current_res > this->params.step_tolerance * last_res)
+        {
+          frozen_jacobian = false;
+          assembly_needed = true;
+          if (this->params.verbosity != Parameters::Verbosity::quiet)
+            solver->pcout << "\t\tAssembling the jacobian matrix" << std::endl;
+        }
+
       present_solution = evaluation_point;
       last_res         = current_res;
       ++outer_iteration;
-      assembly_needed = false;
     }
   if (!force_matrix_renewal)
     {
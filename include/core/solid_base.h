@@ -103,6 +103,13 @@ public:
   Function<spacedim> *
   get_solid_velocity();
 
+  /**
+   * @return the number of solid particles located in an active cell of the fluid triangulation, zero if the particles are not set up yet
+   */
+  unsigned int
+  n_particles_in_cell(
+    const typename Triangulation<spacedim>::active_cell_iterator &cell) const;
+
   /**
    * @brief Updates particle positions in solid_particle_handler by integrating velocity using a Runge-Kutta method
    */
@@ -123,6 +130,15 @@ public:
 
 
 private:
+  /**
+   * @brief Updates the reference location of the particles which remain in
+   * their cell after a displacement
+   * @return true if at least one particle (on any process) has left its
+   * cell, in which case the particles must be sorted into the cells again
+   */
+  bool
+  relocate_particles_in_cells();
+
   // Member variables
   MPI_Comm           mpi_communicator;
   const unsigned int n_mpi_processes;
@@ -129,6 +129,21 @@ is_bdf(const Parameters::SimulationControl::TimeSteppingMethod method)
           method == Parameters::SimulationControl::TimeSteppingMethod::bdf3);
 }
 
+/**
+ * @brief Returns the order of a time integration method of the bdf family
+ *
+ * @param method A time integration method of the bdf family
+ */
+inline unsigned int
+bdf_order(const Parameters::SimulationControl::TimeSteppingMethod method)
+{
+  if (method == Parameters::SimulationControl::TimeSteppingMethod::bdf2)
+    return 2;
+  if (method == Parameters::SimulationControl::TimeSteppingMethod::bdf3)
+    return 3;
+  return 1;
+}
+
 /**
  * @brief Determines if the time integration method is within the high-order (>=2) bdf family
  *
@@ -114,5 +114,19 @@ make_table_tensors_scalars(
   const unsigned int                 display_precision);
 
 
+/**
+ * @brief Generate a quasi-uniform set of directions on the unit sphere using
+ * the Fibonacci (golden spiral) lattice. The points are equally spaced along
+ * the polar axis and rotated by the golden angle, hence every point
+ * represents the same area of the sphere (4 pi / n_points). The points are
+ * ordered from the north pole to the south pole, successive points are thus
+ * close to each other.
+ *
+ * @param n_points The number of directions
+ */
+std::vector<Tensor<1, 3>>
+fibonacci_sphere_directions(const unsigned int n_points);
+
+
 
 #endif
@@ -38,6 +38,7 @@
 #include <dem/find_contact_detection_step.h>
 #include <dem/find_maximum_particle_size.h>
 #include <dem/gear3_integrator.h>
+#include <dem/ghost_particle_update.h>
 #include <dem/input_parameter_inspection.h>
 #include <dem/integrator.h>
 #include <dem/localize_contacts.h>
@@ -47,6 +48,7 @@
 #include <dem/particle_point_line_broad_search.h>
 #include <dem/particle_point_line_contact_force.h>
 #include <dem/particle_point_line_fine_search.h>
+#include <dem/particle_sleeping.h>
 #include <dem/pp_broad_search.h>
 #include <dem/pp_contact_force.h>
 #include <dem/pp_contact_info_struct.h>
@@ -197,6 +199,15 @@ private:
   void
   particle_wall_fine_search();
 
+  /**
+   * Finds the local particles which may be in contact with ghost particles,
+   * i.e. the particles located in the cells adjacent to ghost cells and the
+   * particles which are still in contact with a ghost particle. This is
+   * called after each contact search.
+   */
+  void
+  find_boundary_layer_particles();
+
   /**
    * @brief Calculates particles-wall contact forces
    *
@@ -343,6 +354,7 @@ private:
   std::vector<std::pair<std::string, int>> properties =
     properties_class.get_properties_name();
   double             neighborhood_threshold_squared;
+  double             contact_search_skin;
   double             maximum_particle_diameter;
   const unsigned int contact_detection_frequency;
   const unsigned int insertion_frequency;
@@ -364,6 +376,21 @@ private:
   PVDHandler                           particles_pvdhandler;
   const unsigned int                   standard_deviation_multiplier;
 
+  // Deactivation of the particles at rest, only created if it is enabled
+  std::shared_ptr<ParticleSleeping<dim>> particle_sleeping_object;
+
+  // Compact non-blocking update of the ghost particles, only created if it is
+  // enabled. The local-local and local-ghost contact forces are then computed
+  // separately, the empty container is passed in place of the other one
+  std::shared_ptr<GhostParticleUpdate<dim>> ghost_particle_update_object;
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    empty_adjacent_particles;
+
+  // Local particles which may be in contact with ghost particles. With the
+  // communication/computation overlap, the other (interior) particles are
+  // integrated while the ghost particles are updated
+  std::unordered_set<int> boundary_layer_particles;
+
   // Information for parallel grid processing
   DoFHandler<dim> background_dh;
   PVDHandler      grid_pvdhandler;
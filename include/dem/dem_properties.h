@@ -61,7 +61,10 @@ namespace DEM
     acc_derivative_x = 21,
     acc_derivative_y = 22,
     acc_derivative_z = 23,
-    n_properties     = 24,
+    fem_force_x      = 24,
+    fem_force_y      = 25,
+    fem_force_z      = 26,
+    n_properties     = 27,
   };
 
   unsigned int
@@ -0,0 +1,117 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2020 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/particle_iterator.h>
+
+#include <dem/dem_properties.h>
+
+#include <unordered_map>
+#include <vector>
+
+using namespace dealii;
+
+#ifndef ghost_particle_update_h
+#  define ghost_particle_update_h
+
+/**
+ * Compact update of the ghost particles between two contact search steps.
+ * Between these steps, the ghost particles remain in the same cells and only
+ * their location, velocity and angular velocity change, which are the only
+ * fields used by the particle-particle contact force models on the receiving
+ * side. Instead of shipping the whole property block of each ghost particle
+ * (ParticleHandler::update_ghost_particles), the owner processors pack these
+ * fields into a compact buffer per neighbor processor.
+ *
+ * The update is non-blocking: start_update() posts the sends and the
+ * receives, the local-local contact forces are computed while the messages are
+ * in flight and finish_update() waits for the messages and unpacks them before
+ * the calculation of the local-ghost contact forces.
+ *
+ * The communication pattern (which local particles are sent to which
+ * processor, and in which order) is built by build() after each exchange of
+ * the ghost particles, i.e. after each contact search step.
+ */
+template <int dim>
+class GhostParticleUpdate
+{
+public:
+  GhostParticleUpdate<dim>(const MPI_Comm &communicator);
+
+  /**
+   * Builds the communication pattern of the ghost particles. Each processor
+   * sends the ids of its ghost particles to their owner processors, the owner
+   * processors then know which of their local particles are sent to which
+   * processor. This function must be called after the ghost particles are
+   * exchanged and after the particle container is updated.
+   *
+   * @param particle_handler Particle handler of the simulation
+   * @param triangulation Triangulation, used to find the owner processor of the
+   * ghost particles
+   * @param particle_container A container that is used to obtain iterators to
+   * particles using their ids
+   */
+  void
+  build(const Particles::ParticleHandler<dim> &           particle_handler,
+        const parallel::distributed::Triangulation<dim> &triangulation,
+        const std::unordered_map<int, Particles::ParticleIterator<dim>>
+          &particle_container);
+
+  /**
+   * Packs the location, velocity and angular velocity of the local particles
+   * which are ghosts on other processors and posts the non-blocking sends and
+   * receives.
+   */
+  void
+  start_update();
+
+  /**
+   * Waits for the messages posted by start_update() and updates the location,
+   * velocity and angular velocity of the ghost particles. This function does
+   * nothing if no update is in progress.
+   */
+  void
+  finish_update();
+
+private:
+  // Location (dim), velocity (3) and angular velocity (3)
+  static constexpr unsigned int n_fields_per_particle = dim + 6;
+
+  // MPI tag of the messages of the ghost particle update
+  static constexpr int mpi_tag = 3127;
+
+  const MPI_Comm communicator;
+
+  // Processors to which local particles are sent, and the particles sent
+  std::vector<unsigned int>                                  destination_ranks;
+  std::vector<std::vector<Particles::ParticleIterator<dim>>> sent_particles;
+  std::vector<std::vector<double>>                           send_buffers;
+
+  // Processors from which ghost particles are received, and the ghost
+  // particles in the order of the received buffers
+  std::vector<unsigned int>                                  source_ranks;
+  std::vector<std::vector<Particles::ParticleIterator<dim>>> ghost_particles;
+  std::vector<std::vector<double>>                           receive_buffers;
+
+  std::vector<MPI_Request> requests;
+  bool                     update_in_progress;
+};
+
+#endif /* ghost_particle_update_h */
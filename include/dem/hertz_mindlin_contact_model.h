@@ -0,0 +1,94 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2020 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#include <cfloat>
+#include <cmath>
+
+#ifndef lethe_hertz_mindlin_contact_model_h
+#  define lethe_hertz_mindlin_contact_model_h
+
+namespace DEM
+{
+  /**
+   * @brief Spring and dashpot constants of the non-linear (Hertz-Mindlin)
+   * contact model
+   */
+  struct HertzMindlinCoefficients
+  {
+    double normal_spring_constant;
+    double normal_damping_constant;
+    double tangential_spring_constant;
+    double tangential_damping_constant;
+  };
+
+  /**
+   * @brief Calculates the damping parameter of the non-linear contact model
+   * from the restitution coefficient of the contact
+   *
+   * @param restitution_coefficient Effective restitution coefficient
+   */
+  inline double
+  calculate_model_parameter_beta(const double restitution_coefficient)
+  {
+    const double log_restitution = std::log(restitution_coefficient);
+    return log_restitution /
+           std::sqrt(log_restitution * log_restitution + 9.8696);
+  }
+
+  /**
+   * @brief Calculates the spring and dashpot constants of the non-linear
+   * contact model. The constants only depend on the normal overlap and on the
+   * effective properties of the contact. The tangential spring constant is
+   * strictly positive so that the tangential overlap can be recovered from the
+   * tangential force in gross sliding.
+   *
+   * @param normal_overlap Contact normal overlap
+   * @param effective_radius Effective radius of the contact
+   * @param effective_mass Effective mass of the contact
+   * @param effective_youngs_modulus Effective Young's modulus of the contact
+   * @param effective_shear_modulus Effective shear modulus of the contact
+   * @param model_parameter_beta Damping parameter of the contact
+   */
+  inline HertzMindlinCoefficients
+  calculate_hertz_mindlin_coefficients(const double normal_overlap,
+                                       const double effective_radius,
+                                       const double effective_mass,
+                                       const double effective_youngs_modulus,
+                                       const double effective_shear_modulus,
+                                       const double model_parameter_beta)
+  {
+    const double radius_times_overlap_sqrt =
+      std::sqrt(effective_radius * normal_overlap);
+    const double model_parameter_sn =
+      2 * effective_youngs_modulus * radius_times_overlap_sqrt;
+    const double model_parameter_st =
+      8 * effective_shear_modulus * radius_times_overlap_sqrt;
+
+    HertzMindlinCoefficients coefficients;
+    coefficients.normal_spring_constant = 0.66665 * model_parameter_sn;
+    coefficients.normal_damping_constant =
+      -1.8257 * model_parameter_beta *
+      std::sqrt(model_parameter_sn * effective_mass);
+    coefficients.tangential_spring_constant = model_parameter_st + DBL_MIN;
+    coefficients.tangential_damping_constant =
+      coefficients.normal_damping_constant *
+      std::sqrt(model_parameter_st / model_parameter_sn);
+
+    return coefficients;
+  }
+} // namespace DEM
+
+#endif
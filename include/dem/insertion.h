@@ -27,6 +27,7 @@
 #include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/grid/grid_generator.h>
 #include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/grid_tools_cache.h>
 
 #include <deal.II/particles/particle.h>
 #include <deal.II/particles/particle_handler.h>
@@ -39,7 +40,6 @@
 
 #include <fstream>
 #include <iostream>
-#include <random>
 #include <string>
 
 using namespace dealii;
@@ -72,24 +72,6 @@ public:
          const DEMSolverParameters<dim> &                 dem_parameters) = 0;
 
 protected:
-  /**
-   * Carries out checking whether the processor is responsible for finding
-   * the insertion point
-   *
-   * @param i Discretization element in x direction
-   * @param i Discretization element in x direction
-   * @param i Discretization element in x direction
-   * @param this_mpi_process Processor
-   * @param number_of_processors Total number of processors in the simulation
-   * @return Returns true if the processor should handle this insertion point
-   */
-  bool
-  particle_on_processor(const unsigned int &i,
-                        const unsigned int &j,
-                        const unsigned int &k,
-                        const unsigned int &this_mpi_process,
-                        const unsigned int &number_of_processors);
-
   /**
    * Carries out assigning the properties of inserted particles.
    *
@@ -107,37 +89,52 @@ protected:
                        const ConditionalOStream &pcout);
 
   /**
-   * Carries out assigning the properties of inserted particles.
+   * Carries out the insertion of the particles located in the locally owned
+   * cells of this processor. All the processors share the same list of
+   * insertion points, but each processor only locates and inserts the points
+   * which fall in its own cells. Hence, the processors which do not own any
+   * cell of the insertion box do not insert any particle and no communication
+   * is required, except for the update of the global particle number. A point
+   * lying on a face or a vertex shared by the cells of several processors is
+   * inserted by the processor with the lowest rank among them. The
+   * properties of the particles are written directly in the property pool of
+   * the particle handler. The id of each particle is obtained from its index
+   * in the list of insertion points, which makes the insertion independent of
+   * the number of processors.
    *
+   * @param particle_handler The particle handler of particles which are being
+   * inserted
+   * @param triangulation Triangulation to access the cells in which the
+   * particles are inserted
+   * @param insertion_points A vector containing the insertion locations of all
+   * the particles inserted at this step
    * @param dem_parameters DEM parameters declared in the .prm file
-   * @param inserted_this_step Number of particles that are inserted
-   * at each insertion step. This value can change in the last insertion step to
-   * reach the desired number of particles
    * @param current_inserting_particle_type Type of inserting particles
-   * @param particle_propertis Properties of all inserted particles at each insertion step
-   * @param communicator MPI communicator
+   *
+   * @return The number of particles inserted by all the processors. A point
+   * lying on a face between the cells of several processors is inserted by the
+   * processor with the lowest rank, hence this is the number of points.
    */
-  void
-  assign_particle_properties(
-    const DEMSolverParameters<dim> &  dem_parameters,
-    const unsigned int &              inserted_this_step,
-    const unsigned int &              current_inserting_particle_type,
-    std::vector<std::vector<double>> &particle_properties,
-    const MPI_Comm &                  communicator);
+  unsigned int
+  insert_particles_in_locally_owned_cells(
+    Particles::ParticleHandler<dim> &                particle_handler,
+    const parallel::distributed::Triangulation<dim> &triangulation,
+    const std::vector<Point<dim>> &                  insertion_points,
+    const DEMSolverParameters<dim> &                 dem_parameters,
+    const unsigned int &current_inserting_particle_type);
 
   /**
-   * Carries out finding the insertion points of inserted particles.
+   * Carries out finding the insertion points of all the particles inserted at
+   * this step. The insertion points are the same on all the processors.
    *
    * @param insertion_points A vector containing insertion locations of particles
    * @param insertion_information DEM insertion parameters declared in the .prm
    * file
-   * @param communicator MPI communicator
    */
   virtual void
   assign_insertion_points(
     std::vector<Point<dim>> &                    insertion_points,
-    const Parameters::Lagrangian::InsertionInfo &insertion_information,
-    const MPI_Comm &                             communicator) = 0;
+    const Parameters::Lagrangian::InsertionInfo &insertion_information) = 0;
 
   /**
    * @brief Carries out finding the maximum number of inserted particles based on the
@@ -166,30 +163,30 @@ protected:
   // Maximum particle diameter
   double maximum_diameter;
 
-  // Inserted number of particles at this step on this processor
-  unsigned int inserted_this_step_this_proc;
-
-  // A vector of vectors, which contains all the properties of all inserted
-  // particles at each insertion step
-  std::vector<std::vector<double>> particle_properties;
-
 private:
   /**
-   * Carries out sampling from specified distributions for particle size.
+   * Carries out sampling from the specified distribution for the size of a
+   * particle. A counter-based random number generator is used: the sampled
+   * value only depends on the seed and on the particle id. The sampled sizes
+   * are therefore reproducible from one run to the other and do not depend on
+   * the number of processors.
    *
-   * @param particle_sizes A vector containing size of particles sampled from
-   * specified size distribution
    * @param average Average diameter of particles
    * @param standard_deviation Standard deviation of particle diameter
-   * @param particle_number Number of particles
+   * @param random_number_seed Seed of the random number generator
+   * @param particle_id Id of the particle, used as the counter of the random
+   * number generator
+   * @return Sampled particle diameter
    */
-  void
-  particle_size_sampling(std::vector<double> &particle_sizes,
-                         const double &       average,
-                         const double &       standard_deviation,
-                         const double &       particle_number);
-
-  std::vector<double> particle_sizes;
+  double
+  particle_size_sampling(const double &               average,
+                         const double &               standard_deviation,
+                         const int &                  random_number_seed,
+                         const types::particle_index &particle_id);
+
+  // Cache of the triangulation used to locate the insertion points. It is
+  // automatically updated when the triangulation changes
+  std::shared_ptr<GridTools::Cache<dim>> grid_cache;
 };
 
 #endif /* insertion_h */
@@ -21,6 +21,8 @@
 
 #include <dem/dem_solver_parameters.h>
 
+#include <unordered_set>
+
 using namespace dealii;
 
 #ifndef integration_h
@@ -42,8 +44,23 @@ public:
    * property manually
    */
   Integrator<dim>()
+    : sleeping_particles(nullptr)
+    , boundary_layer_particles(nullptr)
+    , post_force_subset(ParticleSubset::all)
   {}
 
+  /**
+   * Subsets of the local particles integrated by integrate_post_force. The
+   * boundary layer contains the local particles which may be in contact with
+   * ghost particles, the interior contains all the other local particles.
+   */
+  enum class ParticleSubset
+  {
+    all,
+    interior,
+    boundary_layer
+  };
+
   virtual ~Integrator()
   {}
 
@@ -75,6 +92,87 @@ public:
   integrate_post_force(Particles::ParticleHandler<dim> &particle_handler,
                        Tensor<1, dim>                   body_force,
                        double                           time_step) = 0;
+
+  /**
+   * Attaches the container of sleeping particles to the integrator. Sleeping
+   * particles are skipped in both integration steps, they keep their position
+   * and their velocity remains zero until they are woken up.
+   *
+   * @param sleeping_particles Ids of the sleeping particles
+   */
+  void
+  set_sleeping_particles(const std::unordered_set<int> *sleeping_particles)
+  {
+    this->sleeping_particles = sleeping_particles;
+  }
+
+  /**
+   * Attaches the container of the boundary layer particles to the integrator.
+   * This container is required to integrate the interior and the boundary
+   * layer particles separately.
+   *
+   * @param boundary_layer_particles Ids of the boundary layer particles
+   */
+  void
+  set_boundary_layer_particles(
+    const std::unordered_set<int> *boundary_layer_particles)
+  {
+    this->boundary_layer_particles = boundary_layer_particles;
+  }
+
+  /**
+   * Sets the subset of particles integrated by the next calls of
+   * integrate_post_force. This allows integrating the interior particles
+   * while the ghost particles are being updated.
+   *
+   * @param subset Subset of particles to integrate
+   */
+  void
+  set_post_force_subset(const ParticleSubset subset)
+  {
+    Assert(subset == ParticleSubset::all || boundary_layer_particles != nullptr,
+           ExcMessage("The boundary layer particles are not attached"));
+    post_force_subset = subset;
+  }
+
+protected:
+  /**
+   * Returns true if the particle with the given id is sleeping and must not be
+   * integrated
+   *
+   * @param particle_id Id of the particle
+   */
+  inline bool
+  is_sleeping(const int particle_id) const
+  {
+    return sleeping_particles != nullptr &&
+           sleeping_particles->count(particle_id) > 0;
+  }
+
+  /**
+   * Returns true if the particle with the given id must not be integrated by
+   * integrate_post_force, either because it is sleeping or because it is not
+   * part of the current subset
+   *
+   * @param particle_id Id of the particle
+   */
+  inline bool
+  is_skipped_in_post_force(const int particle_id) const
+  {
+    if (is_sleeping(particle_id))
+      return true;
+
+    if (post_force_subset == ParticleSubset::all)
+      return false;
+
+    const bool in_boundary_layer =
+      boundary_layer_particles->count(particle_id) > 0;
+    return (post_force_subset == ParticleSubset::interior) == in_boundary_layer;
+  }
+
+  const std::unordered_set<int> *sleeping_particles;
+  const std::unordered_set<int> *boundary_layer_particles;
+  ParticleSubset                 post_force_subset;
 };
 
 #endif /* integration_h */
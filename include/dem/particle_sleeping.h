@@ -0,0 +1,198 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2020 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <boost/range/adaptor/map.hpp>
+
+#include <dem/dem_properties.h>
+#include <dem/dem_solver_parameters.h>
+#include <dem/particle_point_line_contact_info_struct.h>
+#include <dem/pp_contact_info_struct.h>
+#include <dem/pw_contact_info_struct.h>
+
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace dealii;
+
+#ifndef particle_sleeping_h
+#  define particle_sleeping_h
+
+/**
+ * Deactivates (puts to sleep) the particles which remain at rest during a
+ * given number of consecutive steps. A particle is at rest when its
+ * translational velocity, its rotational velocity (at its surface) and its
+ * acceleration, i.e. the imbalance of the contact forces acting on it, stay
+ * below user-defined thresholds. A particle only goes to sleep if all its
+ * local neighbors are also at rest, hence clusters of particles go to sleep
+ * together.
+ *
+ * Sleeping particles are skipped by the integrator and the contact pairs
+ * between two sleeping particles, as well as the particle-wall pairs of
+ * sleeping particles, are moved out of the containers used by the contact
+ * force models. They are stored as dormant contacts (with their tangential
+ * history) and are restored when one of their particles wakes up or before a
+ * contact search.
+ *
+ * A sleeping particle wakes up when one of its awake neighbors, local or
+ * ghost, moves faster than the velocity threshold, or when it touches a
+ * floating wall or a moving wall. Particles in contact with ghost particles,
+ * floating walls, moving walls, boundary points or boundary lines never sleep.
+ */
+
+template <int dim>
+class ParticleSleeping
+{
+public:
+  ParticleSleeping<dim>(const DEMSolverParameters<dim> &dem_parameters);
+
+  /**
+   * Updates the sleeping state of the particles. This function is called at
+   * the end of each time step (after the integration). It wakes up the
+   * sleeping particles disturbed by their awake neighbors, updates the number
+   * of consecutive steps at rest of the awake particles, puts the particle
+   * clusters at rest to sleep and moves the contacts of sleeping particles to
+   * the dormant containers.
+   *
+   * @param particle_handler Particle handler of the simulation
+   * @param local_adjacent_particles Local-local particle contact pairs
+   * @param ghost_adjacent_particles Local-ghost particle contact pairs
+   * @param pw_pairs_in_contact Particle-wall contact pairs
+   * @param pfw_pairs_in_contact Particle-floating wall contact pairs
+   * @param particle_points_in_contact Particle-point contact pairs
+   * @param particle_lines_in_contact Particle-line contact pairs
+   */
+  void
+  update_sleeping_particles(
+    Particles::ParticleHandler<dim> &particle_handler,
+    std::unordered_map<int,
+                       std::unordered_map<int, pp_contact_info_struct<dim>>>
+      &local_adjacent_particles,
+    const std::unordered_map<
+      int,
+      std::unordered_map<int, pp_contact_info_struct<dim>>>
+      &ghost_adjacent_particles,
+    std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+      &pw_pairs_in_contact,
+    const std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+      &pfw_pairs_in_contact,
+    const std::unordered_map<int, particle_point_line_contact_info_struct<dim>>
+      &particle_points_in_contact,
+    const std::unordered_map<int, particle_point_line_contact_info_struct<dim>>
+      &particle_lines_in_contact);
+
+  /**
+   * Moves the dormant contacts back to the containers used by the contact
+   * search and the contact force models. This must be called before every
+   * contact search, since the iterators of the dormant contacts are updated
+   * and the dormant pairs are localized as any other pair.
+   *
+   * @param local_adjacent_particles Local-local particle contact pairs
+   * @param pw_pairs_in_contact Particle-wall contact pairs
+   */
+  void
+  restore_dormant_contacts(
+    std::unordered_map<int,
+                       std::unordered_map<int, pp_contact_info_struct<dim>>>
+      &local_adjacent_particles,
+    std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+      &pw_pairs_in_contact);
+
+  /**
+   * Wakes up all the particles and restores all the dormant contacts. This is
+   * used when the particles are redistributed between the processors (load
+   * balancing), since the sleeping state is only known by the owner
+   * processor.
+   *
+   * @param local_adjacent_particles Local-local particle contact pairs
+   * @param pw_pairs_in_contact Particle-wall contact pairs
+   */
+  void
+  wake_up_all_particles(
+    std::unordered_map<int,
+                       std::unordered_map<int, pp_contact_info_struct<dim>>>
+      &local_adjacent_particles,
+    std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+      &pw_pairs_in_contact);
+
+  /**
+   * Removes the particles which are no longer owned by this processor (they
+   * left the domain, were deleted or moved to another processor) from the
+   * sleeping state containers. This must be called after the particles are
+   * sorted into the cells, otherwise the containers grow without bound and
+   * their ids can match the ids of new particles.
+   *
+   * @param particle_handler Particle handler of the simulation
+   */
+  void
+  remove_lost_particles(
+    const Particles::ParticleHandler<dim> &particle_handler);
+
+  /**
+   * Returns the ids of the sleeping particles. The integrator keeps a pointer
+   * to this container to skip the sleeping particles.
+   */
+  const std::unordered_set<int> &
+  get_sleeping_particles() const
+  {
+    return sleeping_particles;
+  }
+
+private:
+  /**
+   * Wakes up a particle. The velocity of a sleeping particle is zero, only its
+   * force and torque have to be reinitialized since they are not reset by the
+   * integrator while the particle sleeps.
+   *
+   * @param particle_properties Properties of the particle to wake up
+   * @param particle_id Id of the particle to wake up
+   */
+  void
+  wake_up_particle(ArrayView<double> &particle_properties,
+                   const int          particle_id);
+
+  /**
+   * Puts a particle to sleep. Its velocity, angular velocity, acceleration,
+   * force and torque are set to zero.
+   *
+   * @param particle_properties Properties of the particle to put to sleep
+   * @param particle_id Id of the particle to put to sleep
+   */
+  void
+  put_particle_to_sleep(ArrayView<double> &particle_properties,
+                        const int          particle_id);
+
+  const double       velocity_threshold;
+  const double       acceleration_threshold;
+  const unsigned int sleeping_steps;
+
+  // Boundary ids of the walls with a prescribed motion
+  std::unordered_set<unsigned int> moving_boundaries;
+
+  // Number of consecutive steps at rest of the awake particles
+  std::unordered_map<int, unsigned int> steps_at_rest;
+
+  std::unordered_set<int> sleeping_particles;
+
+  // Contacts of sleeping particles, these are not seen by the force models
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    dormant_pp_contacts;
+  std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+    dormant_pw_contacts;
+};
+
+#endif /* particle_sleeping_h */
@@ -16,6 +16,7 @@
  *
  * Author: Shahab Golshan, Polytechnique Montreal, 2019
  */
+#include <deal.II/base/bounding_box.h>
 #include <deal.II/base/timer.h>
 
 #include <deal.II/distributed/tria.h>
@@ -24,6 +25,7 @@
 #include <deal.II/particles/particle_handler.h>
 #include <deal.II/particles/particle_iterator.h>
 
+#include <dem/dem_properties.h>
 #include <dem/pp_contact_info_struct.h>
 
 #include <iostream>
@@ -84,6 +86,112 @@ public:
       *                                        cells_ghost_neighbor_list,
     std::unordered_map<int, std::vector<int>> &local_contact_pair_candidates,
     std::unordered_map<int, std::vector<int>> &ghost_contact_pair_candidates);
+
+  /**
+   * Polydisperse version of the broad search. The particles of each cell are
+   * binned into size classes (the radii of two consecutive classes differ by
+   * a factor two) and a pair is only kept as a candidate if the distance
+   * between the particle centers is smaller than the per-pair cutoff
+   * r_i + r_j + skin. The size classes of a neighbor cell which cannot reach
+   * the particle of the main cell (distance from the particle to the bounding
+   * box of the cell larger than r_i + largest radius of the class + skin) are
+   * skipped. This way, small particles are only searched against small
+   * neighborhoods, even if large particles are present in the system.
+   *
+   * @param particle_handler The particle handler of particles in the broad
+   * search
+   * @param cells_local_neighbor_list This vector is the output of
+   * find_cell_neighbors class and shows the local neighbor cells of all local
+   * cells in the triangulation
+   * @param cells_ghost_neighbor_list This vector is the output of
+   * find_cell_neighbors class and shows the ghost neighbor cells of all local
+   * cells in the triangulation
+   * @param maximum_particle_diameter Largest particle diameter, used to define
+   * the size classes
+   * @param contact_search_skin Distance added to the sum of the radii of a
+   * pair to obtain its cutoff distance
+   * @param local_contact_pair_candidates A map of vectors which contains all
+   * the local-local particle pairs which are collision candidates
+   * @param ghost_contact_pair_candidates A map of vectors which contains all
+   * the local-ghost particle pairs which are collision candidates
+   */
+  void
+  find_particle_particle_contact_pairs_polydisperse(
+    dealii::Particles::ParticleHandler<dim> &particle_handler,
+    const std::vector<
+      std::vector<typename Triangulation<dim>::active_cell_iterator>>
+      *cells_local_neighbor_list,
+    const std::vector<
+      std::vector<typename Triangulation<dim>::active_cell_iterator>>
+      *                                        cells_ghost_neighbor_list,
+    const double                               maximum_particle_diameter,
+    const double                               contact_search_skin,
+    std::unordered_map<int, std::vector<int>> &local_contact_pair_candidates,
+    std::unordered_map<int, std::vector<int>> &ghost_contact_pair_candidates);
+
+private:
+  // Information of a particle required by the polydisperse broad search
+  struct particle_search_info
+  {
+    int        id;
+    Point<dim> location;
+    double     radius;
+  };
+
+  // Particles of a cell binned into size classes
+  struct cell_size_classes
+  {
+    std::vector<std::vector<particle_search_info>> particles;
+    std::vector<double>                            maximum_radius;
+    BoundingBox<dim>                               bounding_box;
+    unsigned int                                   n_particles  = 0;
+    unsigned int                                   search_stamp = 0;
+  };
+
+  /**
+   * Returns the size classes of the particles located in a cell. The size
+   * classes are built once per broad search and are reused each time the cell
+   * appears in a neighbor list.
+   *
+   * @param particle_handler The particle handler of particles in the broad
+   * search
+   * @param cell The cell of which the size classes are returned
+   * @param maximum_particle_radius Largest particle radius, used to define
+   * the size classes
+   */
+  const cell_size_classes &
+  get_cell_size_classes(
+    dealii::Particles::ParticleHandler<dim> &                particle_handler,
+    const typename Triangulation<dim>::active_cell_iterator &cell,
+    const double maximum_particle_radius);
+
+  /**
+   * Adds the pairs formed by a particle of the main cell and the particles of
+   * a neighbor cell which are within their cutoff distance.
+   *
+   * @param main_particle The particle of the main cell
+   * @param neighbor_cell The size classes of the neighbor cell
+   * @param contact_search_skin Distance added to the sum of the radii of a
+   * pair to obtain its cutoff distance
+   * @param particle_candidate_container The candidates of the main particle
+   */
+  void
+  add_candidates_in_neighbor_cell(
+    const particle_search_info &main_particle,
+    const cell_size_classes &   neighbor_cell,
+    const double                contact_search_skin,
+    std::vector<int> &          particle_candidate_container);
+
+  // Maximum number of size classes, the smallest class contains all the
+  // particles smaller than 2^-(n_size_classes - 1) times the largest radius
+  static constexpr unsigned int n_size_classes = 8;
+
+  // Size classes of the cells, indexed by active cell index
+  std::vector<cell_size_classes> size_classes_of_cells;
+
+  // Incremented at each polydisperse broad search to invalidate the size
+  // classes of the previous search
+  unsigned int current_search_stamp = 0;
 };
 
 #endif /* particle_particle_broad_search_h */
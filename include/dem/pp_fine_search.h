@@ -95,6 +95,65 @@ public:
     std::unordered_map<int, Particles::ParticleIterator<dim>>
       &          particle_container,
     const double neighborhood_threshold);
+
+  /**
+   * Polydisperse version of the fine search. A particle pair is in the
+   * neighborhood if the distance between the particle centers is smaller than
+   * the per-pair cutoff r_i + r_j + skin, instead of the cutoff defined by
+   * the largest particle diameter.
+   *
+   * @param local_contact_pair_candidates The output of broad search which shows
+   * local-local contact pair candidates
+   * @param ghost_contact_pair_candidates The output of broad search which shows
+   * local-ghost contact pair candidates
+   * @param local_adjacent_particles A map of maps which stores all the required
+   * information for calculation of the contact force of local-local particle
+   * pairs
+   * @param ghost_adjacent_particles A map of maps which stores all the required
+   * information for calculation of the contact force of local-ghost particle
+   * pairs
+   * @param particle_container A container that is used to obtain iterators to
+   * particles using their ids
+   * @param contact_search_skin Distance added to the sum of the radii of a
+   * pair to obtain its cutoff distance
+   */
+  void
+  particle_particle_polydisperse_fine_search(
+    const std::unordered_map<int, std::vector<int>>
+      &local_contact_pair_candidates,
+    const std::unordered_map<int, std::vector<int>>
+      &ghost_contact_pair_candidates,
+    std::unordered_map<int,
+                       std::unordered_map<int, pp_contact_info_struct<dim>>>
+      &local_adjacent_particles,
+    std::unordered_map<int,
+                       std::unordered_map<int, pp_contact_info_struct<dim>>>
+      &ghost_adjacent_particles,
+    std::unordered_map<int, Particles::ParticleIterator<dim>>
+      &          particle_container,
+    const double contact_search_skin);
+
+private:
+  /**
+   * Carries out the fine search, in_neighborhood(particle_one, particle_two,
+   * square_distance) defines if a pair of particles is in the neighborhood.
+   */
+  template <typename NeighborhoodCriterion>
+  void
+  fine_search(
+    const std::unordered_map<int, std::vector<int>>
+      &local_contact_pair_candidates,
+    const std::unordered_map<int, std::vector<int>>
+      &ghost_contact_pair_candidates,
+    std::unordered_map<int,
+                       std::unordered_map<int, pp_contact_info_struct<dim>>>
+      &local_adjacent_particles,
+    std::unordered_map<int,
+                       std::unordered_map<int, pp_contact_info_struct<dim>>>
+      &ghost_adjacent_particles,
+    std::unordered_map<int, Particles::ParticleIterator<dim>>
+      &                          particle_container,
+    const NeighborhoodCriterion &in_neighborhood);
 };
 
 #endif /* particle_particle_fine_search_h */
@@ -21,6 +21,7 @@
 #include <deal.II/particles/particle_iterator.h>
 
 #include <dem/dem_solver_parameters.h>
+#include <dem/hertz_mindlin_contact_model.h>
 #include <dem/pp_contact_force.h>
 #include <dem/pp_contact_info_struct.h>
 #include <math.h>
@@ -63,18 +63,18 @@ public:
 private:
   /**
    * Creates a vector of insertion points for uniform insertion. The output
-   * of this function is used as input argument in insert_global_particles
+   * of this function is used as input argument in
+   * insert_particles_in_locally_owned_cells
    *
    * @param insertion_points A vector containing insertion locations of particles
    * @param insertion_information DEM insertion parameters declared in the .prm
    * file
-   * @param communicator MPI communicator
    */
   virtual void
   assign_insertion_points(
     std::vector<Point<dim>> &                    insertion_points,
-    const Parameters::Lagrangian::InsertionInfo &insertion_information,
-    const MPI_Comm &                             communicator) override;
+    const Parameters::Lagrangian::InsertionInfo &insertion_information)
+    override;
 
   // Number of remained particles of each type that should be inserted in the
   // upcoming insertion steps
@@ -20,6 +20,10 @@
 #ifndef lethe_gls_vans_h
 #define lethe_gls_vans_h
 
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/particles/particle_handler.h>
+
 #include <core/grids.h>
 #include <core/parameters.h>
 #include <core/parameters_cfd_dem.h>
@@ -29,6 +33,8 @@
 #include "core/grids.h"
 #include "core/manifolds.h"
 #include "core/time_integration_utilities.h"
+#include "dem/dem_properties.h"
+#include "fem-dem/void_fraction.h"
 #include "solvers/gls_navier_stokes.h"
 
 using namespace dealii;
@@ -36,6 +42,14 @@ using namespace dealii;
 /**
  * A solver class for the VANS equation using GLS stabilization
  *
+ * The void fraction is either a function of space and time or it is
+ * calculated from particles with the particle centroid method. In the latter
+ * case, this class only provides the building blocks of a CFD-DEM coupling:
+ * the particles, which must be inserted and moved by the user of the class,
+ * and the drag force exerted by the fluid on them. There is no DEM solver
+ * driven by this class and the reaction of the drag force on the fluid is not
+ * included in the VANS equations.
+ *
  * @tparam dim An integer that denotes the dimension of the space in which
  * the flow is solved
  *
@@ -54,6 +68,32 @@ public:
   virtual void
   solve() override;
 
+  /**
+   * @brief Returns the particles used to calculate the void fraction when
+   * the void fraction is calculated with the particle centroid method. The
+   * particles live on the triangulation of the fluid, hence a DEM solver
+   * running in the same process can share them directly. They must be sorted
+   * into the cells of the triangulation before the void fraction is
+   * calculated. They follow the cells when the fluid mesh is refined or
+   * repartitioned. No DEM solver moves them within this class.
+   */
+  Particles::ParticleHandler<dim> &
+  get_particle_handler()
+  {
+    return particle_handler;
+  }
+
+  /**
+   * @brief Calculates the drag force exerted by the fluid on each locally
+   * owned particle with the Di Felice model and stores it in the fem_force
+   * properties of the particle. The DEM integrators add this force to the
+   * contact forces. It is called after each fluid time step when the void
+   * fraction is calculated from the particles. The opposite force is not
+   * applied to the fluid.
+   */
+  void
+  calculate_particle_fluid_forces();
+
 private:
   void
   initialize_void_fraction();
@@ -115,8 +155,19 @@ private:
   DoFHandler<dim> void_fraction_dof_handler;
   FE_Q<dim>       fe_void_fraction;
 
+  // Void fraction of the cells calculated from the particles, indexed by the
+  // active cell index
   Vector<double> cell_void_fraction;
 
+  // Projection of the cell void fraction onto the void fraction FE space
+  AffineConstraints<double>   void_fraction_constraints;
+  VoidFractionProjection<dim> void_fraction_projection;
+
+  // Mapping of the fluid, the reference locations of the particles are
+  // calculated with it so that they match the fluid and void fraction fields
+  MappingQ<dim>                   mapping;
+  Particles::ParticleHandler<dim> particle_handler;
+
   // Solution of the void fraction at previous time steps
 
   TrilinosWrappers::MPI::Vector void_fraction_m1;
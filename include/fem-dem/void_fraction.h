@@ -0,0 +1,145 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2020 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+
+ *
+ * Author: Toni EL Geitani, Polytechnique Montreal, 2020-
+ */
+
+#ifndef lethe_void_fraction_h
+#define lethe_void_fraction_h
+
+#include <deal.II/base/quadrature.h>
+
+#include <deal.II/distributed/tria_base.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/mapping.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/trilinos_precondition.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+#include <deal.II/lac/trilinos_vector.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <core/parameters_cfd_dem.h>
+
+#include <memory>
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief Calculates the void fraction of each locally owned cell with the
+ * particle centroid method. Each particle contributes its whole volume to the
+ * cell which contains its centroid. The void fraction of the other cells is
+ * one.
+ *
+ * @param triangulation Triangulation into which the particles are sorted
+ * @param particle_handler Particles, with the DEM properties
+ * @param cell_void_fraction Void fraction of the cells, indexed by the active
+ * cell index
+ */
+template <int dim>
+void
+calculate_cell_void_fraction(
+  const parallel::DistributedTriangulationBase<dim> &triangulation,
+  const Particles::ParticleHandler<dim> &            particle_handler,
+  Vector<double> &                                   cell_void_fraction);
+
+/**
+ * Projection of a void fraction which is constant over each cell onto a
+ * continuous FE space. The pcm mode averages the cell void fraction at the
+ * nodes (lumped L2 projection), the pcm_projection mode solves an L2
+ * projection smoothed with a diffusion term.
+ *
+ * The operator of the projection (the lumped mass or the smoothed mass matrix
+ * and its preconditioner) and the integrals of the shape functions over each
+ * cell only depend on the mesh. They are assembled at the first projection
+ * and reused until the next call to setup().
+ */
+template <int dim>
+class VoidFractionProjection
+{
+public:
+  /**
+   * @param dof_handler DoFHandler of the void fraction
+   * @param constraints Constraints of the void fraction
+   * @param mode Void fraction mode, pcm or pcm_projection
+   * @param smoothing_length Length of the smoothing of the pcm_projection
+   */
+  VoidFractionProjection(const DoFHandler<dim> &            dof_handler,
+                         const AffineConstraints<double> &  constraints,
+                         const Parameters::VoidFractionMode mode,
+                         const double                       smoothing_length);
+
+  /**
+   * @brief Allocates the operator of the projection. It must be called every
+   * time the dofs of the void fraction change.
+   *
+   * @param locally_owned_dofs Locally owned dofs of the void fraction
+   * @param locally_relevant_dofs Locally relevant dofs of the void fraction
+   * @param mpi_communicator Communicator of the triangulation
+   */
+  void
+  setup(const IndexSet &locally_owned_dofs,
+        const IndexSet &locally_relevant_dofs,
+        const MPI_Comm &mpi_communicator);
+
+  /**
+   * @brief Projects the cell void fraction onto the void fraction FE space.
+   *
+   * @param mapping Mapping of the cells
+   * @param quadrature Quadrature used to assemble the operator
+   * @param cell_void_fraction Void fraction of the cells, indexed by the
+   * active cell index
+   * @param nodal_void_fraction Locally owned void fraction at the dofs. On
+   * input, it is the initial guess of the iterative solver.
+   * @param max_iterations Maximum number of iterations of the iterative
+   * solver
+   * @param tolerance Absolute tolerance on the residual of the iterative
+   * solver
+   */
+  void
+  project(const Mapping<dim> &           mapping,
+          const Quadrature<dim> &        quadrature,
+          const Vector<double> &         cell_void_fraction,
+          TrilinosWrappers::MPI::Vector &nodal_void_fraction,
+          const unsigned int             max_iterations,
+          const double                   tolerance);
+
+private:
+  void
+  assemble(const Mapping<dim> &mapping, const Quadrature<dim> &quadrature);
+
+  const DoFHandler<dim> &          dof_handler;
+  const AffineConstraints<double> &constraints;
+  const bool                       lumped;
+  const double                     smoothing_length;
+
+  TrilinosWrappers::SparseMatrix system_matrix;
+  TrilinosWrappers::MPI::Vector  system_rhs;
+  TrilinosWrappers::MPI::Vector  lumped_mass;
+  std::shared_ptr<TrilinosWrappers::PreconditionAMG> preconditioner;
+
+  // Integrals of the shape functions over each cell, indexed by the active
+  // cell index and the local dof index
+  std::vector<double> cell_shape_function_integrals;
+  bool                is_assembled;
+};
+
+#endif
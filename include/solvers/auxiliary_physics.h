@@ -26,8 +26,13 @@
 
 #include <core/parameters.h>
 #include <core/physics_solver.h>
+#include <core/simulation_control.h>
 #include <solvers/simulation_parameters.h>
 
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+
 
 /**
  * Au auxiliary physics is defined as a physics that is solved on top of
@@ -69,6 +74,12 @@ public:
   AuxiliaryPhysics(
     const Parameters::NonLinearSolver non_linear_solver_parameters)
     : PhysicsSolver<VectorType>(non_linear_solver_parameters)
+    , current_time(0)
+    , time_step_ratio(1)
+    , number_subcycles(1)
+    , n_accumulated_time_steps(0)
+    , accumulated_time_step(0)
+    , solved_at_present_time_step(true)
   {}
 
   /**
@@ -160,6 +171,201 @@ public:
    */
   virtual void
   set_initial_conditions() = 0;
+
+  /**
+   * @brief Sets the time-stepping of the physics relative to the fluid dynamics.
+   * The physics is solved every time_step_ratio time steps of the fluid
+   * dynamics, with a time step equal to the sum of these time steps. This
+   * time step is divided into number_subcycles sub-steps.
+   *
+   * @param p_time_step_ratio Number of fluid dynamics time steps per time step of the physics
+   *
+   * @param p_number_subcycles Number of sub-steps in a time step of the physics
+   */
+  void
+  set_time_step_ratio(const unsigned int p_time_step_ratio,
+                      const unsigned int p_number_subcycles)
+  {
+    AssertThrow(p_time_step_ratio > 0 && p_number_subcycles > 0,
+                ExcMessage("The time step ratio and the number of subcycles "
+                           "of a physics must be at least 1"));
+    time_step_ratio  = p_time_step_ratio;
+    number_subcycles = p_number_subcycles;
+  }
+
+  /**
+   * @brief Indicates if the physics advances with its own time step instead of
+   * the time step of the fluid dynamics
+   */
+  bool
+  has_own_time_step() const
+  {
+    return time_step_ratio > 1 || number_subcycles > 1;
+  }
+
+  /**
+   * @brief Indicates if the physics was solved during the present time step
+   * of the fluid dynamics. Its time step must only be finished if it was.
+   */
+  bool
+  is_solved_at_present_time_step() const
+  {
+    return solved_at_present_time_step;
+  }
+
+  /**
+   * @brief Solves the physics over a time step of the fluid dynamics. When
+   * the physics has its own time step, the fluid dynamics time steps are
+   * accumulated until the physics is due, then the physics is solved in
+   * sub-steps. The time step history of the physics, used by the BDF schemes,
+   * is then made of its own time steps.
+   *
+   * @param time_stepping_method Time-Stepping method with which the physics is solved
+   *
+   * @param simulation_control Simulation control of the fluid dynamics
+   *
+   * @param force_matrix_renewal Forces the non-linear solver to renew the matrix
+   */
+  void
+  solve_time_step(const Parameters::SimulationControl::TimeSteppingMethod
+                                     time_stepping_method,
+                  SimulationControl &simulation_control,
+                  const bool         force_matrix_renewal)
+  {
+    if (!has_own_time_step())
+      {
+        time_steps   = simulation_control.get_time_steps_vector();
+        current_time = simulation_control.get_current_time();
+        this->solve_non_linear_system(time_stepping_method,
+                                      false,
+                                      force_matrix_renewal);
+        return;
+      }
+
+    accumulated_time_step += simulation_control.get_time_step();
+    ++n_accumulated_time_steps;
+    solved_at_present_time_step = n_accumulated_time_steps == time_step_ratio;
+    if (!solved_at_present_time_step)
+      return;
+
+    const double sub_time_step = accumulated_time_step / number_subcycles;
+    const double start_time =
+      simulation_control.get_current_time() - accumulated_time_step;
+
+    initialize_time_stepping(simulation_control);
+
+    for (unsigned int s = 0; s < number_subcycles; ++s)
+      {
+        // The solution of the last sub-step is percolated when the time step
+        // of the physics is finished
+        if (s > 0)
+          percolate_time_vectors();
+
+        time_steps.insert(time_steps.begin(), sub_time_step);
+        time_steps.pop_back();
+        current_time = start_time + (s + 1) * sub_time_step;
+
+        this->solve_non_linear_system(time_stepping_method,
+                                      false,
+                                      force_matrix_renewal);
+      }
+
+    n_accumulated_time_steps = 0;
+    accumulated_time_step    = 0;
+  }
+
+  /**
+   * @brief Initializes the time step history of the physics from the
+   * simulation control of the fluid dynamics, so that it can be queried before
+   * the first time step. Without history, the previous time steps of a
+   * physics with its own time step are taken equal to its nominal time step,
+   * as the previous solutions are equal to the initial condition. Nothing is
+   * done if the history is already initialized (mesh adaptation, restart).
+   *
+   * @param simulation_control Simulation control of the fluid dynamics
+   */
+  void
+  initialize_time_stepping(SimulationControl &simulation_control)
+  {
+    if (!time_steps.empty())
+      return;
+
+    time_steps   = simulation_control.get_time_steps_vector();
+    current_time = simulation_control.get_current_time();
+    if (has_own_time_step())
+      std::fill(time_steps.begin(),
+                time_steps.end(),
+                simulation_control.get_time_step() * time_step_ratio /
+                  number_subcycles);
+  }
+
+  /**
+   * @brief Writes the time-stepping state of the physics (time step history,
+   * time and cycling counters) so that a restarted simulation resumes in the
+   * same cycling phase.
+   *
+   * @param output Stream in which the state is written
+   */
+  void
+  save_time_stepping(std::ostream &output) const
+  {
+    output << std::setprecision(std::numeric_limits<double>::max_digits10)
+           << time_steps.size();
+    for (const double time_step : time_steps)
+      output << " " << time_step;
+    output << " " << current_time << " " << n_accumulated_time_steps << " "
+           << accumulated_time_step << " " << solved_at_present_time_step
+           << " " << this->number_of_previous_solutions << std::endl;
+  }
+
+  /**
+   * @brief Reads the time-stepping state written by save_time_stepping
+   *
+   * @param input Stream from which the state is read
+   */
+  void
+  read_time_stepping(std::istream &input)
+  {
+    unsigned int n_time_steps;
+    input >> n_time_steps;
+    time_steps.resize(n_time_steps);
+    for (double &time_step : time_steps)
+      input >> time_step;
+    input >> current_time >> n_accumulated_time_steps >>
+      accumulated_time_step >> solved_at_present_time_step >>
+      this->number_of_previous_solutions;
+  }
+
+  /**
+   * @brief Time steps of the physics, the present one first. These are the
+   * time steps of the fluid dynamics unless the physics has its own time step.
+   */
+  std::vector<double>
+  get_time_steps_vector() const override
+  {
+    return time_steps;
+  }
+
+  /**
+   * @brief Time at the end of the time step of the physics being solved
+   */
+  double
+  get_current_time() const
+  {
+    return current_time;
+  }
+
+private:
+  // Time-stepping of the physics
+  std::vector<double> time_steps;
+  double              current_time;
+
+  // Sub-cycling and super-cycling relative to the fluid dynamics
+  unsigned int time_step_ratio;
+  unsigned int number_subcycles;
+  unsigned int n_accumulated_time_steps;
+  double       accumulated_time_step;
+  bool         solved_at_present_time_step;
 };
 
 
@@ -178,6 +178,16 @@ private:
   std::shared_ptr<BlockSchurPreconditioner<TrilinosWrappers::PreconditionAMG>>
     system_amg_preconditioner;
 
+  // Constant modes of the AMG preconditioners, computed once per
+  // distribution of the dofs
+  std::vector<std::vector<bool>> velocity_constant_modes;
+  std::vector<std::vector<bool>> pressure_constant_modes;
+
+  // Full rebuild of the AMG hierarchies and number of iterations obtained
+  // with the last fully built hierarchies (zero until the first solve)
+  bool         amg_rebuild_required     = true;
+  unsigned int amg_reference_iterations = 0;
+
   const double gamma = 1;
 };
 
@@ -24,6 +24,58 @@
 
 using namespace dealii;
 
+/**
+ * Block upper triangular preconditioner for the monolithic GLS system
+ *
+ *   [ A  B^T ]
+ *   [ B  C   ]
+ *
+ * The degrees of freedom must be numbered component-wise, the velocity
+ * degrees of freedom come first and the pressure degrees of freedom last.
+ * The velocity block A is approximated by an AMG cycle and the inverse of the
+ * Schur complement is approximated by the Cahouet-Chabard operator
+ * S^-1 ~ viscosity * Mp^-1 + alpha * Lp^-1, where Mp and Lp are the pressure
+ * mass and Laplacian matrices and alpha the coefficient of the time
+ * derivative. Every inner solve is a single preconditioner application, hence
+ * the preconditioner is a fixed linear operator that can be used within GMRES.
+ */
+class GLSBlockSchurPreconditioner : public Subscriptor
+{
+public:
+  GLSBlockSchurPreconditioner(
+    const TrilinosWrappers::SparseMatrix &      system_matrix,
+    const TrilinosWrappers::PreconditionAMG &   velocity_preconditioner,
+    const TrilinosWrappers::PreconditionJacobi &pressure_mass_preconditioner,
+    const TrilinosWrappers::PreconditionAMG &pressure_laplacian_preconditioner,
+    const IndexSet &                         locally_owned_velocity_dofs,
+    const IndexSet &                         locally_owned_pressure_dofs,
+    const double                             viscosity,
+    const double                             time_derivative_coefficient);
+
+  void
+  vmult(TrilinosWrappers::MPI::Vector &      dst,
+        const TrilinosWrappers::MPI::Vector &src) const;
+
+private:
+  const TrilinosWrappers::SparseMatrix &      system_matrix;
+  const TrilinosWrappers::PreconditionAMG &   velocity_preconditioner;
+  const TrilinosWrappers::PreconditionJacobi &pressure_mass_preconditioner;
+  const TrilinosWrappers::PreconditionAMG &pressure_laplacian_preconditioner;
+  const unsigned int                       n_locally_owned_velocity_dofs;
+  const double                             viscosity;
+  const double                             time_derivative_coefficient;
+
+  // Work vectors, they are allocated once to prevent reallocation at every
+  // application of the preconditioner
+  mutable TrilinosWrappers::MPI::Vector velocity_rhs;
+  mutable TrilinosWrappers::MPI::Vector velocity_update;
+  mutable TrilinosWrappers::MPI::Vector pressure_rhs;
+  mutable TrilinosWrappers::MPI::Vector pressure_update;
+  mutable TrilinosWrappers::MPI::Vector pressure_tmp;
+  mutable TrilinosWrappers::MPI::Vector full_tmp;
+  mutable TrilinosWrappers::MPI::Vector full_product;
+};
+
 /**
  * A solver class for the Navier-Stokes equation using GLS stabilization
  *
@@ -130,12 +182,37 @@ private:
                      const double relative_residual,
                      const bool   renewed_matrix);
 
+  /**
+   * GMRES solver with a block Schur complement preconditioner
+   */
+  void
+  solve_system_block_AMG(const bool   initial_step,
+                         const double absolute_residual,
+                         const double relative_residual,
+                         const bool   renewed_matrix);
+
   /**
    * Set-up AMG preconditioner
    */
   void
   setup_AMG();
 
+  /**
+   * Set-up the block Schur complement preconditioner. The velocity block is
+   * copied out of the system matrix and the pressure operators are assembled
+   * once per distribution of the degrees of freedom.
+   */
+  void
+  setup_block_AMG();
+
+  /**
+   * Assembles the pressure mass and Laplacian matrices used to approximate
+   * the Schur complement. One pressure dof of the Laplacian is pinned since
+   * the constant pressure is in its kernel.
+   */
+  void
+  assemble_pressure_operators();
+
   /**
    * Set-up ILU preconditioner
    */
@@ -154,6 +231,25 @@ private:
   std::shared_ptr<TrilinosWrappers::PreconditionILU> ilu_preconditioner;
   std::shared_ptr<TrilinosWrappers::PreconditionAMG> amg_preconditioner;
 
+  // Block preconditioner. The velocity and pressure degrees of freedom are
+  // contiguous since the dofs are renumbered component-wise for this solver.
+  types::global_dof_index        n_velocity_dofs;
+  IndexSet                       locally_owned_velocity_dofs;
+  IndexSet                       locally_owned_pressure_dofs;
+  TrilinosWrappers::SparseMatrix velocity_matrix;
+  TrilinosWrappers::SparseMatrix pressure_mass_matrix;
+  TrilinosWrappers::SparseMatrix pressure_laplacian_matrix;
+  std::shared_ptr<TrilinosWrappers::PreconditionAMG>
+    velocity_amg_preconditioner;
+  std::shared_ptr<TrilinosWrappers::PreconditionJacobi>
+    pressure_mass_preconditioner;
+  std::shared_ptr<TrilinosWrappers::PreconditionAMG>
+    pressure_laplacian_preconditioner;
+  std::shared_ptr<GLSBlockSchurPreconditioner> block_preconditioner;
+
+  // Coefficient of the velocity mass matrix in the last assembled matrix
+  double time_derivative_coefficient = 0;
+
   const bool   SUPG        = true;
   const double GLS_u_scale = 1;
 };
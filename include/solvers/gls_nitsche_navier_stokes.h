@@ -70,6 +70,16 @@ private:
   void
   postprocess_solid_forces();
 
+  /**
+   * @brief Additional weight of the cells containing solid particles when the fluid triangulation is partitioned, proportional to the number of particles since each of them adds a quadrature point of the Nitsche restriction
+   */
+  unsigned int
+  cell_weight(
+    const typename parallel::distributed::Triangulation<spacedim>::cell_iterator
+      &cell,
+    const typename parallel::distributed::Triangulation<spacedim>::CellStatus
+      status) const override;
+
   /**
    * @brief Same has in gls_navier_stokes, but calls assemble_nitsche_restriction() when global matrix and rhs are assembled
    */
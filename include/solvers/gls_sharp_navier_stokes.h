@@ -21,8 +21,12 @@
 #define LETHE_GLSSHARPNS_H
 
 #include <core/ib_particle.h>
+#include <core/ib_particles_dem.h>
+#include <core/point_locator.h>
 #include <solvers/gls_navier_stokes.h>
 
+#include <boost/signals2/connection.hpp>
+
 using namespace dealii;
 
 /**
@@ -70,15 +74,87 @@ private:
   void
   define_particles();
 
+  /**
+   * @brief Calculates the force and the torque on the particles. In 2D, the
+   * surface is sampled by equally spaced points on the circle. In 3D, the
+   * surface is sampled by the Fibonacci lattice of the sphere, every point
+   * representing the same area. In both cases, the number of points per
+   * particle is the nb force evaluation parameter. A point is only evaluated
+   * by the process which owns the cell containing its stencil, the processes
+   * skip the points which are too far from their locally owned cells. The
+   * contributions of all the particles are summed in a single reduction.
+   */
   void
   force_on_ib();
 
+  /**
+   * @brief Returns the active cell containing a point. The cached point
+   * locator is used first, the hint being the cell which was found for the
+   * previous point along the stencil. Points which are not in a locally
+   * owned or ghost cell fall back on the search through the cell tree,
+   * which returns the artificial cell containing the point.
+   *
+   * @param point The point to locate
+   * @param hint A cell close to the point
+   */
+  typename DoFHandler<dim>::active_cell_iterator
+  locate_cell(const Point<dim> &                                    point,
+              const typename DoFHandler<dim>::active_cell_iterator &hint);
+
+  /**
+   * @brief Overwrites the rows of the system associated with the dofs of the
+   * cells cut by the particles with the sharp edge stencils. The stencils
+   * only depend on the mesh and on the particles, they are cached and only
+   * rebuilt when the triangulation changes or when a particle is moved. The
+   * right-hand side of the rows is updated with the present evaluation point
+   * at every call.
+   *
+   * A row may be written by the stencils of several cells. The cached row is
+   * the union of the entries written by these stencils, keeping the last
+   * value written in each column, which is the row the matrix held when the
+   * stencils were written directly in it. The residual of the row is computed
+   * from all these entries, whereas it was previously computed from the last
+   * stencil only.
+   *
+   * @param assemble_matrix If true, the rows of the matrix are overwritten.
+   * Otherwise, only the right-hand side is modified.
+   */
+  void
+  sharp_edge(const bool assemble_matrix);
+
+  /**
+   * @brief Builds the sharp edge stencils of the dofs of the cells cut by the
+   * particles and stores them in sharp_edge_rows.
+   */
   void
-  sharp_edge();
+  build_sharp_edge_stencils();
+
+  /**
+   * @brief Returns true if the cached sharp edge stencils are still valid,
+   * i.e. the triangulation has not changed and the particles are identical
+   * to the ones used to build the stencils.
+   */
+  bool
+  sharp_edge_stencils_are_valid() const;
 
   void
   write_force_ib();
 
+  /**
+   * @brief Writes the checkpoint of the fluid, the state of the particles
+   * and the history of their contacts
+   */
+  virtual void
+  write_checkpoint() override;
+
+  /**
+   * @brief Reads the checkpoint of the fluid, the state of the particles and
+   * the history of their contacts. The particles of the parameter file are
+   * replaced by the particles of the checkpoint.
+   */
+  virtual void
+  read_checkpoint() override;
+
 
 
   double
@@ -90,6 +166,22 @@ private:
   void
   refine_ib();
 
+  /**
+   * @brief Additional weight of the cells cut by an immersed particle when
+   * the triangulation is partitioned. These cells carry the sharp edge
+   * stencils and constraints, which are much more expensive than the
+   * assembly of a regular cell.
+   *
+   * @param cell Cell of the triangulation
+   * @param status Refinement status of the cell
+   */
+  unsigned int
+  cell_weight(
+    const typename parallel::distributed::Triangulation<dim>::cell_iterator
+      &                                                                  cell,
+    const typename parallel::distributed::Triangulation<dim>::CellStatus status)
+    const override;
+
   void
   assemble_matrix_and_rhs(
     const Parameters::SimulationControl::TimeSteppingMethod
@@ -110,6 +202,35 @@ private:
   const double                 GLS_u_scale = 1;
   std::vector<IBParticle<dim>> particles;
 
+  // Directions of the force evaluation points on the unit sphere (3D only)
+  std::vector<Tensor<1, 3>> force_evaluation_directions;
+
+  PointLocator<dim> point_locator;
+
+  // Integrator of the motion of the particles and of their collisions
+  std::shared_ptr<IBParticlesDEM<dim>> particles_dem;
+
+  /**
+   * @brief Row of the system overwritten by the sharp edge method. The
+   * right-hand side of the row is rhs_value minus the product of the entries
+   * with the evaluation point if residual is true, and rhs_value otherwise.
+   */
+  struct SharpEdgeRow
+  {
+    types::global_dof_index                                 index;
+    std::vector<std::pair<types::global_dof_index, double>> entries;
+    bool                                                    has_rhs   = false;
+    double                                                  rhs_value = 0;
+    bool                                                    residual  = false;
+  };
+
+  // Cache of the sharp edge stencils and of the particles used to build them
+  std::vector<SharpEdgeRow>    sharp_edge_rows;
+  std::vector<IBParticle<dim>> sharp_edge_particles;
+  bool                         sharp_edge_stencils_outdated;
+
+  boost::signals2::connection tria_change_connection;
+
 
   std::vector<TableHandler> table_f;
   std::vector<TableHandler> table_t;
@@ -26,12 +26,14 @@
 #define lethe_heat_transfer_h
 
 #include <deal.II/base/convergence_table.h>
+#include <deal.II/base/quadrature_lib.h>
 
 #include <deal.II/distributed/solution_transfer.h>
 #include <deal.II/distributed/tria_base.h>
 
 #include <deal.II/fe/fe_q.h>
 
+#include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/lac/trilinos_vector.h>
 
@@ -57,11 +59,16 @@ public:
     , simulation_control(p_simulation_control)
     , dof_handler(*triangulation)
     , fe(simulation_parameters.fem_parameters.temperature_order)
+    , system_matrix_is_valid(false)
+    , system_matrix_renewed(true)
     , solution_transfer(dof_handler)
     , solution_transfer_m1(dof_handler)
     , solution_transfer_m2(dof_handler)
     , solution_transfer_m3(dof_handler)
-  {}
+  {
+    // The velocity is read at the quadrature points of the assembly
+    multiphysics->request_fluid_quadrature_cache(QGauss<dim>(fe.degree + 1));
+  }
 
   /**
    * @brief Call for the assembly of the matrix and the right-hand side.
@@ -227,6 +234,11 @@ public:
   {
     return nonzero_constraints;
   }
+  virtual std::vector<const TrilinosWrappers::MPI::Vector *>
+  get_previous_solutions() override
+  {
+    return {&solution_m1, &solution_m2, &solution_m3};
+  }
 
 
 private:
@@ -235,6 +247,43 @@ private:
   assemble_system(const Parameters::SimulationControl::TimeSteppingMethod
                     time_stepping_method);
 
+  /**
+   * @brief Verifies if the system matrix can be reused. The energy equation
+   * is linear in temperature, consequently its matrix only changes with the
+   * velocity field, the time step, the time-stepping method and the mesh.
+   * The velocity field is identified by the version of the fluid solution
+   * provided by the multiphysics interface.
+   *
+   * @param time_stepping_method Time-Stepping method with which the assembly is called
+   */
+  bool
+  system_matrix_is_unchanged(
+    const Parameters::SimulationControl::TimeSteppingMethod
+      time_stepping_method);
+
+  /**
+   * @brief Stores the version of the fluid solution, the time steps and the
+   * time-stepping method with which the system matrix is assembled
+   *
+   * @param time_stepping_method Time-Stepping method with which the assembly is called
+   */
+  void
+  store_system_matrix_state(
+    const Parameters::SimulationControl::TimeSteppingMethod
+      time_stepping_method);
+
+  /**
+   * @brief Set-up ILU preconditioner
+   */
+  void
+  setup_ILU();
+
+  /**
+   * @brief Set-up AMG preconditioner
+   */
+  void
+  setup_AMG();
+
   MultiphysicsInterface<dim> *     multiphysics;
   const SimulationParameters<dim> &simulation_parameters;
 
@@ -261,6 +310,18 @@ private:
   AffineConstraints<double>      zero_constraints;
   TrilinosWrappers::SparseMatrix system_matrix;
 
+  // Preconditioners, reused as long as the system matrix is not renewed
+  std::shared_ptr<TrilinosWrappers::PreconditionILU> ilu_preconditioner;
+  std::shared_ptr<TrilinosWrappers::PreconditionAMG> amg_preconditioner;
+
+  // State with which the system matrix was last assembled. It is used to skip
+  // the assembly of the matrix and the set-up of the preconditioner when the
+  // operator is unchanged.
+  bool                                              system_matrix_is_valid;
+  bool                                              system_matrix_renewed;
+  Parameters::SimulationControl::TimeSteppingMethod matrix_time_stepping_method;
+  std::vector<double>                               matrix_time_steps;
+  unsigned int                                      matrix_fluid_version;
 
   // Past solution vectors
   TrilinosWrappers::MPI::Vector solution_m1;
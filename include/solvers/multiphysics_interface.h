@@ -24,7 +24,10 @@
 #ifndef lethe_multiphysics_interface_h
 #define lethe_multiphysics_interface_h
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/tensor.h>
 
 #include <deal.II/distributed/tria_base.h>
 
@@ -108,9 +111,9 @@ public:
                           physics_id) != active_physics.end(),
                 ExcInternalError());
 
-    physics[physics_id]->solve_non_linear_system(time_stepping_method,
-                                                 false,
-                                                 force_matrix_renewal);
+    physics[physics_id]->solve_time_step(time_stepping_method,
+                                         *simulation_control,
+                                         force_matrix_renewal);
   }
 
   /**
@@ -129,9 +132,9 @@ public:
                           physics_id) != active_physics.end(),
                 ExcInternalError());
 
-    block_physics[physics_id]->solve_non_linear_system(time_stepping_method,
-                                                       false,
-                                                       force_matrix_renewal);
+    block_physics[physics_id]->solve_time_step(time_stepping_method,
+                                               *simulation_control,
+                                               force_matrix_renewal);
   }
 
 
@@ -172,35 +175,41 @@ public:
 
   /**
    * @brief Carry out the operations required to finish a time step correctly for
-   * all auxiliary physics.
+   * all auxiliary physics. The physics that were not solved during this time
+   * step (super-cycling) keep their time vectors.
    */
   void
   finish_time_step()
   {
     for (auto &iphys : physics)
       {
-        iphys.second->finish_time_step();
+        if (iphys.second->is_solved_at_present_time_step())
+          iphys.second->finish_time_step();
       }
     for (auto &iphys : block_physics)
       {
-        iphys.second->finish_time_step();
+        if (iphys.second->is_solved_at_present_time_step())
+          iphys.second->finish_time_step();
       }
   }
 
   /**
    * @brief Carry out the operations required to percolate the time vectors
-   * correctly at the end of a simulation
+   * correctly at the end of a simulation. The physics with their own time step
+   * manage their time vectors themselves.
    */
   void
   percolate_time_vectors()
   {
     for (auto &iphys : physics)
       {
-        iphys.second->percolate_time_vectors();
+        if (!iphys.second->has_own_time_step())
+          iphys.second->percolate_time_vectors();
       }
     for (auto &iphys : block_physics)
       {
-        iphys.second->percolate_time_vectors();
+        if (!iphys.second->has_own_time_step())
+          iphys.second->percolate_time_vectors();
       }
   }
 
@@ -265,13 +274,18 @@ public:
   void
   setup_dofs()
   {
+    // The cached fluid values refer to the previous cells
+    fluid_quadrature_cache_valid = false;
+
     for (auto &iphys : physics)
       {
         iphys.second->setup_dofs();
+        iphys.second->initialize_time_stepping(*simulation_control);
       }
     for (auto &iphys : block_physics)
       {
         iphys.second->setup_dofs();
+        iphys.second->initialize_time_stepping(*simulation_control);
       }
   };
 
@@ -436,6 +450,105 @@ public:
   }
 
 
+  /**
+   * @brief Signals that the fluid dynamics solution has been updated. This is
+   * called by the fluid dynamics solver every time it solves a time step,
+   * before the auxiliary physics are solved. The cache of the fluid velocity
+   * is refilled by the first auxiliary physics which needs it, hence it is not
+   * evaluated at the time steps where no auxiliary physics is solved.
+   */
+  void
+  notify_fluid_solution_update()
+  {
+    ++fluid_solution_version;
+    fluid_quadrature_cache_valid = false;
+  }
+
+  /**
+   * @brief Request the number of updates of the fluid dynamics solution. The
+   * auxiliary physics compare it with the value of their last assembly to know
+   * if the velocity field has changed. The value is the same on all the
+   * processors.
+   */
+  unsigned int
+  get_fluid_solution_version() const
+  {
+    return fluid_solution_version;
+  }
+
+  /**
+   * @brief Requests the cache of the fluid velocity and velocity gradient at
+   * the quadrature points of the locally owned cells. This is called by the
+   * auxiliary physics that are coupled to the velocity field. All of them must
+   * use the same quadrature, i.e. the same points and weights.
+   *
+   * @param quadrature The quadrature used by the assembly of the auxiliary physics
+   */
+  void
+  request_fluid_quadrature_cache(const Quadrature<dim> &quadrature)
+  {
+    AssertThrow(!fluid_quadrature_cache_requested ||
+                  (fluid_quadrature.get_points() == quadrature.get_points() &&
+                   fluid_quadrature.get_weights() == quadrature.get_weights()),
+                ExcMessage("The auxiliary physics coupled to the velocity "
+                           "field must use the same quadrature"));
+    fluid_quadrature                 = quadrature;
+    fluid_quadrature_cache_requested = true;
+  }
+
+  /**
+   * @brief Evaluates the velocity and the velocity gradient of the fluid
+   * dynamics solution at the quadrature points of the locally owned cells.
+   * This is done by the first assembly of an auxiliary physics after the fluid
+   * dynamics is solved, the auxiliary physics then read the values during
+   * their assembly instead of evaluating the fluid solution on every cell
+   * again.
+   */
+  void
+  update_fluid_quadrature_cache();
+
+  /**
+   * @brief Verify if the cache of the fluid velocity has been filled on the
+   * present mesh
+   */
+  bool
+  fluid_quadrature_cache_is_valid() const
+  {
+    return fluid_quadrature_cache_valid;
+  }
+
+  /**
+   * @brief Request the cached fluid velocity at the quadrature points of a
+   * locally owned cell
+   *
+   * @param cell_index Active cell index of the cell
+   */
+  ArrayView<const Tensor<1, dim>>
+  get_cached_fluid_velocity_values(const unsigned int cell_index) const
+  {
+    Assert(fluid_quadrature_cache_valid, ExcInternalError());
+    return ArrayView<const Tensor<1, dim>>(
+      cached_fluid_velocity_values.data() +
+        cell_index * fluid_quadrature.size(),
+      fluid_quadrature.size());
+  }
+
+  /**
+   * @brief Request the cached fluid velocity gradient at the quadrature points
+   * of a locally owned cell
+   *
+   * @param cell_index Active cell index of the cell
+   */
+  ArrayView<const Tensor<2, dim>>
+  get_cached_fluid_velocity_gradients(const unsigned int cell_index) const
+  {
+    Assert(fluid_quadrature_cache_valid, ExcInternalError());
+    return ArrayView<const Tensor<2, dim>>(
+      cached_fluid_velocity_gradients.data() +
+        cell_index * fluid_quadrature.size(),
+      fluid_quadrature.size());
+  }
+
   /**
    * @brief Prepares auxiliary physics to write simulation checkpoint
    */
@@ -450,6 +563,7 @@ public:
       {
         iphys.second->write_checkpoint();
       }
+    write_time_stepping_checkpoint();
   };
 
   /**
@@ -467,13 +581,36 @@ public:
       {
         iphys.second->read_checkpoint();
       }
+    read_time_stepping_checkpoint();
   };
 
 
 
 private:
+  /**
+   * @brief Writes the time-stepping state of the auxiliary physics, which
+   * is identical on all the processes, in the restart file of the multiphysics
+   */
+  void
+  write_time_stepping_checkpoint();
+
+  /**
+   * @brief Reads the time-stepping state of the auxiliary physics from the
+   * restart file of the multiphysics
+   */
+  void
+  read_time_stepping_checkpoint();
+
   const Parameters::Multiphysics multiphysics_parameters;
 
+  // Prefix of the restart files and communicator of the triangulation
+  const std::string restart_prefix;
+  MPI_Comm          mpi_communicator;
+
+  // Simulation control of the fluid dynamics, which drives the time-stepping
+  // of the auxiliary physics
+  std::shared_ptr<SimulationControl> simulation_control;
+
   // Data structure to store all physics which were enabled
   std::vector<PhysicsID> active_physics;
 
@@ -494,6 +631,17 @@ private:
   std::map<PhysicsID, TrilinosWrappers::MPI::Vector *> physics_solutions;
   std::map<PhysicsID, TrilinosWrappers::MPI::BlockVector *>
     block_physics_solutions;
+
+  // Number of updates of the fluid dynamics solution
+  unsigned int fluid_solution_version = 0;
+
+  // Fluid velocity and velocity gradient at the quadrature points of the
+  // locally owned cells, stored contiguously by active cell index
+  bool                        fluid_quadrature_cache_requested = false;
+  bool                        fluid_quadrature_cache_valid     = false;
+  Quadrature<dim>             fluid_quadrature;
+  std::vector<Tensor<1, dim>> cached_fluid_velocity_values;
+  std::vector<Tensor<2, dim>> cached_fluid_velocity_gradients;
 };
 
 
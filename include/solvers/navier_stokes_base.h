@@ -86,6 +86,7 @@
 // Distributed
 #include <deal.II/distributed/grid_refinement.h>
 #include <deal.II/distributed/solution_transfer.h>
+#include <deal.II/distributed/tria.h>
 
 
 // Lethe Includes
@@ -107,6 +108,7 @@
 
 // Std
 #include <fstream>
+#include <functional>
 #include <iostream>
 
 using namespace dealii;
@@ -174,6 +176,16 @@ protected:
   {
     return nonzero_constraints;
   };
+  virtual std::vector<const VectorType *>
+  get_previous_solutions() override
+  {
+    return {&solution_m1, &solution_m2, &solution_m3};
+  };
+  virtual std::vector<double>
+  get_time_steps_vector() const override
+  {
+    return simulation_control->get_time_steps_vector();
+  };
 
   /**
    *  Generic interface routine to allow the CFD solver
@@ -241,6 +253,10 @@ protected:
   setup_dofs()
   {
     setup_dofs_fd();
+    boundary_faces = find_locally_owned_boundary_faces(this->dof_handler);
+
+    // The CFL of the last assembly refers to the previous dofs
+    assembly_diagnostics_available = false;
     multiphysics->setup_dofs();
   };
 
@@ -313,6 +329,22 @@ protected:
   virtual void
   setup_dofs_fd() = 0;
 
+  /**
+   * @brief define_non_zero_constraints
+   * Defines the hanging node constraints and the constraints of the velocity
+   * boundary conditions, with the values imposed on the boundaries
+   */
+  void
+  define_non_zero_constraints();
+
+  /**
+   * @brief define_zero_constraints
+   * Defines the same constraints as define_non_zero_constraints, but with
+   * homogeneous values. They are applied to the Newton update.
+   */
+  void
+  define_zero_constraints();
+
   virtual void
   set_initial_condition_fd(
     Parameters::InitialConditionType initial_condition_type,
@@ -373,6 +405,22 @@ protected:
   virtual void
   first_iteration();
 
+  /**
+   * @brief estimate_time_step_error
+   * Estimates the local truncation error of the present bdf time step by
+   * comparing the velocity with the extrapolation of the previous solutions
+   * (Milne's device). The pressure is excluded from the estimate. The
+   * estimate, relative to the error tolerance, is provided to the simulation
+   * control. Returns zero if the estimate is not available (not a bdf scheme
+   * or not enough previous solutions).
+   *
+   * @param time_stepping_method Time-Stepping method of the non-linear system
+   */
+  double
+  estimate_time_step_error(
+    const Parameters::SimulationControl::TimeSteppingMethod
+      time_stepping_method);
+
   void
   refine_mesh();
 
@@ -382,6 +430,50 @@ protected:
   void
   refine_mesh_uniform();
 
+  /**
+   * @brief repartition_mesh
+   * Repartitions the triangulation between the processors using the cell
+   * weights and transfers the solutions to the new partition. This is used to
+   * follow the motion of the immersed particles.
+   */
+  void
+  repartition_mesh();
+
+  /**
+   * @brief transfer_solutions_across_mesh_change
+   * Transfers the present and the previous solutions, as well as the
+   * solutions of the auxiliary physics, across a change of the triangulation
+   * (refinement, coarsening or repartitioning). The dofs are set up again
+   * after the change.
+   *
+   * @param change_mesh Function which carries out the change of the
+   * triangulation
+   */
+  void
+  transfer_solutions_across_mesh_change(
+    const std::function<void()> &change_mesh);
+
+  /**
+   * @brief cell_weight
+   * Additional computational weight of a cell used when the triangulation is
+   * partitioned, on top of the weight of 1000 of every cell. The function is
+   * connected to the cell_weight signal of the triangulation when the
+   * weighted repartitioning is enabled. Solvers with additional work on some
+   * cells (immersed boundaries) override this function.
+   *
+   * @param cell Cell of the triangulation
+   * @param status Refinement status of the cell
+   */
+  virtual unsigned int
+  cell_weight(
+    const typename parallel::distributed::Triangulation<dim>::cell_iterator
+      & /*cell*/,
+    const typename parallel::distributed::Triangulation<dim>::CellStatus
+    /*status*/) const
+  {
+    return 0;
+  }
+
   /**
    * @brief read_checkpoint
    */
@@ -490,6 +582,16 @@ protected:
   // Convergence Analysis
   ConvergenceTable error_table;
 
+  // Maximal CFL over the locally owned cells, accumulated by the assembly of
+  // the last non-linear iteration. The flag is only set by the solvers whose
+  // assembly calculates the CFL and it is reset when the dofs change.
+  double assembly_max_CFL;
+  bool   assembly_diagnostics_available;
+
+  // Locally owned boundary faces of each boundary id, updated at each mesh
+  // change and used by the boundary integrals
+  BoundaryFacesList<dim> boundary_faces;
+
   // Force analysis
   std::vector<Tensor<1, dim>> forces_on_boundaries;
   std::vector<Tensor<1, 3>>   torques_on_boundaries;
@@ -63,6 +63,7 @@ namespace Parameters
 
     // Particle motion integration parameters
     unsigned int particles_sub_iterations;
+    bool         incremental_relocation;
   };
 
   template <int dim>
@@ -108,6 +109,13 @@ namespace Parameters
         Patterns::Integer(),
         "Number of sub iterations for the motion of the particles. This parameter"
         "enables the uses of a higher CFL condition for the Nitsche solver while preventing the loss of particles");
+      prm.declare_entry(
+        "incremental particles relocation",
+        "false",
+        Patterns::Bool(),
+        "Relocate the particles in their previous cell after each sub "
+        "iteration and only sort the particles into the cells of the fluid "
+        "triangulation when at least one of them has left its cell");
     }
     prm.leave_subsection();
   }
@@ -132,6 +140,8 @@ namespace Parameters
       calculate_force_on_solid = prm.get_bool("calculate forces on solid");
       force_output_name        = prm.get("solid force name");
       particles_sub_iterations = prm.get_integer("particles sub iterations");
+      incremental_relocation =
+        prm.get_bool("incremental particles relocation");
     }
     prm.leave_subsection();
   }
@@ -43,6 +43,32 @@
 #  include <core/boundary_conditions.h>
 #  include <core/parameters.h>
 
+#  include <map>
+#  include <vector>
+
+
+/**
+ * @brief Locally owned boundary faces of the triangulation, grouped by boundary
+ * id. Each face is stored as a (cell, face number) pair. This list is built once
+ * per mesh change and is used by the boundary integrals (forces, torques and
+ * flow rate), which then only visit the boundary faces instead of the whole
+ * mesh.
+ */
+template <int dim>
+using BoundaryFacesList = std::map<
+  types::boundary_id,
+  std::vector<
+    std::pair<typename DoFHandler<dim>::active_cell_iterator, unsigned int>>>;
+
+/**
+ * @brief Finds the locally owned boundary faces of each boundary id
+ * @return The list of the (cell, face number) pairs of each boundary id
+ *
+ * @param dof_handler The dof_handler of the simulation
+ */
+template <int dim>
+BoundaryFacesList<dim>
+find_locally_owned_boundary_faces(const DoFHandler<dim> &dof_handler);
 
 /**
  * @brief Calculate the CFL condition on the simulation domain
@@ -117,18 +143,22 @@ calculate_kinetic_energy(const DoFHandler<dim> &dof_handler,
  *
  * @param dof_handler The dof_handler used for the calculation
  *
+ * @param boundary_faces The locally owned boundary faces of each boundary id
+ *
  * @param evaluation_point The solution at which the force is calculated
  *
  * @param physical_properties The parameters containing the required physical properties
  *
  * @param boundary_conditions The boundary conditions object
  *
- * @param mpi_communicator The mpi communicator. It is used to reduce the force calculation
+ * @param mpi_communicator The mpi communicator. It is used to reduce the force
+ * calculation, the forces on all the boundaries are reduced at once
  */
 template <int dim, typename VectorType>
 std::vector<Tensor<1, dim>>
 calculate_forces(
   const DoFHandler<dim> &                              dof_handler,
+  const BoundaryFacesList<dim> &                       boundary_faces,
   const VectorType &                                   evaluation_point,
   const Parameters::PhysicalProperties &               physical_properties,
   const BoundaryConditions::NSBoundaryConditions<dim> &boundary_conditions,
@@ -145,6 +175,8 @@ calculate_forces(
  *
  * @param dof_handler The dof_handler used for the calculation.
  *
+ * @param boundary_faces The locally owned boundary faces of each boundary id.
+ *
  * @param evaluation_point The solution at which the torque is calculated.
  *
  * @param physical_properties The parameters containing the required physical properties.
@@ -153,12 +185,14 @@ calculate_forces(
  *
  * @param boundary_conditions The boundary conditions object.
  *
- * @param mpi_communicator The mpi communicator. It is used to reduce the torque calculation.
+ * @param mpi_communicator The mpi communicator. It is used to reduce the
+ * torque calculation, the torques on all the boundaries are reduced at once.
  */
 template <int dim, typename VectorType>
 std::vector<Tensor<1, 3>>
 calculate_torques(
   const DoFHandler<dim> &                              dof_handler,
+  const BoundaryFacesList<dim> &                       boundary_faces,
   const VectorType &                                   evaluation_point,
   const Parameters::PhysicalProperties &               physical_properties,
   const Parameters::FEM &                              fem_parameters,
@@ -202,6 +236,8 @@ calculate_L2_error(const DoFHandler<dim> &dof_handler,
  *
  * @param dof_handler. The argument used to get finite elements
  *
+ * @param boundary_faces. The locally owned boundary faces of each boundary id
+ *
  * @param present_solution. The vector which contains all the values to
  *                          calculate the flow rate
  *
@@ -213,11 +249,12 @@ calculate_L2_error(const DoFHandler<dim> &dof_handler,
  */
 template <int dim, typename VectorType>
 std::pair<double, double>
-calculate_flow_rate(const DoFHandler<dim> &dof_handler,
-                    const VectorType &     present_solution,
-                    const unsigned int &   boundary_id,
-                    const Parameters::FEM &fem_parameters,
-                    const MPI_Comm &       mpi_communicator);
+calculate_flow_rate(const DoFHandler<dim> &       dof_handler,
+                    const BoundaryFacesList<dim> &boundary_faces,
+                    const VectorType &            present_solution,
+                    const unsigned int &          boundary_id,
+                    const Parameters::FEM &       fem_parameters,
+                    const MPI_Comm &              mpi_communicator);
 
 
 
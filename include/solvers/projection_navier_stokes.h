@@ -0,0 +1,238 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2020 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+
+ *
+ * Author: Bruno Blais, Polytechnique Montreal, 2020-
+ */
+
+#ifndef lethe_projection_navier_stokes_h
+#define lethe_projection_navier_stokes_h
+
+#include "navier_stokes_base.h"
+
+using namespace dealii;
+
+/**
+ * A solver class for the transient Navier-Stokes equations using an
+ * incremental pressure-correction (projection) scheme in standard form.
+ * Every time step is split in three linear problems which are solved
+ * separately:
+ *
+ * 1. The velocity u* is obtained from the momentum equations in which the
+ *    pressure of the previous time step is explicit and the convective
+ *    velocity is extrapolated from the previous time steps. This non-symmetric
+ *    problem is stabilized with SUPG and solved with GMRES and AMG. The
+ *    viscous term is dropped from the strong residual of the SUPG
+ *    stabilization, which is therefore only consistent for linear elements.
+ *
+ * 2. The pressure increment phi is the solution of the Poisson problem
+ *    (grad phi, grad q) = -alpha_0 (div u*, q), where alpha_0 is the first
+ *    coefficient of the BDF scheme. The pressure Laplacian is assembled and
+ *    its AMG preconditioner is built once per distribution of the degrees of
+ *    freedom. The pressure is then updated as p = p + phi.
+ *
+ * 3. The velocity is corrected as u = u* - grad phi / alpha_0, which makes it
+ *    divergence-free. The correction is the L2 projection of the gradient of
+ *    the pressure increment onto the velocity space, with homogeneous
+ *    boundary conditions. The velocity mass matrix is also assembled once per
+ *    distribution of the degrees of freedom.
+ *
+ * The corrected velocity and the updated pressure are the solution of the
+ * time step. They are the previous solutions used by the BDF scheme and the
+ * explicit pressure of the momentum equations at the next time step.
+ *
+ * The velocity and the pressure are stored in the monolithic solution vector
+ * of NavierStokesBase, hence the boundary conditions, the BDF coefficients,
+ * the post-processing, the checkpointing and the mesh adaptation are shared
+ * with the other solvers. The degrees of freedom are renumbered
+ * component-wise so that the velocity and the pressure form two contiguous
+ * blocks. The pressure increment satisfies homogeneous Dirichlet boundary
+ * conditions on the boundaries without boundary condition (outlets). If there
+ * is no such boundary, a pressure degree of freedom is fixed.
+ *
+ * Only the BDF time-stepping methods are supported. The order of the BDF
+ * scheme is reduced as long as not enough previous solutions are available.
+ *
+ * @tparam dim An integer that denotes the dimension of the space in which
+ * the flow is solved
+ *
+ * @ingroup solvers
+ */
+
+template <int dim>
+class ProjectionNavierStokesSolver
+  : public NavierStokesBase<dim, TrilinosWrappers::MPI::Vector, IndexSet>
+{
+public:
+  ProjectionNavierStokesSolver(SimulationParameters<dim> &nsparam);
+  ~ProjectionNavierStokesSolver();
+
+  /**
+   * @brief solve
+   * Solves the problem. This function duplicates the time loop of the
+   * NavierStokesBase solvers (e.g. GLSNavierStokesSolver::solve), with an
+   * additional check of the time-stepping method. Changes to that time loop
+   * must also be made here.
+   */
+  virtual void
+  solve();
+
+protected:
+  virtual void
+  setup_dofs_fd() override;
+
+  virtual void
+  set_initial_condition_fd(
+    Parameters::InitialConditionType initial_condition_type,
+    bool                             restart = false) override;
+
+  /**
+   * @brief iterate
+   * Solves the velocity and the pressure-correction problems of a time step
+   */
+  virtual void
+  iterate() override;
+
+  /**
+   * @brief first_iteration
+   * The projection scheme does not require a startup procedure, the order of
+   * the BDF scheme is reduced for the first time steps instead
+   */
+  virtual void
+  first_iteration() override;
+
+  /**
+   * The projection scheme does not use the non-linear solver, these functions
+   * must not be called
+   */
+  virtual void
+  assemble_matrix_and_rhs(
+    const Parameters::SimulationControl::TimeSteppingMethod
+      time_stepping_method) override;
+
+  virtual void
+  assemble_rhs(const Parameters::SimulationControl::TimeSteppingMethod
+                 time_stepping_method) override;
+
+  virtual void
+  solve_linear_system(const bool initial_step,
+                      const bool renewed_matrix = true) override;
+
+private:
+  /**
+   * @brief Assembles the velocity system of the time step. The SUPG
+   * stabilization neglects the viscous term of the strong residual.
+   *
+   * @param order Order of the BDF scheme used for the time step
+   */
+  void
+  assemble_velocity_system(const unsigned int order);
+
+  /**
+   * @brief Assembles the pressure Laplacian and builds its AMG
+   * preconditioner. The matrix only depends on the mesh.
+   */
+  void
+  assemble_pressure_laplacian();
+
+  /**
+   * @brief Assembles the right-hand side of the pressure-correction problem
+   * from the divergence of the velocity of the present solution
+   *
+   * @param order Order of the BDF scheme used for the time step
+   */
+  void
+  assemble_pressure_rhs(const unsigned int order);
+
+  /**
+   * @brief Assembles the velocity mass matrix of the velocity correction and
+   * builds its preconditioner. The matrix only depends on the mesh.
+   */
+  void
+  assemble_velocity_mass_matrix();
+
+  /**
+   * @brief Assembles the right-hand side of the velocity correction from the
+   * gradient of the pressure increment
+   *
+   * @param order Order of the BDF scheme used for the time step
+   */
+  void
+  assemble_velocity_correction_rhs(const unsigned int order);
+
+  /**
+   * @brief Builds the AMG preconditioner of the velocity system and solves
+   * it with GMRES
+   */
+  void
+  solve_velocity_system();
+
+  /**
+   * @brief Solves the pressure-correction problem with CG
+   */
+  void
+  solve_pressure_system();
+
+  /**
+   * @brief Solves the velocity correction with CG
+   */
+  void
+  solve_velocity_correction();
+
+  // The velocity and the pressure dofs are contiguous since the dofs are
+  // renumbered component-wise
+  types::global_dof_index n_velocity_dofs;
+  IndexSet                locally_owned_velocity_dofs;
+  IndexSet                locally_relevant_velocity_dofs;
+  IndexSet                locally_owned_pressure_dofs;
+  IndexSet                locally_relevant_pressure_dofs;
+
+  // Local indices of the velocity and the pressure shape functions of a cell
+  std::vector<unsigned int> velocity_shape_functions;
+  std::vector<unsigned int> pressure_shape_functions;
+
+  // Constraints of the velocity, the velocity correction and the pressure
+  // increment, numbered within their block
+  AffineConstraints<double> velocity_constraints;
+  AffineConstraints<double> velocity_correction_constraints;
+  AffineConstraints<double> pressure_constraints;
+
+  // Constant modes of the locally owned velocity dofs, used by the AMG
+  // preconditioner of the velocity system
+  std::vector<std::vector<bool>> velocity_constant_modes;
+
+  TrilinosWrappers::SparseMatrix velocity_matrix;
+  TrilinosWrappers::SparseMatrix velocity_mass_matrix;
+  TrilinosWrappers::SparseMatrix pressure_laplacian_matrix;
+
+  TrilinosWrappers::MPI::Vector velocity_rhs;
+  TrilinosWrappers::MPI::Vector velocity_solution;
+  TrilinosWrappers::MPI::Vector velocity_correction_rhs;
+  TrilinosWrappers::MPI::Vector velocity_correction;
+  TrilinosWrappers::MPI::Vector pressure_rhs;
+  TrilinosWrappers::MPI::Vector pressure_increment;
+
+  std::shared_ptr<TrilinosWrappers::PreconditionAMG>
+    velocity_amg_preconditioner;
+  std::shared_ptr<TrilinosWrappers::PreconditionJacobi>
+    velocity_mass_preconditioner;
+  std::shared_ptr<TrilinosWrappers::PreconditionAMG>
+    pressure_amg_preconditioner;
+
+  const double SUPG_u_scale = 1;
+};
+
+
+#endif
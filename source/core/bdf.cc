@@ -73,3 +73,30 @@ bdf_coefficients(unsigned int p, const std::vector<double> dt)
     }
   return alpha;
 }
+
+Vector<double>
+extrapolation_coefficients(unsigned int p, const std::vector<double> dt)
+{
+  // There should be at least p+1 time steps
+  assert(dt.size() >= p + 1);
+
+  // Times of the previous solutions relative to the extrapolation time
+  Vector<double> times(p + 1);
+  for (unsigned int i = 0; i < p + 1; ++i)
+    {
+      times[i] = 0.;
+      for (unsigned int j = 0; j < i + 1; ++j)
+        times[i] -= dt[j];
+    }
+
+  // Value of the Lagrange polynomials at the extrapolation time
+  Vector<double> beta(p + 1);
+  for (unsigned int i = 0; i < p + 1; ++i)
+    {
+      beta[i] = 1.;
+      for (unsigned int j = 0; j < p + 1; ++j)
+        if (j != i)
+          beta[i] *= -times[j] / (times[i] - times[j]);
+    }
+  return beta;
+}
@@ -0,0 +1,460 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#include <deal.II/base/geometry_info.h>
+
+#include <core/ib_particles_dem.h>
+
+#include <dem/hertz_mindlin_contact_model.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+namespace
+{
+  template <int dim>
+  Tensor<1, 3>
+  to_3d(const Tensor<1, dim> &tensor)
+  {
+    Tensor<1, 3> tensor_3d;
+    for (unsigned int d = 0; d < dim; ++d)
+      tensor_3d[d] = tensor[d];
+    return tensor_3d;
+  }
+
+  template <int dim>
+  Tensor<1, dim>
+  from_3d(const Tensor<1, 3> &tensor_3d)
+  {
+    Tensor<1, dim> tensor;
+    for (unsigned int d = 0; d < dim; ++d)
+      tensor[d] = tensor_3d[d];
+    return tensor;
+  }
+} // namespace
+
+template <int dim>
+IBParticlesDEM<dim>::IBParticlesDEM(
+  const Parameters::IBParticles<dim> &parameters,
+  const double                        fluid_density)
+  : parameters(parameters)
+  , fluid_density(fluid_density)
+{
+  // The effective properties are obtained as in the DEM solver
+  const double E_p  = parameters.youngs_modulus;
+  const double nu_p = parameters.poisson_ratio;
+  const double e_p  = parameters.restitution_coefficient;
+  const double mu_p = parameters.friction_coefficient;
+  const double E_w  = parameters.wall_youngs_modulus;
+  const double nu_w = parameters.wall_poisson_ratio;
+  const double e_w  = parameters.wall_restitution_coefficient;
+  const double mu_w = parameters.wall_friction_coefficient;
+  const double e_pw = 2 * e_p * e_w / (e_p + e_w);
+
+  pp_youngs_modulus =
+    (E_p * E_p) / (E_p * (1 - nu_p * nu_p) + E_p * (1 - nu_p * nu_p));
+  pp_shear_modulus =
+    (E_p * E_p) /
+    (2 * (E_p * (2 - nu_p) * (1 + nu_p) + E_p * (2 - nu_p) * (1 + nu_p)));
+  pp_beta                 = DEM::calculate_model_parameter_beta(e_p);
+  pp_friction_coefficient = mu_p;
+
+  pw_youngs_modulus =
+    (E_p * E_w) / (E_w * (1 - nu_p * nu_p) + E_p * (1 - nu_w * nu_w));
+  pw_shear_modulus =
+    (E_p * E_w) /
+    (2 * E_w * (2 - nu_p) * (1 + nu_p) + 2 * E_p * (2 - nu_w) * (1 + nu_w));
+  pw_beta                 = DEM::calculate_model_parameter_beta(e_pw);
+  pw_friction_coefficient = 2 * mu_p * mu_w / (mu_p + mu_w + DBL_MIN);
+}
+
+template <int dim>
+void
+IBParticlesDEM<dim>::update_walls(const Triangulation<dim> &triangulation)
+{
+  // The coarse cells are stored by every process, the walls are thus
+  // identical on all the processes
+  walls.clear();
+  for (const auto &cell : triangulation.cell_iterators_on_level(0))
+    for (unsigned int f = 0; f < GeometryInfo<dim>::faces_per_cell; ++f)
+      {
+        if (!cell->face(f)->at_boundary())
+          continue;
+
+        Wall wall;
+        wall.point = cell->face(f)->center();
+
+        // Outward normal of the face, obtained from the vertices of the face
+        // and the center of the cell
+        const Point<dim> v0 = cell->face(f)->vertex(0);
+        const Point<dim> v1 = cell->face(f)->vertex(1);
+        if (dim == 2)
+          {
+            wall.normal[0] = v1[1] - v0[1];
+            wall.normal[1] = v0[0] - v1[0];
+          }
+        else
+          {
+            const Point<dim> v2 = cell->face(f)->vertex(2);
+            wall.normal =
+              from_3d<dim>(cross_product_3d(to_3d<dim>(v1 - v0),
+                                            to_3d<dim>(v2 - v0)));
+          }
+        wall.normal /= wall.normal.norm();
+        if ((wall.point - cell->center()) * wall.normal < 0)
+          wall.normal *= -1;
+
+        wall.box_min = v0;
+        wall.box_max = v0;
+        for (unsigned int v = 1; v < GeometryInfo<dim>::vertices_per_face; ++v)
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              wall.box_min[d] =
+                std::min(wall.box_min[d], cell->face(f)->vertex(v)[d]);
+              wall.box_max[d] =
+                std::max(wall.box_max[d], cell->face(f)->vertex(v)[d]);
+            }
+
+        walls.push_back(wall);
+      }
+
+  pw_tangential_overlaps.clear();
+}
+
+template <int dim>
+void
+IBParticlesDEM<dim>::calculate_contact_force(
+  const double          normal_overlap,
+  const Tensor<1, dim> &normal_unit_vector,
+  const Tensor<1, dim> &relative_velocity,
+  const double          effective_radius,
+  const double          effective_mass,
+  const double          youngs_modulus,
+  const double          shear_modulus,
+  const double          beta,
+  const double          friction_coefficient,
+  const double          dt,
+  Tensor<1, dim> &      tangential_overlap,
+  Tensor<1, dim> &      force) const
+{
+  // The constants of the contact are those of the DEM solver
+  const DEM::HertzMindlinCoefficients coefficients =
+    DEM::calculate_hertz_mindlin_coefficients(normal_overlap,
+                                              effective_radius,
+                                              effective_mass,
+                                              youngs_modulus,
+                                              shear_modulus,
+                                              beta);
+
+  // The normal relative velocity is positive when the bodies approach each
+  // other
+  const double normal_relative_velocity =
+    relative_velocity * normal_unit_vector;
+  const Tensor<1, dim> tangential_relative_velocity =
+    relative_velocity - normal_relative_velocity * normal_unit_vector;
+
+  const Tensor<1, dim> normal_force =
+    -(coefficients.normal_spring_constant * normal_overlap +
+      coefficients.normal_damping_constant * normal_relative_velocity) *
+    normal_unit_vector;
+
+  // The tangential overlap is kept in the tangent plane of the contact
+  tangential_overlap += tangential_relative_velocity * dt;
+  tangential_overlap -=
+    (tangential_overlap * normal_unit_vector) * normal_unit_vector;
+
+  const Tensor<1, dim> dashpot_tangential_force =
+    -coefficients.tangential_damping_constant * tangential_relative_velocity;
+  Tensor<1, dim> tangential_force =
+    -coefficients.tangential_spring_constant * tangential_overlap +
+    dashpot_tangential_force;
+
+  // Gross sliding, the tangential force is limited by the Coulomb criterion
+  const double coulomb_threshold = friction_coefficient * normal_force.norm();
+  if (tangential_force.norm() > coulomb_threshold)
+    {
+      tangential_force =
+        coulomb_threshold * tangential_force / tangential_force.norm();
+      tangential_overlap =
+        -(tangential_force - dashpot_tangential_force) /
+        coefficients.tangential_spring_constant;
+    }
+
+  force = normal_force + tangential_force;
+}
+
+template <int dim>
+void
+IBParticlesDEM<dim>::calculate_contact_forces(
+  const std::vector<IBParticle<dim>> &particles,
+  const double                        dt,
+  std::vector<Tensor<1, dim>> &       forces,
+  std::vector<Tensor<1, 3>> &         torques)
+{
+  for (unsigned int p = 0; p < particles.size(); ++p)
+    {
+      forces[p]  = 0;
+      torques[p] = 0;
+    }
+
+  // Particle-particle contacts. The number of immersed particles is small,
+  // all the pairs are tested.
+  for (unsigned int i = 0; i < particles.size(); ++i)
+    for (unsigned int j = i + 1; j < particles.size(); ++j)
+      {
+        const auto           contact_id = std::make_pair(i, j);
+        const Tensor<1, dim> distance =
+          particles[j].position - particles[i].position;
+        const double normal_overlap =
+          particles[i].radius + particles[j].radius - distance.norm();
+
+        if (normal_overlap <= 0)
+          {
+            pp_tangential_overlaps.erase(contact_id);
+            continue;
+          }
+
+        const Tensor<1, dim> normal_unit_vector = distance / distance.norm();
+
+        // Velocity of particle i relative to particle j at the contact point
+        const Tensor<1, dim> relative_velocity =
+          particles[i].velocity - particles[j].velocity +
+          from_3d<dim>(cross_product_3d(
+            particles[i].radius * particles[i].omega +
+              particles[j].radius * particles[j].omega,
+            to_3d<dim>(normal_unit_vector)));
+
+        const double mass_i = particles[i].density *
+                              (dim == 3 ? 4. / 3. : 1.) * numbers::PI *
+                              std::pow(particles[i].radius, dim);
+        const double mass_j = particles[j].density *
+                              (dim == 3 ? 4. / 3. : 1.) * numbers::PI *
+                              std::pow(particles[j].radius, dim);
+
+        Tensor<1, dim> force;
+        calculate_contact_force(
+          normal_overlap,
+          normal_unit_vector,
+          relative_velocity,
+          particles[i].radius * particles[j].radius /
+            (particles[i].radius + particles[j].radius),
+          mass_i * mass_j / (mass_i + mass_j),
+          pp_youngs_modulus,
+          pp_shear_modulus,
+          pp_beta,
+          pp_friction_coefficient,
+          dt,
+          pp_tangential_overlaps[contact_id],
+          force);
+
+        // Only the tangential part of the force produces a torque
+        const Tensor<1, 3> torque_arm = to_3d<dim>(normal_unit_vector);
+        forces[i] += force;
+        forces[j] -= force;
+        torques[i] +=
+          particles[i].radius * cross_product_3d(torque_arm, to_3d<dim>(force));
+        torques[j] +=
+          particles[j].radius * cross_product_3d(torque_arm, to_3d<dim>(force));
+      }
+
+  // Particle-wall contacts. The coplanar faces of the coarse mesh form a
+  // single wall, only one contact is kept for each of them.
+  for (unsigned int p = 0; p < particles.size(); ++p)
+    {
+      std::vector<Tensor<1, dim>> contact_normals;
+      for (unsigned int w = 0; w < walls.size(); ++w)
+        {
+          const auto   contact_id = std::make_pair(p, w);
+          const Wall & wall       = walls[w];
+          const double distance =
+            (particles[p].position - wall.point) * wall.normal;
+          const double normal_overlap = particles[p].radius + distance;
+
+          // The projection of the center of the particle must lie on the face
+          const Point<dim> projection =
+            particles[p].position - distance * wall.normal;
+          const double tolerance =
+            1e-6 * (wall.box_max - wall.box_min).norm();
+          bool on_face = true;
+          for (unsigned int d = 0; d < dim; ++d)
+            if (projection[d] < wall.box_min[d] - tolerance ||
+                projection[d] > wall.box_max[d] + tolerance)
+              on_face = false;
+
+          bool duplicate = false;
+          for (const auto &normal : contact_normals)
+            if (normal * wall.normal > 1 - 1e-10)
+              duplicate = true;
+
+          if (normal_overlap <= 0 || distance > 0 || !on_face || duplicate)
+            {
+              pw_tangential_overlaps.erase(contact_id);
+              continue;
+            }
+          contact_normals.push_back(wall.normal);
+
+          const Tensor<1, dim> relative_velocity =
+            particles[p].velocity +
+            from_3d<dim>(cross_product_3d(particles[p].radius *
+                                            particles[p].omega,
+                                          to_3d<dim>(wall.normal)));
+
+          const double mass = particles[p].density *
+                              (dim == 3 ? 4. / 3. : 1.) * numbers::PI *
+                              std::pow(particles[p].radius, dim);
+
+          Tensor<1, dim> force;
+          calculate_contact_force(normal_overlap,
+                                  wall.normal,
+                                  relative_velocity,
+                                  particles[p].radius,
+                                  mass,
+                                  pw_youngs_modulus,
+                                  pw_shear_modulus,
+                                  pw_beta,
+                                  pw_friction_coefficient,
+                                  dt,
+                                  pw_tangential_overlaps[contact_id],
+                                  force);
+
+          forces[p] += force;
+          torques[p] += particles[p].radius *
+                        cross_product_3d(to_3d<dim>(wall.normal),
+                                         to_3d<dim>(force));
+        }
+    }
+}
+
+template <int dim>
+void
+IBParticlesDEM<dim>::integrate(std::vector<IBParticle<dim>> &particles,
+                               const double                  dt)
+{
+  const unsigned int n_substeps = parameters.contact_substeps;
+  const double       dt_dem     = dt / n_substeps;
+
+  std::vector<Tensor<1, dim>> contact_forces(particles.size());
+  std::vector<Tensor<1, 3>>   contact_torques(particles.size());
+
+  for (unsigned int step = 0; step < n_substeps; ++step)
+    {
+      calculate_contact_forces(particles,
+                               dt_dem,
+                               contact_forces,
+                               contact_torques);
+
+      for (unsigned int p = 0; p < particles.size(); ++p)
+        {
+          IBParticle<dim> &particle = particles[p];
+
+          // Volume and moment of inertia of a sphere in 3D and of a disk of
+          // unit depth in 2D
+          const double volume = (dim == 3 ? 4. / 3. : 1.) * numbers::PI *
+                                std::pow(particle.radius, dim);
+          const double mass = particle.density * volume;
+          const double inertia =
+            (dim == 3 ? 2. / 5. : 1. / 2.) * mass * particle.radius *
+            particle.radius;
+
+          const Tensor<1, dim> force =
+            fluid_density * particle.forces +
+            (mass - fluid_density * volume) * parameters.gravity +
+            contact_forces[p];
+          const Tensor<1, 3> torque =
+            fluid_density * particle.torques + contact_torques[p];
+
+          // Symplectic Euler, the velocities are updated first
+          particle.velocity += dt_dem * force / mass;
+          particle.position += dt_dem * particle.velocity;
+          if (dim == 3)
+            particle.omega += dt_dem * torque / inertia;
+          else
+            particle.omega[2] += dt_dem * torque[2] / inertia;
+        }
+    }
+}
+
+template <int dim>
+void
+IBParticlesDEM<dim>::save(const std::string &prefix) const
+{
+  const std::string filename = prefix + ".ib_particles_dem";
+  std::ofstream     output(filename.c_str());
+  output << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+  // Each contact is written as the ids of its bodies and the components of
+  // its tangential overlap
+  const auto write_contacts =
+    [&output](
+      const std::string &name,
+      const std::map<std::pair<unsigned int, unsigned int>, Tensor<1, dim>>
+        &tangential_overlaps) {
+      output << name << " " << tangential_overlaps.size() << std::endl;
+      for (const auto &contact : tangential_overlaps)
+        {
+          output << contact.first.first << " " << contact.first.second;
+          for (unsigned int d = 0; d < dim; ++d)
+            output << " " << contact.second[d];
+          output << std::endl;
+        }
+    };
+
+  output << "IB particles DEM" << std::endl;
+  write_contacts("Particle_particle_contacts", pp_tangential_overlaps);
+  write_contacts("Particle_wall_contacts", pw_tangential_overlaps);
+}
+
+template <int dim>
+void
+IBParticlesDEM<dim>::read(const std::string &prefix)
+{
+  const std::string filename = prefix + ".ib_particles_dem";
+  std::ifstream     input(filename.c_str());
+  AssertThrow(input, ExcFileNotOpen(filename));
+
+  const auto read_contacts =
+    [&input](
+      std::map<std::pair<unsigned int, unsigned int>, Tensor<1, dim>>
+        &tangential_overlaps) {
+      std::string  buffer;
+      unsigned int n_contacts;
+      input >> buffer >> n_contacts;
+
+      tangential_overlaps.clear();
+      for (unsigned int c = 0; c < n_contacts; ++c)
+        {
+          std::pair<unsigned int, unsigned int> ids;
+          Tensor<1, dim>                        tangential_overlap;
+          input >> ids.first >> ids.second;
+          for (unsigned int d = 0; d < dim; ++d)
+            input >> tangential_overlap[d];
+          tangential_overlaps[ids] = tangential_overlap;
+        }
+    };
+
+  std::string buffer;
+  std::getline(input, buffer);
+  read_contacts(pp_tangential_overlaps);
+  read_contacts(pw_tangential_overlaps);
+  AssertThrow(!input.fail(), ExcIO());
+}
+
+template class IBParticlesDEM<2>;
+template class IBParticlesDEM<3>;
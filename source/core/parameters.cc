@@ -35,6 +35,13 @@ namespace Parameters
                         "1",
                         Patterns::Double(),
                         "Maximum CFL value");
+      prm.declare_entry(
+        "cfl from assembly",
+        "false",
+        Patterns::Bool(),
+        "Calculate the CFL during the assembly of the last non-linear "
+        "iteration instead of after the time step <true|false>. The CFL is "
+        "then evaluated at every quadrature point of the cells.");
       prm.declare_entry("stop tolerance",
                         "1e-10",
                         Patterns::Double(),
@@ -44,6 +51,24 @@ namespace Parameters
                         "1.1",
                         Patterns::Double(),
                         "Adaptative time step scaling");
+      prm.declare_entry(
+        "time step control",
+        "cfl",
+        Patterns::Selection("cfl|error"),
+        "Quantity controlling the adaptative time step <cfl|error>. With cfl, "
+        "the time step is bound by the max cfl. With error, the time step is "
+        "calculated by a PI controller from an estimate of the time "
+        "integration error of the bdf schemes, and time steps whose error "
+        "exceeds the tolerance are rejected and solved again.");
+      prm.declare_entry("error tolerance",
+                        "1e-3",
+                        Patterns::Double(0.),
+                        "Tolerance on the time integration error relative "
+                        "to the norm of the solution");
+      prm.declare_entry("max time step rejections",
+                        "5",
+                        Patterns::Integer(0),
+                        "Maximal number of rejections of a time step");
       prm.declare_entry("output path",
                         "./",
                         Patterns::FileName(),
@@ -137,9 +162,21 @@ namespace Parameters
       timeEnd        = prm.get_double("time end");
       adapt          = prm.get_bool("adapt");
       maxCFL         = prm.get_double("max cfl");
+      assembly_CFL   = prm.get_bool("cfl from assembly");
       stop_tolerance = prm.get_double("stop tolerance");
       adaptative_time_step_scaling =
         prm.get_double("adaptative time step scaling");
+
+      const std::string tsc = prm.get("time step control");
+      if (tsc == "cfl")
+        time_step_control = TimeStepControl::cfl;
+      else if (tsc == "error")
+        time_step_control = TimeStepControl::error;
+      else
+        throw(std::runtime_error("Invalid time step control"));
+      error_tolerance          = prm.get_double("error tolerance");
+      max_time_step_rejections = prm.get_integer("max time step rejections");
+
       startup_timestep_scaling = prm.get_double("startup time scaling");
       number_mesh_adaptation   = prm.get_integer("number mesh adapt");
 
@@ -458,6 +495,23 @@ namespace Parameters
                         "4",
                         Patterns::Integer(),
                         "Number of digits displayed when showing residuals");
+
+      prm.declare_entry(
+        "extrapolate initial guess",
+        "false",
+        Patterns::Bool(),
+        "Start the non-linear iterations of the bdf time steps from a "
+        "polynomial extrapolation of the previous solutions instead of the "
+        "solution of the previous time step");
+
+      prm.declare_entry(
+        "reuse sdirk jacobian",
+        "false",
+        Patterns::Bool(),
+        "Assemble the jacobian matrix and the preconditioner once per time "
+        "step for the sdirk schemes. The later stages reuse them as long as "
+        "the residual decreases by the step tolerance at every iteration, "
+        "otherwise the jacobian matrix is assembled again.");
     }
     prm.leave_subsection();
   }
@@ -483,11 +537,13 @@ namespace Parameters
       else
         throw(std::runtime_error("Invalid non-linear solver "));
 
-      tolerance         = prm.get_double("tolerance");
-      step_tolerance    = prm.get_double("step tolerance");
-      max_iterations    = prm.get_integer("max iterations");
-      skip_iterations   = prm.get_integer("skip iterations");
-      display_precision = prm.get_integer("residual precision");
+      tolerance                 = prm.get_double("tolerance");
+      step_tolerance            = prm.get_double("step tolerance");
+      max_iterations            = prm.get_integer("max iterations");
+      skip_iterations           = prm.get_integer("skip iterations");
+      display_precision         = prm.get_integer("residual precision");
+      extrapolate_initial_guess = prm.get_bool("extrapolate initial guess");
+      reuse_sdirk_jacobian      = prm.get_bool("reuse sdirk jacobian");
     }
     prm.leave_subsection();
   }
@@ -585,9 +641,9 @@ namespace Parameters
       prm.declare_entry(
         "method",
         "gmres",
-        Patterns::Selection("gmres|bicgstab|amg|tfqmr|direct"),
+        Patterns::Selection("gmres|bicgstab|amg|tfqmr|direct|block_amg"),
         "The iterative solver for the linear system of equations. "
-        "Choices are <gmres|bicgstab|amg|tfqmr|direct>. gmres is a GMRES iterative "
+        "Choices are <gmres|bicgstab|amg|tfqmr|direct|block_amg>. gmres is a GMRES iterative "
         "solver "
         "with ILU preconditioning. bicgstab is a BICGSTAB iterative solver "
         "with ILU preconditioning. "
@@ -596,7 +652,11 @@ namespace Parameters
         "preconditioning is more efficient. "
         "As the number of mesh elements increase, the amg solver is the most "
         "efficient. Generally, at 1M elements, the amg solver always "
-        "outperforms the gmres or bicgstab");
+        "outperforms the gmres or bicgstab. "
+        "block_amg is GMRES + a block Schur complement preconditioner "
+        "with AMG on the velocity block and a pressure mass/Laplacian "
+        "approximation of the Schur complement. It is only available for "
+        "the GLS Navier-Stokes solver.");
       prm.declare_entry("relative residual",
                         "1e-3",
                         Patterns::Double(),
@@ -668,6 +728,21 @@ namespace Parameters
                         "1",
                         Patterns::Integer(),
                         "amg smoother overlap");
+      prm.declare_entry(
+        "amg reuse hierarchy",
+        "false",
+        Patterns::Bool(),
+        "Reuse the AMG aggregates when the matrix is renewed. The "
+        "hierarchy is only recomputed from the new matrix entries and is "
+        "fully rebuilt after a change of the degrees of freedom or when "
+        "the number of iterations spikes.");
+      prm.declare_entry(
+        "amg rebuild iteration ratio",
+        "2",
+        Patterns::Double(1.),
+        "The AMG hierarchy is fully rebuilt when the number of iterations "
+        "exceeds this ratio times the number of iterations obtained with "
+        "the last fully built hierarchy.");
     }
     prm.leave_subsection();
   }
@@ -696,9 +771,11 @@ namespace Parameters
         solver = SolverType::tfqmr;
       else if (sv == "direct")
         solver = SolverType::direct;
+      else if (sv == "block_amg")
+        solver = SolverType::block_amg;
       else
         throw std::logic_error(
-          "Error, invalid iterative solver type. Choices are amg, gmres, bicgstab, tfqmr or direct");
+          "Error, invalid iterative solver type. Choices are amg, gmres, bicgstab, tfqmr, direct or block_amg");
 
       relative_residual  = prm.get_double("relative residual");
       minimum_residual   = prm.get_double("minimum residual");
@@ -720,6 +797,9 @@ namespace Parameters
       amg_w_cycles              = prm.get_bool("amg w cycles");
       amg_smoother_sweeps       = prm.get_integer("amg smoother sweeps");
       amg_smoother_overlap      = prm.get_integer("amg smoother overlap");
+      amg_reuse_hierarchy       = prm.get_bool("amg reuse hierarchy");
+      amg_rebuild_iteration_ratio =
+        prm.get_double("amg rebuild iteration ratio");
     }
     prm.leave_subsection();
   }
@@ -769,6 +849,25 @@ namespace Parameters
                         "0.05",
                         Patterns::Double(),
                         "Fraction of coarsened elements");
+      prm.declare_entry(
+        "weighted repartitioning",
+        "false",
+        Patterns::Bool(),
+        "Weight the cells by their computational cost when the triangulation "
+        "is partitioned between the processors <true|false>");
+      prm.declare_entry(
+        "immersed cell weight",
+        "1000",
+        Patterns::Integer(),
+        "Additional weight of a cell cut by an immersed particle or of each "
+        "solid particle located in a cell. The weight of a cell is 1000.");
+      prm.declare_entry("repartition frequency",
+                        "0",
+                        Patterns::Integer(),
+                        "Frequency of the repartitioning of the triangulation "
+                        "following the motion of the immersed particles. "
+                        "Only used with the weighted repartitioning. A value "
+                        "of 0 disables the repartitioning.");
     }
     prm.leave_subsection();
   }
@@ -803,6 +902,9 @@ namespace Parameters
       frequency                = prm.get_integer("frequency");
       coarsening_fraction      = prm.get_double("fraction coarsening");
       refinement_fraction      = prm.get_double("fraction refinement");
+      weighted_repartitioning  = prm.get_bool("weighted repartitioning");
+      immersed_cell_weight     = prm.get_integer("immersed cell weight");
+      repartition_frequency    = prm.get_integer("repartition frequency");
     }
     prm.leave_subsection();
   }
@@ -958,6 +1060,10 @@ namespace Parameters
       Patterns::Double(),
       "position relative to the center of the particle  for the location of the point where the pressure is impose inside the particle  in z ");
     prm.declare_entry("radius", "0.2", Patterns::Double(), "Particles radius ");
+    prm.declare_entry("density",
+                      "1",
+                      Patterns::Double(),
+                      "Particles density, used when the motion is integrated");
   }
 
   template <int dim>
@@ -996,7 +1102,9 @@ namespace Parameters
         "nb force evaluation",
         "100",
         Patterns::Integer(),
-        "Number of evaluation of the pressure and viscosity force at the boundary per particle  ");
+        "Number of evaluation of the pressure and viscosity force at the boundary per particle. "
+        "In 2D, the points are evenly spaced on the circle. In 3D, the points form a Fibonacci lattice "
+        "of equal-area directions on the sphere and this is the total number of points per particle.");
       prm.declare_entry(
         "calculate force",
         "true",
@@ -1007,6 +1115,53 @@ namespace Parameters
         "ib_force",
         Patterns::FileName(),
         "Bool to define if the force is evaluated on each particle ");
+      prm.declare_entry(
+        "integrate motion",
+        "false",
+        Patterns::Bool(),
+        "Integrate the motion of the particles from the hydrodynamic forces, "
+        "the gravity and the contact forces. The force must be calculated.");
+      prm.declare_entry(
+        "contact sub-steps",
+        "100",
+        Patterns::Integer(1),
+        "Number of sub-steps of a time step used to integrate the motion of "
+        "the particles and to resolve their collisions");
+      prm.declare_entry("gx", "0", Patterns::Double(), "Gravity in x");
+      prm.declare_entry("gy", "0", Patterns::Double(), "Gravity in y");
+      prm.declare_entry("gz", "0", Patterns::Double(), "Gravity in z");
+      prm.declare_entry("young modulus",
+                        "1000000",
+                        Patterns::Double(),
+                        "Young's modulus of the particles");
+      prm.declare_entry("poisson ratio",
+                        "0.3",
+                        Patterns::Double(),
+                        "Poisson's ratio of the particles");
+      prm.declare_entry("restitution coefficient",
+                        "0.9",
+                        Patterns::Double(),
+                        "Coefficient of restitution of the particles");
+      prm.declare_entry("friction coefficient",
+                        "0.3",
+                        Patterns::Double(),
+                        "Coefficient of friction of the particles");
+      prm.declare_entry("wall young modulus",
+                        "1000000",
+                        Patterns::Double(),
+                        "Young's modulus of the walls");
+      prm.declare_entry("wall poisson ratio",
+                        "0.3",
+                        Patterns::Double(),
+                        "Poisson's ratio of the walls");
+      prm.declare_entry("wall restitution coefficient",
+                        "0.9",
+                        Patterns::Double(),
+                        "Coefficient of restitution of the walls");
+      prm.declare_entry("wall friction coefficient",
+                        "0.3",
+                        Patterns::Double(),
+                        "Coefficient of friction of the walls");
 
       prm.enter_subsection("particle info 0");
       {
@@ -1077,6 +1232,22 @@ namespace Parameters
       nb_force_eval      = prm.get_integer("nb force evaluation");
       calculate_force_ib = prm.get_bool("calculate force");
       ib_force_output_file = prm.get("ib force output file");
+      integrate_motion     = prm.get_bool("integrate motion");
+      contact_substeps     = prm.get_integer("contact sub-steps");
+      gravity[0]           = prm.get_double("gx");
+      gravity[1]           = prm.get_double("gy");
+      if (dim == 3)
+        gravity[2] = prm.get_double("gz");
+
+      youngs_modulus          = prm.get_double("young modulus");
+      poisson_ratio           = prm.get_double("poisson ratio");
+      restitution_coefficient = prm.get_double("restitution coefficient");
+      friction_coefficient    = prm.get_double("friction coefficient");
+      wall_youngs_modulus     = prm.get_double("wall young modulus");
+      wall_poisson_ratio      = prm.get_double("wall poisson ratio");
+      wall_restitution_coefficient =
+        prm.get_double("wall restitution coefficient");
+      wall_friction_coefficient = prm.get_double("wall friction coefficient");
 
 
       particles.resize(nb);
@@ -1092,6 +1263,7 @@ namespace Parameters
           particles[i].omega[1]             = prm.get_double("omega y");
           particles[i].omega[2]             = prm.get_double("omega z");
           particles[i].radius               = prm.get_double("radius");
+          particles[i].density              = prm.get_double("density");
           particles[i].pressure_location[0] = prm.get_double("pressure x");
           particles[i].pressure_location[1] = prm.get_double("pressure y");
 
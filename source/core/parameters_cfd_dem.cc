@@ -10,8 +10,18 @@ namespace Parameters
     prm.declare_entry(
       "mode",
       "function",
-      Patterns::Selection("function"),
-      "Choose the method for the calculation of the void fraction");
+      Patterns::Selection("function|pcm|pcm_projection"),
+      "Choose the method for the calculation of the void fraction. "
+      "Choices are <function|pcm|pcm_projection>. pcm uses the particle "
+      "centroid method, each particle contributes to the void fraction of "
+      "the cell which contains its centroid, and the cell void fraction is "
+      "averaged at the nodes. pcm_projection projects the cell void fraction "
+      "onto the nodes with an L2 projection smoothed by the smoothing length.");
+    prm.declare_entry("smoothing length",
+                      "0",
+                      Patterns::Double(0.),
+                      "Smoothing length of the pcm_projection of the void "
+                      "fraction");
     prm.enter_subsection("function");
     void_fraction.declare_parameters(prm, 1);
     prm.leave_subsection();
@@ -26,11 +36,16 @@ namespace Parameters
     const std::string op = prm.get("mode");
     if (op == "function")
       mode = Parameters::VoidFractionMode::function;
+    else if (op == "pcm")
+      mode = Parameters::VoidFractionMode::pcm;
+    else if (op == "pcm_projection")
+      mode = Parameters::VoidFractionMode::pcm_projection;
     else
       throw(std::runtime_error("Invalid voidfraction model"));
     prm.enter_subsection("function");
     void_fraction.parse_parameters(prm);
     prm.leave_subsection();
+    smoothing_length = prm.get_double("smoothing length");
     prm.leave_subsection();
   }
 
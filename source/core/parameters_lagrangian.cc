@@ -452,6 +452,29 @@ namespace Parameters
           Patterns::Double(),
           "Contact search zone diameter to particle diameter ratio");
 
+        prm.declare_entry(
+          "polydisperse contact search",
+          "false",
+          Patterns::Bool(),
+          "Use per-pair cutoff distances (sum of the radii and the contact "
+          "search skin) and particle size classes in the contact search");
+
+        prm.declare_entry(
+          "compact ghost update",
+          "false",
+          Patterns::Bool(),
+          "Update only the location, velocity and angular velocity of the "
+          "ghost particles between contact search steps, overlapping the "
+          "communication with the local-local contact force calculation");
+
+        prm.declare_entry(
+          "communication computation overlap",
+          "false",
+          Patterns::Bool(),
+          "Calculate the particle-wall forces and integrate the particles "
+          "which are not adjacent to ghost cells during the ghost particle "
+          "update. This enables the compact ghost update");
+
         prm.declare_entry("particle particle contact force method",
                           "pp_nonlinear",
                           Patterns::Selection("pp_linear|pp_nonlinear"),
@@ -470,6 +493,27 @@ namespace Parameters
           Patterns::Selection("velocity_verlet|explicit_euler|gear3"),
           "Choosing integration method"
           "Choices are <velocity_verlet|explicit_euler|gear3>.");
+
+        prm.declare_entry("particle sleeping",
+                          "false",
+                          Patterns::Bool(),
+                          "Enable the deactivation of particles at rest");
+
+        prm.declare_entry("sleeping velocity threshold",
+                          "1e-4",
+                          Patterns::Double(),
+                          "Velocity below which a particle is at rest");
+
+        prm.declare_entry("sleeping acceleration threshold",
+                          "1e-2",
+                          Patterns::Double(),
+                          "Acceleration below which a particle is at rest");
+
+        prm.declare_entry(
+          "sleeping steps",
+          "500",
+          Patterns::Integer(),
+          "Number of consecutive steps at rest before a particle sleeps");
       }
       prm.leave_subsection();
     }
@@ -528,6 +572,11 @@ namespace Parameters
             throw(std::runtime_error("Invalid insertion method "));
           }
         neighborhood_threshold = prm.get_double("neighborhood threshold");
+        polydisperse_contact_search =
+          prm.get_bool("polydisperse contact search");
+        compact_ghost_update = prm.get_bool("compact ghost update");
+        communication_computation_overlap =
+          prm.get_bool("communication computation overlap");
 
         const std::string ppcf =
           prm.get("particle particle contact force method");
@@ -563,6 +612,13 @@ namespace Parameters
           {
             throw(std::runtime_error("Invalid integration method "));
           }
+
+        particle_sleeping = prm.get_bool("particle sleeping");
+        sleeping_velocity_threshold =
+          prm.get_double("sleeping velocity threshold");
+        sleeping_acceleration_threshold =
+          prm.get_double("sleeping acceleration threshold");
+        sleeping_steps = prm.get_integer("sleeping steps");
       }
       prm.leave_subsection();
     }
@@ -19,6 +19,25 @@ Parameters::Multiphysics::declare_parameters(ParameterHandler &prm)
                       "false",
                       Patterns::Bool(),
                       "Thermic calculation <true|false>");
+
+    prm.declare_entry("heat transfer time step ratio",
+                      "1",
+                      Patterns::Integer(1),
+                      "Number of fluid dynamics time steps per heat transfer "
+                      "time step. The heat transfer time step is the sum of "
+                      "these time steps.");
+
+    prm.declare_entry("heat transfer subcycles",
+                      "1",
+                      Patterns::Integer(1),
+                      "Number of sub-steps in which a heat transfer time step "
+                      "is divided");
+
+    prm.declare_entry("heat transfer preconditioner",
+                      "ilu",
+                      Patterns::Selection("amg|ilu"),
+                      "Preconditioner of the GMRES solver of the heat "
+                      "transfer <amg|ilu>");
   }
   prm.leave_subsection();
 }
@@ -30,6 +49,19 @@ Parameters::Multiphysics::parse_parameters(ParameterHandler &prm)
   {
     fluid_dynamics = prm.get_bool("fluid dynamics");
     heat_transfer  = prm.get_bool("heat transfer");
+    heat_transfer_time_step_ratio =
+      prm.get_integer("heat transfer time step ratio");
+    heat_transfer_subcycles = prm.get_integer("heat transfer subcycles");
+
+    const std::string preconditioner =
+      prm.get("heat transfer preconditioner");
+    if (preconditioner == "amg")
+      heat_transfer_preconditioner = HeatTransferPreconditioner::amg;
+    else if (preconditioner == "ilu")
+      heat_transfer_preconditioner = HeatTransferPreconditioner::ilu;
+    else
+      throw std::logic_error(
+        "Error, invalid heat transfer preconditioner. Choices are amg or ilu");
   }
   prm.leave_subsection();
 }
@@ -0,0 +1,177 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#include <deal.II/base/geometry_info.h>
+
+#include <deal.II/fe/mapping_q_generic.h>
+
+#include <core/point_locator.h>
+
+#include <boost/geometry/index/rtree.hpp>
+
+namespace bgi = boost::geometry::index;
+
+template <int dim>
+PointLocator<dim>::PointLocator(const DoFHandler<dim> &dof_handler,
+                                const Mapping<dim> &   mapping)
+  : dof_handler(dof_handler)
+  , mapping(mapping)
+  , tree_is_outdated(true)
+{
+  // The RTree stores iterators and bounding boxes, both are invalidated by
+  // any change of the triangulation (refinement, repartitioning, moved
+  // vertices). The tree is only flagged here, it is rebuilt at the next
+  // query since the DoFs are not yet distributed when the signal is emitted.
+  tria_change_connection =
+    dof_handler.get_triangulation().signals.any_change.connect(
+      [&]() { tree_is_outdated = true; });
+}
+
+template <int dim>
+PointLocator<dim>::~PointLocator()
+{
+  tria_change_connection.disconnect();
+}
+
+template <int dim>
+void
+PointLocator<dim>::clear()
+{
+  tree_is_outdated = true;
+}
+
+template <int dim>
+void
+PointLocator<dim>::build_tree()
+{
+  std::vector<std::pair<BoundingBox<dim>, active_cell_iterator>> boxes;
+  boxes.reserve(dof_handler.get_triangulation().n_active_cells());
+
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    if (!cell->is_artificial())
+      boxes.emplace_back(cell->bounding_box(), cell);
+
+  tree             = pack_rtree(boxes);
+  tree_is_outdated = false;
+}
+
+template <int dim>
+bool
+PointLocator<dim>::point_is_in_cell(const active_cell_iterator &cell,
+                                    const Point<dim> &          point) const
+{
+  // Cheap rejection test on the bounding box of the cell
+  const auto   box_points    = cell->bounding_box().get_boundary_points();
+  const double box_tolerance = tolerance * cell->diameter();
+  for (unsigned int d = 0; d < dim; ++d)
+    if (point[d] < box_points.first[d] - box_tolerance ||
+        point[d] > box_points.second[d] + box_tolerance)
+      return false;
+
+  try
+    {
+      const Point<dim> p_unit =
+        mapping.transform_real_to_unit_cell(cell, point);
+      return GeometryInfo<dim>::is_inside_unit_cell(p_unit, tolerance);
+    }
+  catch (const typename MappingQGeneric<dim>::ExcTransformationFailed &)
+    {
+      return false;
+    }
+}
+
+template <int dim>
+typename PointLocator<dim>::active_cell_iterator
+PointLocator<dim>::find_cell_in_neighbors(const active_cell_iterator &cell,
+                                          const Point<dim> &point) const
+{
+  for (unsigned int f = 0; f < GeometryInfo<dim>::faces_per_cell; ++f)
+    {
+      if (cell->at_boundary(f))
+        continue;
+
+      if (cell->neighbor(f)->has_children())
+        {
+          for (unsigned int sf = 0; sf < cell->face(f)->n_children(); ++sf)
+            {
+              const active_cell_iterator neighbor =
+                cell->neighbor_child_on_subface(f, sf);
+              if (!neighbor->is_artificial() &&
+                  point_is_in_cell(neighbor, point))
+                return neighbor;
+            }
+        }
+      else
+        {
+          const active_cell_iterator neighbor = cell->neighbor(f);
+          if (!neighbor->is_artificial() && point_is_in_cell(neighbor, point))
+            return neighbor;
+        }
+    }
+
+  return dof_handler.end();
+}
+
+template <int dim>
+typename PointLocator<dim>::active_cell_iterator
+PointLocator<dim>::find_cell(const Point<dim> &          point,
+                             const active_cell_iterator &hint)
+{
+  if (tree_is_outdated)
+    build_tree();
+
+  // Test the hint and its neighbors first, this is the most common case when
+  // successive points are close to each other.
+  if (hint.state() == IteratorState::valid && !hint->is_artificial())
+    {
+      if (point_is_in_cell(hint, point))
+        return hint;
+
+      const auto neighbor = find_cell_in_neighbors(hint, point);
+      if (neighbor != dof_handler.end())
+        return neighbor;
+    }
+
+  // Query the RTree for the cells whose bounding box contains the point and
+  // test these candidates only.
+  std::vector<std::pair<BoundingBox<dim>, active_cell_iterator>> candidates;
+  tree.query(bgi::intersects(point), std::back_inserter(candidates));
+
+  for (const auto &candidate : candidates)
+    if (point_is_in_cell(candidate.second, point))
+      return candidate.second;
+
+  return dof_handler.end();
+}
+
+template <int dim>
+void
+PointLocator<dim>::find_cells(const std::vector<Point<dim>> &    points,
+                              std::vector<active_cell_iterator> &cells)
+{
+  cells.resize(points.size());
+
+  active_cell_iterator hint;
+  for (unsigned int i = 0; i < points.size(); ++i)
+    {
+      cells[i] = find_cell(points[i], hint);
+      if (cells[i] != dof_handler.end())
+        hint = cells[i];
+    }
+}
+
+template class PointLocator<2>;
+template class PointLocator<3>;
@@ -1,11 +1,20 @@
 #include "core/simulation_control.h"
 
 #include <cfloat>
+#include <cmath>
 #include <fstream>
 
 #include "core/parameters.h"
 
 
+// Safety factor and minimal reduction factor of the time step when it is
+// controlled by the time integration error
+namespace
+{
+  const double error_safety_factor      = 0.9;
+  const double minimal_time_step_factor = 0.2;
+} // namespace
+
 SimulationControl::SimulationControl(Parameters::SimulationControl param)
   : current_time(0)
   , time_step(param.dt)
@@ -25,6 +34,9 @@ SimulationControl::SimulationControl(Parameters::SimulationControl param)
   , output_path(param.output_folder)
   , output_boundaries(param.output_boundaries)
   , first_assembly(true)
+  , error_ratio(0)
+  , previous_error_ratio(0)
+  , error_order(1)
 {
   time_step_vector.resize(numberTimeStepStored);
   time_step_vector[0] = param.dt;
@@ -42,6 +54,22 @@ SimulationControl::add_time_step(double p_timestep)
   time_step_vector[0] = p_timestep;
 }
 
+void
+SimulationControl::reject_time_step()
+{
+  // The error scales with the time step to the power error_order + 1, the
+  // reduction is bound so that a poor estimate does not collapse the time step
+  const double factor =
+    std::max(minimal_time_step_factor,
+             error_safety_factor *
+               std::pow(error_ratio, -1. / (error_order + 1.)));
+
+  time_step           = std::min(factor, 1.) * time_step;
+  time_step_vector[0] = time_step;
+  current_time        = previous_time + time_step;
+  first_assembly      = true;
+}
+
 bool
 SimulationControl::is_output_iteration()
 {
@@ -89,6 +117,9 @@ SimulationControlTransient::SimulationControlTransient(
   : SimulationControl(param)
   , adapt(param.adapt)
   , adaptative_time_step_scaling(param.adaptative_time_step_scaling)
+  , error_control(param.adapt && param.time_step_control ==
+                                   Parameters::SimulationControl::
+                                     TimeStepControl::error)
 {}
 
 void
@@ -140,7 +171,27 @@ SimulationControlTransient::calculate_time_step()
 {
   double new_time_step = time_step;
 
-  if (adapt && iteration_number > 1)
+  if (error_control)
+    {
+      // PI controller on the error of the last two time steps. The time step
+      // is kept until the solver provides an error estimate.
+      if (iteration_number > 1 && error_ratio > 0)
+        {
+          const double p = error_order + 1.;
+          double       factor =
+            error_safety_factor * std::pow(error_ratio, -0.7 / p);
+          if (previous_error_ratio > 0)
+            factor *= std::pow(previous_error_ratio, 0.4 / p);
+
+          factor = std::min(std::max(factor, minimal_time_step_factor),
+                            adaptative_time_step_scaling);
+
+          new_time_step        = time_step * factor;
+          previous_error_ratio = error_ratio;
+          error_ratio          = 0;
+        }
+    }
+  else if (adapt && iteration_number > 1)
     {
       new_time_step = time_step * adaptative_time_step_scaling;
       if (CFL > 0 && max_CFL / CFL < adaptative_time_step_scaling)
@@ -192,6 +243,8 @@ SimulationControlTransientDynamicOutput::calculate_time_step()
       new_time_step           = time_step_vector[1];
       time_step_forced_output = false;
     }
+  else if (error_control)
+    new_time_step = SimulationControlTransient::calculate_time_step();
   else if (iteration_number > 1)
     {
       new_time_step = time_step * adaptative_time_step_scaling;
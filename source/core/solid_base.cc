@@ -23,6 +23,7 @@
 #include <deal.II/fe/fe.h>
 #include <deal.II/fe/fe_nothing.h>
 #include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q1.h>
 
 #include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/grid/grid_in.h>
@@ -185,6 +186,10 @@ SolidBase<dim, spacedim>::setup_particles()
     [&]() { solid_particle_handler->register_store_callback_function(); });
   fluid_tria->signals.post_distributed_refinement.connect(
     [&]() { solid_particle_handler->register_load_callback_function(false); });
+  fluid_tria->signals.pre_distributed_repartition.connect(
+    [&]() { solid_particle_handler->register_store_callback_function(); });
+  fluid_tria->signals.post_distributed_repartition.connect(
+    [&]() { solid_particle_handler->register_load_callback_function(false); });
 
   setup_done                  = true;
   initial_number_of_particles = solid_particle_handler->n_global_particles();
@@ -209,6 +214,17 @@ SolidBase<dim, spacedim>::get_solid_particle_handler()
   return solid_particle_handler;
 }
 
+template <int dim, int spacedim>
+unsigned int
+SolidBase<dim, spacedim>::n_particles_in_cell(
+  const typename Triangulation<spacedim>::active_cell_iterator &cell) const
+{
+  if (!setup_done)
+    return 0;
+
+  return solid_particle_handler->n_particles_in_cell(cell);
+}
+
 template <int dim, int spacedim>
 Function<spacedim> *
 SolidBase<dim, spacedim>::get_solid_velocity()
@@ -261,7 +277,12 @@ SolidBase<dim, spacedim>::integrate_velocity(double time_step)
                                (k1 + 2 * k2 + 2 * k3 + k4);
           particle->set_location(particle_location);
         }
-      solid_particle_handler->sort_particles_into_subdomains_and_cells();
+
+      // The displacement of the particles during a sub iteration is small
+      // compared to the cell size, most particles thus remain in their cell.
+      // The (global) sort is only carried out when one of them has left it.
+      if (!param->incremental_relocation || relocate_particles_in_cells())
+        solid_particle_handler->sort_particles_into_subdomains_and_cells();
     }
 
   if (initial_number_of_particles !=
@@ -281,6 +302,54 @@ SolidBase<dim, spacedim>::integrate_velocity(double time_step)
     }
 }
 
+template <int dim, int spacedim>
+bool
+SolidBase<dim, spacedim>::relocate_particles_in_cells()
+{
+  const Mapping<spacedim> &mapping = StaticMappingQ1<spacedim>::mapping;
+
+  bool particle_has_left_cell = false;
+
+  // Particles are stored cell by cell, the cell of a range of particles is
+  // only checked once and the range is skipped as soon as a particle has
+  // left its cell since the particles have to be sorted anyway
+  auto particle = solid_particle_handler->begin();
+  while (particle != solid_particle_handler->end() && !particle_has_left_cell)
+    {
+      const auto cell = particle->get_surrounding_cell(*fluid_tria);
+      const auto pic  = solid_particle_handler->particles_in_cell(cell);
+
+      for (auto p = pic.begin(); p != pic.end(); ++p)
+        {
+          try
+            {
+              const Point<spacedim> reference_location =
+                mapping.transform_real_to_unit_cell(cell, p->get_location());
+
+              if (GeometryInfo<spacedim>::is_inside_unit_cell(
+                    reference_location))
+                p->set_reference_location(reference_location);
+              else
+                particle_has_left_cell = true;
+            }
+          catch (typename Mapping<spacedim>::ExcTransformationFailed &)
+            {
+              particle_has_left_cell = true;
+            }
+
+          if (particle_has_left_cell)
+            break;
+        }
+
+      particle = pic.end();
+    }
+
+  // The sort is a collective operation, it is either done by all the
+  // processes or by none of them
+  return Utilities::MPI::max(particle_has_left_cell ? 1 : 0,
+                             mpi_communicator) > 0;
+}
+
 template <int dim, int spacedim>
 void
 SolidBase<dim, spacedim>::move_solid_triangulation(double time_step)
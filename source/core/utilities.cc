@@ -188,6 +188,28 @@ find_cell_around_point_with_tree(const DoFHandler<dim> &dof_handler,
 }
 
 
+std::vector<Tensor<1, 3>>
+fibonacci_sphere_directions(const unsigned int n_points)
+{
+  std::vector<Tensor<1, 3>> directions(n_points);
+
+  const double golden_angle = numbers::PI * (3. - std::sqrt(5.));
+  for (unsigned int i = 0; i < n_points; ++i)
+    {
+      // The polar coordinate is taken at the center of the band of the
+      // sphere associated with the point, which makes the areas equal
+      const double z   = 1. - (2. * i + 1.) / n_points;
+      const double r   = std::sqrt(1. - z * z);
+      const double phi = golden_angle * i;
+      directions[i][0] = r * std::cos(phi);
+      directions[i][1] = r * std::sin(phi);
+      directions[i][2] = z;
+    }
+
+  return directions;
+}
+
+
 template TableHandler
 make_table_scalars_tensors(
   const std::vector<double> &      independent_values,
@@ -143,6 +143,13 @@ DEMSolver<dim>::DEMSolver(DEMSolverParameters<dim> dem_parameters)
     std::pow(parameters.model_parameters.neighborhood_threshold *
                maximum_particle_diameter,
              2);
+  // In the polydisperse contact search, the cutoff distance of a pair is the
+  // sum of the radii and this skin. For a pair of the largest particles, the
+  // cutoff is the same as the one of the monodisperse search
+  contact_search_skin =
+    std::max(0.,
+             (parameters.model_parameters.neighborhood_threshold - 1) *
+               maximum_particle_diameter);
   if (this_mpi_process == 0)
     input_parameter_inspection(parameters,
                                pcout,
@@ -357,6 +364,11 @@ DEMSolver<dim>::load_balance()
   pcout << "-->Repartitionning triangulation" << std::endl;
   triangulation.repartition();
 
+  // The sleeping state of the particles is only known by their previous owner
+  if (particle_sleeping_object)
+    particle_sleeping_object->wake_up_all_particles(local_adjacent_particles,
+                                                    pw_pairs_in_contact);
+
   cells_local_neighbor_list.clear();
   cells_ghost_neighbor_list.clear();
 
@@ -550,6 +562,26 @@ DEMSolver<dim>::particle_wall_fine_search()
     }
 }
 
+template <int dim>
+void
+DEMSolver<dim>::find_boundary_layer_particles()
+{
+  boundary_layer_particles.clear();
+
+  // Particles located in the cells adjacent to ghost cells, the first cell of
+  // each list is the main (local) cell
+  for (const auto &cell_neighbor_list : cells_ghost_neighbor_list)
+    for (const auto &particle :
+         particle_handler.particles_in_cell(cell_neighbor_list.front()))
+      boundary_layer_particles.insert(particle.get_id());
+
+  // Particles which remained in contact with a ghost particle after leaving
+  // the cells adjacent to ghost cells
+  for (const auto &[particle_id, pairs_in_contact] : ghost_adjacent_particles)
+    if (!pairs_in_contact.empty())
+      boundary_layer_particles.insert(particle_id);
+}
+
 template <int dim>
 void
 DEMSolver<dim>::particle_wall_contact_force()
@@ -814,6 +846,25 @@ DEMSolver<dim>::solve()
   pp_contact_force_object = set_pp_contact_force(parameters);
   pw_contact_force_object = set_pw_contact_force(parameters);
 
+  // Deactivation of the particles at rest
+  if (parameters.model_parameters.particle_sleeping)
+    {
+      particle_sleeping_object =
+        std::make_shared<ParticleSleeping<dim>>(parameters);
+      integrator_object->set_sleeping_particles(
+        &particle_sleeping_object->get_sleeping_particles());
+    }
+
+  const bool overlap_communication =
+    parameters.model_parameters.communication_computation_overlap;
+
+  if (parameters.model_parameters.compact_ghost_update || overlap_communication)
+    ghost_particle_update_object =
+      std::make_shared<GhostParticleUpdate<dim>>(mpi_communicator);
+
+  if (overlap_communication)
+    integrator_object->set_boundary_layer_particles(&boundary_layer_particles);
+
   // DEM engine iterator:
   while (simulation_control->integrate())
     {
@@ -833,6 +884,11 @@ DEMSolver<dim>::solve()
         {
           particle_handler.sort_particles_into_subdomains_and_cells();
 
+          // The particles which left the domain or this processor are
+          // removed from the sleeping state containers
+          if (particle_sleeping_object)
+            particle_sleeping_object->remove_lost_particles(particle_handler);
+
 #if (DEAL_II_VERSION_MINOR <= 2)
           particle_handler.exchange_ghost_particles();
 
@@ -840,6 +896,11 @@ DEMSolver<dim>::solve()
           particle_handler.exchange_ghost_particles(true);
 #endif
         }
+      else if (ghost_particle_update_object)
+        {
+          // The update is completed before the local-ghost contact forces
+          ghost_particle_update_object->start_update();
+        }
       else
         {
 #if (DEAL_II_VERSION_MINOR <= 2)
@@ -852,12 +913,29 @@ DEMSolver<dim>::solve()
       // Broad particle-particle contact search
       if (particles_insertion_step || load_balance_step || contact_search_step)
         {
-          pp_broad_search_object.find_particle_particle_contact_pairs(
-            particle_handler,
-            &cells_local_neighbor_list,
-            &cells_ghost_neighbor_list,
-            local_contact_pair_candidates,
-            ghost_contact_pair_candidates);
+          // Contacts of the sleeping particles are searched and localized as
+          // any other contact
+          if (particle_sleeping_object)
+            particle_sleeping_object->restore_dormant_contacts(
+              local_adjacent_particles, pw_pairs_in_contact);
+
+          if (parameters.model_parameters.polydisperse_contact_search)
+            pp_broad_search_object
+              .find_particle_particle_contact_pairs_polydisperse(
+                particle_handler,
+                &cells_local_neighbor_list,
+                &cells_ghost_neighbor_list,
+                maximum_particle_diameter,
+                contact_search_skin,
+                local_contact_pair_candidates,
+                ghost_contact_pair_candidates);
+          else
+            pp_broad_search_object.find_particle_particle_contact_pairs(
+              particle_handler,
+              &cells_local_neighbor_list,
+              &cells_ghost_neighbor_list,
+              local_contact_pair_candidates,
+              ghost_contact_pair_candidates);
 
           // Updating number of contact builds
           contact_build_number++;
@@ -883,19 +961,36 @@ DEMSolver<dim>::solve()
                                                particle_points_in_contact,
                                                particle_lines_in_contact);
 
+          if (ghost_particle_update_object)
+            ghost_particle_update_object->build(particle_handler,
+                                                triangulation,
+                                                particle_container);
+
           // Particle-particle fine search
-          pp_fine_search_object.particle_particle_fine_search(
-            local_contact_pair_candidates,
-            ghost_contact_pair_candidates,
-            local_adjacent_particles,
-            ghost_adjacent_particles,
-            particle_container,
-            neighborhood_threshold_squared);
+          if (parameters.model_parameters.polydisperse_contact_search)
+            pp_fine_search_object.particle_particle_polydisperse_fine_search(
+              local_contact_pair_candidates,
+              ghost_contact_pair_candidates,
+              local_adjacent_particles,
+              ghost_adjacent_particles,
+              particle_container,
+              contact_search_skin);
+          else
+            pp_fine_search_object.particle_particle_fine_search(
+              local_contact_pair_candidates,
+              ghost_contact_pair_candidates,
+              local_adjacent_particles,
+              ghost_adjacent_particles,
+              particle_container,
+              neighborhood_threshold_squared);
 
           // Particles-wall fine search
           particle_wall_fine_search();
+
+          if (overlap_communication)
+            find_boundary_layer_particles();
         }
-      else
+      else if (!ghost_particle_update_object)
         {
 #if (DEAL_II_VERSION_MINOR <= 2)
           locate_ghost_particles_in_cells<dim>(particle_handler,
@@ -913,13 +1008,50 @@ DEMSolver<dim>::solve()
         simulation_control->get_time_step());
 
       // Particle-particle contact force
-      pp_contact_force_object->calculate_pp_contact_force(
-        local_adjacent_particles,
-        ghost_adjacent_particles,
-        simulation_control->get_time_step());
+      if (ghost_particle_update_object)
+        {
+          // The local-local contact forces are calculated while the ghost
+          // particles are updated
+          pp_contact_force_object->calculate_pp_contact_force(
+            local_adjacent_particles,
+            empty_adjacent_particles,
+            simulation_control->get_time_step());
+
+          // The interior particles are not in contact with ghost particles,
+          // their integration is completed during the ghost particle update.
+          // Only the boundary layer particles are integrated afterwards
+          if (overlap_communication)
+            {
+              particle_wall_contact_force();
+
+              integrator_object->set_post_force_subset(
+                Integrator<dim>::ParticleSubset::interior);
+              integrator_object->integrate_post_force(
+                particle_handler,
+                parameters.physical_properties.g,
+                simulation_control->get_time_step());
+              integrator_object->set_post_force_subset(
+                Integrator<dim>::ParticleSubset::boundary_layer);
+            }
+
+          ghost_particle_update_object->finish_update();
+
+          pp_contact_force_object->calculate_pp_contact_force(
+            empty_adjacent_particles,
+            ghost_adjacent_particles,
+            simulation_control->get_time_step());
+        }
+      else
+        {
+          pp_contact_force_object->calculate_pp_contact_force(
+            local_adjacent_particles,
+            ghost_adjacent_particles,
+            simulation_control->get_time_step());
+        }
 
       // Particles-walls contact force:
-      particle_wall_contact_force();
+      if (!overlap_communication)
+        particle_wall_contact_force();
 
       // Integration correction step (after force calculation)
       integrator_object->integrate_post_force(
@@ -927,6 +1059,21 @@ DEMSolver<dim>::solve()
         parameters.physical_properties.g,
         simulation_control->get_time_step());
 
+      if (overlap_communication)
+        integrator_object->set_post_force_subset(
+          Integrator<dim>::ParticleSubset::all);
+
+      // Putting the particles at rest to sleep and waking up the disturbed ones
+      if (particle_sleeping_object)
+        particle_sleeping_object->update_sleeping_particles(
+          particle_handler,
+          local_adjacent_particles,
+          ghost_adjacent_particles,
+          pw_pairs_in_contact,
+          pfw_pairs_in_contact,
+          particle_points_in_contact,
+          particle_lines_in_contact);
+
       // Visualization
       if (simulation_control->is_output_iteration())
         {
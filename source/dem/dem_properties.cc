@@ -58,6 +58,11 @@ namespace DEM
     properties[PropertiesIndex::acc_derivative_z] =
       std::make_pair("Acceleration_derivative", 1);
 
+    // Force exerted by the fluid on the particle in CFD-DEM coupling
+    properties[PropertiesIndex::fem_force_x] = std::make_pair("FemForce", dim);
+    properties[PropertiesIndex::fem_force_y] = std::make_pair("FemForce", 1);
+    properties[PropertiesIndex::fem_force_z] = std::make_pair("FemForce", 1);
+
 
     return properties;
   }
@@ -14,6 +14,9 @@ ExplicitEulerIntegrator<dim>::integrate_pre_force(
        particle != particle_handler.end();
        ++particle)
     {
+      if (this->is_sleeping(particle->get_id()))
+        continue;
+
       // Get the total array view to the particle properties and location once
       // to improve efficiency
       auto particle_properties = particle->get_properties();
@@ -40,6 +43,9 @@ ExplicitEulerIntegrator<dim>::integrate_post_force(
        particle != particle_handler.end();
        ++particle)
     {
+      if (this->is_skipped_in_post_force(particle->get_id()))
+        continue;
+
       // Get the total array view to the particle properties and location once
       // to improve efficiency
       auto particle_properties = particle->get_properties();
@@ -52,7 +58,8 @@ ExplicitEulerIntegrator<dim>::integrate_post_force(
 
           // Calculate the acceleration
           particle_properties[PropertiesIndex::acc_x + d] =
-            g[d] + particle_properties[PropertiesIndex::force_x + d] /
+            g[d] + (particle_properties[PropertiesIndex::force_x + d] +
+                    particle_properties[PropertiesIndex::fem_force_x + d]) /
                      particle_properties[PropertiesIndex::mass];
 
           // Reinitializing force
@@ -14,6 +14,9 @@ Gear3Integrator<dim>::integrate_pre_force(
        particle != particle_handler.end();
        ++particle)
     {
+      if (this->is_sleeping(particle->get_id()))
+        continue;
+
       // Get the total array view to the particle properties once to improve
       // efficiency
       auto particle_properties = particle->get_properties();
@@ -54,6 +57,9 @@ Gear3Integrator<dim>::integrate_post_force(
        particle != particle_handler.end();
        ++particle)
     {
+      if (this->is_skipped_in_post_force(particle->get_id()))
+        continue;
+
       // Get the total array view to the particle properties once to improve
       // efficiency
       auto particle_properties = particle->get_properties();
@@ -64,7 +70,8 @@ Gear3Integrator<dim>::integrate_post_force(
         {
           // Finding corrected acceleration
           corrected_accereration[d] =
-            g[d] + particle_properties[PropertiesIndex::force_x + d] /
+            g[d] + (particle_properties[PropertiesIndex::force_x + d] +
+                    particle_properties[PropertiesIndex::fem_force_x + d]) /
                      particle_properties[PropertiesIndex::mass];
 
           // Reinitializing force
@@ -0,0 +1,166 @@
+#include <dem/ghost_particle_update.h>
+
+#include <map>
+
+using namespace DEM;
+
+template <int dim>
+GhostParticleUpdate<dim>::GhostParticleUpdate(const MPI_Comm &communicator)
+  : communicator(communicator)
+  , update_in_progress(false)
+{}
+
+template <int dim>
+void
+GhostParticleUpdate<dim>::build(
+  const Particles::ParticleHandler<dim> &           particle_handler,
+  const parallel::distributed::Triangulation<dim> &triangulation,
+  const std::unordered_map<int, Particles::ParticleIterator<dim>>
+    &particle_container)
+{
+  // A pending update refers to the ghost particles of the previous exchange
+  finish_update();
+
+  // Grouping the ghost particles by owner processor
+  std::map<unsigned int, std::vector<types::particle_index>> requested_ids;
+  std::map<unsigned int, std::vector<Particles::ParticleIterator<dim>>>
+    ghost_particles_of_owner;
+
+  for (auto ghost_particle = particle_handler.begin_ghost();
+       ghost_particle != particle_handler.end_ghost();
+       ++ghost_particle)
+    {
+      const unsigned int owner =
+        ghost_particle->get_surrounding_cell(triangulation)->subdomain_id();
+      requested_ids[owner].push_back(ghost_particle->get_id());
+      ghost_particles_of_owner[owner].push_back(ghost_particle);
+    }
+
+  // Each processor receives the ids of its local particles which are ghosts
+  // on the other processors, in the order in which they are unpacked
+  const std::map<unsigned int, std::vector<types::particle_index>> sent_ids =
+    Utilities::MPI::some_to_some(communicator, requested_ids);
+
+  source_ranks.clear();
+  ghost_particles.clear();
+  for (auto &[owner, ghost_particles_list] : ghost_particles_of_owner)
+    {
+      source_ranks.push_back(owner);
+      ghost_particles.push_back(std::move(ghost_particles_list));
+    }
+
+  destination_ranks.clear();
+  sent_particles.clear();
+  for (const auto &[destination, ids] : sent_ids)
+    {
+      std::vector<Particles::ParticleIterator<dim>> sent_particles_list;
+      sent_particles_list.reserve(ids.size());
+      for (const auto &id : ids)
+        sent_particles_list.push_back(particle_container.at(id));
+
+      destination_ranks.push_back(destination);
+      sent_particles.push_back(std::move(sent_particles_list));
+    }
+
+  // The buffers keep their capacity from one contact search to the other
+  send_buffers.resize(destination_ranks.size());
+  for (unsigned int i = 0; i < destination_ranks.size(); ++i)
+    send_buffers[i].resize(sent_particles[i].size() * n_fields_per_particle);
+
+  receive_buffers.resize(source_ranks.size());
+  for (unsigned int i = 0; i < source_ranks.size(); ++i)
+    receive_buffers[i].resize(ghost_particles[i].size() *
+                              n_fields_per_particle);
+
+  requests.resize(destination_ranks.size() + source_ranks.size());
+}
+
+template <int dim>
+void
+GhostParticleUpdate<dim>::start_update()
+{
+  AssertThrow(!update_in_progress,
+              ExcMessage("A ghost particle update is already in progress"));
+
+  // Posting the receives first
+  for (unsigned int i = 0; i < source_ranks.size(); ++i)
+    {
+      const int ierr = MPI_Irecv(receive_buffers[i].data(),
+                                 receive_buffers[i].size(),
+                                 MPI_DOUBLE,
+                                 source_ranks[i],
+                                 mpi_tag,
+                                 communicator,
+                                 &requests[i]);
+      AssertThrowMPI(ierr);
+    }
+
+  for (unsigned int i = 0; i < destination_ranks.size(); ++i)
+    {
+      double *buffer = send_buffers[i].data();
+      for (const auto &particle : sent_particles[i])
+        {
+          const Point<dim> location   = particle->get_location();
+          const auto       properties = particle->get_properties();
+
+          for (int d = 0; d < dim; ++d)
+            *buffer++ = location[d];
+
+          *buffer++ = properties[PropertiesIndex::v_x];
+          *buffer++ = properties[PropertiesIndex::v_y];
+          *buffer++ = properties[PropertiesIndex::v_z];
+          *buffer++ = properties[PropertiesIndex::omega_x];
+          *buffer++ = properties[PropertiesIndex::omega_y];
+          *buffer++ = properties[PropertiesIndex::omega_z];
+        }
+
+      const int ierr = MPI_Isend(send_buffers[i].data(),
+                                 send_buffers[i].size(),
+                                 MPI_DOUBLE,
+                                 destination_ranks[i],
+                                 mpi_tag,
+                                 communicator,
+                                 &requests[source_ranks.size() + i]);
+      AssertThrowMPI(ierr);
+    }
+
+  update_in_progress = true;
+}
+
+template <int dim>
+void
+GhostParticleUpdate<dim>::finish_update()
+{
+  if (!update_in_progress)
+    return;
+
+  const int ierr =
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+  AssertThrowMPI(ierr);
+
+  for (unsigned int i = 0; i < source_ranks.size(); ++i)
+    {
+      const double *buffer = receive_buffers[i].data();
+      for (auto &ghost_particle : ghost_particles[i])
+        {
+          Point<dim> location;
+          for (int d = 0; d < dim; ++d)
+            location[d] = *buffer++;
+          ghost_particle->set_location(location);
+
+          auto properties = ghost_particle->get_properties();
+
+          properties[PropertiesIndex::v_x]     = *buffer++;
+          properties[PropertiesIndex::v_y]     = *buffer++;
+          properties[PropertiesIndex::v_z]     = *buffer++;
+          properties[PropertiesIndex::omega_x] = *buffer++;
+          properties[PropertiesIndex::omega_y] = *buffer++;
+          properties[PropertiesIndex::omega_z] = *buffer++;
+        }
+    }
+
+  update_in_progress = false;
+}
+
+template class GhostParticleUpdate<2>;
+template class GhostParticleUpdate<3>;
@@ -19,6 +19,8 @@
 
 #include <dem/insertion.h>
 
+#include <cstdint>
+
 // Prints the insertion information
 template <int dim>
 void
@@ -36,127 +38,195 @@ Insertion<dim>::print_insertion_info(const unsigned int &inserted_this_step,
            "\n";
 }
 
-// Carries out assigning the properties of inserted particles. The output vector
-// is used in insert_global_particles as input argument
-template <int dim>
-void
-Insertion<dim>::assign_particle_properties(
-  const DEMSolverParameters<dim> &  dem_parameters,
-  const unsigned int &              inserted_this_step,
-  const unsigned int &              current_inserting_particle_type,
-  std::vector<std::vector<double>> &particle_properties,
-  const MPI_Comm &                  communicator)
+namespace
 {
-  // Distbuting particles between processors
-  if (Utilities::MPI::this_mpi_process(communicator) !=
-      (Utilities::MPI::n_mpi_processes(communicator) - 1))
-    inserted_this_step_this_proc =
-      floor(inserted_this_step / Utilities::MPI::n_mpi_processes(communicator));
-  else
-    inserted_this_step_this_proc =
-      inserted_this_step -
-      (Utilities::MPI::n_mpi_processes(communicator) - 1) *
-        floor(inserted_this_step /
-              Utilities::MPI::n_mpi_processes(communicator));
+  // Counter-based random number generator (SplitMix64 mixing function). The
+  // returned value only depends on the key and on the counter, hence the
+  // random numbers can be generated in any order and on any processor
+  inline std::uint64_t
+  counter_based_random_number(const std::uint64_t key,
+                              const std::uint64_t counter)
+  {
+    std::uint64_t z = key + (counter + 1) * 0x9E3779B97F4A7C15ULL;
+    z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z               = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
 
+  // Uniformly distributed random number in (0, 1]
+  inline double
+  counter_based_uniform_random_number(const std::uint64_t key,
+                                      const std::uint64_t counter)
+  {
+    return ((counter_based_random_number(key, counter) >> 11) + 1) /
+           9007199254740992.0;
+  }
+} // namespace
 
-  // Clearing and resizing particle_properties
-  particle_properties.clear();
-  particle_properties.reserve(inserted_this_step);
+// Carries out the insertion of the particles which are located in the locally
+// owned cells. The properties are written directly in the property pool of the
+// particle handler. The number of particles inserted by all the processors is
+// returned
+template <int dim>
+unsigned int
+Insertion<dim>::insert_particles_in_locally_owned_cells(
+  Particles::ParticleHandler<dim> &                particle_handler,
+  const parallel::distributed::Triangulation<dim> &triangulation,
+  const std::vector<Point<dim>> &                  insertion_points,
+  const DEMSolverParameters<dim> &                 dem_parameters,
+  const unsigned int &                             current_inserting_particle_type)
+{
+  if (!grid_cache)
+    grid_cache = std::make_shared<GridTools::Cache<dim>>(triangulation);
 
   // Getting properties as local parameters
-  // TODO: MAYBE CHANGE THE INPUT TO PHYSICAL PROPERTIES DIRECTLY
-  auto physical_properties = dem_parameters.physical_properties;
-
-  particle_size_sampling(
-    particle_sizes,
-    physical_properties
-      .particle_average_diameter[current_inserting_particle_type],
-    physical_properties.particle_size_std[current_inserting_particle_type],
-    inserted_this_step_this_proc);
-
-  // A loop is defined over the number of particles which are going to be
-  // inserted at this step
-  for (unsigned int particle_counter = 0;
-       particle_counter < inserted_this_step_this_proc;
-       ++particle_counter)
+  const auto & physical_properties = dem_parameters.physical_properties;
+  const double average_diameter =
+    physical_properties.particle_average_diameter.at(
+      current_inserting_particle_type);
+  const double standard_deviation =
+    physical_properties.particle_size_std.at(current_inserting_particle_type);
+  const double density =
+    physical_properties.density.at(current_inserting_particle_type);
+
+  // The bounding boxes of the locally owned cells are used to discard the
+  // points located on the other processors without searching the triangulation
+  const auto locally_owned_bounding_boxes =
+    GridTools::compute_mesh_predicate_bounding_box(
+      triangulation, IteratorFilters::LocallyOwnedCell());
+
+  // The ids of the inserted particles follow the order of the insertion points
+  const types::particle_index first_particle_id =
+    particle_handler.get_next_free_particle_index();
+
+  unsigned int n_inserted_particles = 0;
+
+  typename Triangulation<dim>::active_cell_iterator cell_hint;
+  for (unsigned int point_index = 0; point_index < insertion_points.size();
+       ++point_index)
     {
-      double type     = current_inserting_particle_type;
-      double diameter = 0.;
-      (particle_sizes[particle_counter] >= 0) ?
-        diameter = particle_sizes[particle_counter] :
-        -particle_sizes[particle_counter];
-      double density =
-        physical_properties.density[current_inserting_particle_type];
-      double vel_x        = 0.;
-      double vel_y        = 0.;
-      double vel_z        = 0.;
-      double acc_x        = 0.;
-      double acc_y        = 0.;
-      double acc_z        = 0.;
-      double f_x          = 0.;
-      double f_y          = 0.;
-      double f_z          = 0.;
-      double w_x          = 0.;
-      double w_y          = 0.;
-      double w_z          = 0.;
-      double mass         = density * (1.3333 * M_PI * (diameter * 0.5) *
-                               (diameter * 0.5) * (diameter * 0.5));
-      double MOI          = 0.4 * mass * (diameter * 0.5) * (diameter * 0.5);
-      double T_x          = 0.;
-      double T_y          = 0.;
-      double T_z          = 0.;
-      double displacement = 0.;
-      double acc_derivative_x = 0.;
-      double acc_derivative_y = 0.;
-      double acc_derivative_z = 0.;
-
-      std::vector<double> properties_of_one_particle{type,
-                                                     diameter,
-                                                     density,
-                                                     vel_x,
-                                                     vel_y,
-                                                     vel_z,
-                                                     acc_x,
-                                                     acc_y,
-                                                     acc_z,
-                                                     f_x,
-                                                     f_y,
-                                                     f_z,
-                                                     w_x,
-                                                     w_y,
-                                                     w_z,
-                                                     mass,
-                                                     MOI,
-                                                     T_x,
-                                                     T_y,
-                                                     T_z,
-                                                     displacement,
-                                                     acc_derivative_x,
-                                                     acc_derivative_y,
-                                                     acc_derivative_z};
-
-      particle_properties.push_back(properties_of_one_particle);
-      properties_of_one_particle.clear();
+      const Point<dim> &insertion_point = insertion_points[point_index];
+
+      bool point_in_locally_owned_box = false;
+      for (const auto &bounding_box : locally_owned_bounding_boxes)
+        if (bounding_box.point_inside(insertion_point))
+          {
+            point_in_locally_owned_box = true;
+            break;
+          }
+
+      if (!point_in_locally_owned_box)
+        continue;
+
+      // Consecutive insertion points are neighbors, the cell of the previous
+      // point is used as a hint
+      const auto first_cell_and_reference_location =
+        GridTools::find_active_cell_around_point(*grid_cache,
+                                                 insertion_point,
+                                                 cell_hint);
+
+      if (first_cell_and_reference_location.first.state() !=
+            IteratorState::valid ||
+          first_cell_and_reference_location.first->is_artificial())
+        continue;
+
+      // A point lying on a face or a vertex between the cells of several
+      // processors is inserted by the processor with the lowest rank among the
+      // owners of these cells. All the cells around the point are either
+      // locally owned or ghost cells, hence all the processors agree on the
+      // owner of the point
+      const auto cells_and_reference_locations =
+        GridTools::find_all_active_cells_around_point(
+          grid_cache->get_mapping(),
+          grid_cache->get_triangulation(),
+          insertion_point,
+          1e-10,
+          first_cell_and_reference_location);
+
+      auto cell_and_reference_location = first_cell_and_reference_location;
+      for (const auto &candidate : cells_and_reference_locations)
+        if (!candidate.first->is_artificial() &&
+            candidate.first->subdomain_id() <
+              cell_and_reference_location.first->subdomain_id())
+          cell_and_reference_location = candidate;
+
+      const auto &cell = cell_and_reference_location.first;
+      if (!cell->is_locally_owned())
+        continue;
+      cell_hint = cell;
+
+      const types::particle_index particle_id = first_particle_id + point_index;
+
+      Particles::Particle<dim> particle(insertion_point,
+                                        cell_and_reference_location.second,
+                                        particle_id);
+      Particles::ParticleIterator<dim> particle_iterator =
+        particle_handler.insert_particle(particle, cell);
+      ++n_inserted_particles;
+
+      const double diameter =
+        particle_size_sampling(average_diameter,
+                               standard_deviation,
+                               dem_parameters.insertion_info.random_number_seed,
+                               particle_id);
+      const double mass = density * (1.3333 * M_PI * (diameter * 0.5) *
+                                     (diameter * 0.5) * (diameter * 0.5));
+
+      // The velocity, acceleration, contact and fluid forces, angular
+      // velocity, torque and displacement of the inserted particles are zero
+      auto particle_properties = particle_iterator->get_properties();
+      for (unsigned int property = 0; property < particle_properties.size();
+           ++property)
+        particle_properties[property] = 0.;
+
+      particle_properties[DEM::PropertiesIndex::type] =
+        current_inserting_particle_type;
+      particle_properties[DEM::PropertiesIndex::dp]   = diameter;
+      particle_properties[DEM::PropertiesIndex::rho]  = density;
+      particle_properties[DEM::PropertiesIndex::mass] = mass;
+      particle_properties[DEM::PropertiesIndex::mom_inertia] =
+        0.4 * mass * (diameter * 0.5) * (diameter * 0.5);
     }
+
+  // Updating the global number of particles and the next free particle index
+  particle_handler.update_cached_numbers();
+
+  n_inserted_particles =
+    Utilities::MPI::sum(n_inserted_particles, triangulation.get_communicator());
+
+  Assert(n_inserted_particles == insertion_points.size(),
+         ExcMessage("Each insertion point must be inserted by exactly one "
+                    "processor. Some insertion points may lie outside the "
+                    "triangulation."));
+
+  return n_inserted_particles;
 }
 
 template <int dim>
-void
-Insertion<dim>::particle_size_sampling(std::vector<double> &particle_sizes,
-                                       const double &       average,
-                                       const double &       standard_deviation,
-                                       const double &       particle_number)
+double
+Insertion<dim>::particle_size_sampling(
+  const double &               average,
+  const double &               standard_deviation,
+  const int &                  random_number_seed,
+  const types::particle_index &particle_id)
 {
-  particle_sizes.clear();
-  particle_sizes.reserve(particle_number);
+  if (standard_deviation == 0)
+    return average;
+
+  // Box-Muller transform of two uniform random numbers, each particle uses
+  // its own pair of counters
+  const std::uint64_t key = random_number_seed;
+  const double        u_1 =
+    counter_based_uniform_random_number(key, 2 * std::uint64_t(particle_id));
+  const double u_2 =
+    counter_based_uniform_random_number(key,
+                                        2 * std::uint64_t(particle_id) + 1);
 
-  std::random_device         rd{};
-  std::mt19937               gen{rd()};
-  std::normal_distribution<> distribution{average, standard_deviation};
+  const double sampled_diameter =
+    average + standard_deviation * std::sqrt(-2. * std::log(u_1)) *
+                std::cos(2. * M_PI * u_2);
 
-  for (unsigned int n = 0; n < particle_number; ++n)
-    particle_sizes.push_back(distribution(gen));
+  return std::abs(sampled_diameter);
 }
 
 template <int dim>
@@ -222,33 +292,5 @@ Insertion<dim>::calculate_insertion_domain_maximum_particle_number(
     }
 }
 
-template <>
-bool
-Insertion<3>::particle_on_processor(const unsigned int &i,
-                                    const unsigned int &j,
-                                    const unsigned int &k,
-                                    const unsigned int &this_mpi_process,
-                                    const unsigned int &number_of_processors)
-{
-  return (std::floor((i * this->number_of_particles_y_direction *
-                        this->number_of_particles_z_direction +
-                      j * this->number_of_particles_z_direction + k) /
-                     (std::ceil(this->inserted_this_step /
-                                number_of_processors))) == this_mpi_process);
-}
-
-template <>
-bool
-Insertion<2>::particle_on_processor(const unsigned int &i,
-                                    const unsigned int &j,
-                                    const unsigned int & /*k*/,
-                                    const unsigned int &this_mpi_process,
-                                    const unsigned int &number_of_processors)
-{
-  return (std::floor((i * this->number_of_particles_y_direction + j) /
-                     (std::ceil(this->inserted_this_step /
-                                number_of_processors))) == this_mpi_process);
-}
-
 template class Insertion<2>;
 template class Insertion<3>;
@@ -22,8 +22,8 @@ NonUniformInsertion<dim>::NonUniformInsertion(
   this->maximum_diameter = maximum_particle_diameter;
 }
 
-// The main insertion function. Insert_global_function is utilized to insert the
-// particles
+// The main insertion function. The insertion points are identical on all the
+// processors, each processor inserts the particles located in its cells
 template <int dim>
 void
 NonUniformInsertion<dim>::insert(
@@ -43,8 +43,7 @@ NonUniformInsertion<dim>::insert(
   // Check to see if the remained uninserted particles is equal to zero or not
   if (remained_particles_of_each_type != 0)
     {
-      MPI_Comm           communicator = triangulation.get_communicator();
-      ConditionalOStream pcout        = {
+      ConditionalOStream pcout = {
         std::cout, Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0};
 
       this->calculate_insertion_domain_maximum_particle_number(dem_parameters,
@@ -55,41 +54,27 @@ NonUniformInsertion<dim>::insert(
       this->inserted_this_step =
         std::min(remained_particles_of_each_type, this->inserted_this_step);
 
-      // Obtaining global bounding boxes
-      const auto my_bounding_box =
-        GridTools::compute_mesh_predicate_bounding_box(
-          triangulation, IteratorFilters::LocallyOwnedCell());
-      const auto global_bounding_boxes =
-        Utilities::MPI::all_gather(communicator, my_bounding_box);
-
-      //  unsigned int this_mpi_process =
-      //    Utilities::MPI::this_mpi_process(communicator);
-
       // Finding insertion points using assign_insertion_points function
       std::vector<Point<dim>> insertion_points;
       insertion_points.reserve(this->inserted_this_step);
       this->assign_insertion_points(insertion_points,
-                                    dem_parameters.insertion_info,
-                                    communicator);
-
-      // Assigning inserted particles properties using
-      // assign_particle_properties function
-      this->particle_properties.reserve(this->inserted_this_step);
-      this->assign_particle_properties(dem_parameters,
-                                       this->inserted_this_step,
-                                       current_inserting_particle_type,
-                                       this->particle_properties,
-                                       communicator);
-
-      // Insert the particles using the points and assigned properties
-      particle_handler.insert_global_particles(insertion_points,
-                                               global_bounding_boxes,
-                                               this->particle_properties);
-
-      // Updating remaining particles
-      remained_particles_of_each_type -= this->inserted_this_step;
-
-      this->print_insertion_info(this->inserted_this_step,
+                                    dem_parameters.insertion_info);
+
+      // Inserting the particles located in the locally owned cells and
+      // assigning their properties
+      const unsigned int n_inserted_particles =
+        this->insert_particles_in_locally_owned_cells(
+          particle_handler,
+          triangulation,
+          insertion_points,
+          dem_parameters,
+          current_inserting_particle_type);
+
+      // Updating remaining particles. Each insertion point is inserted by
+      // exactly one processor, hence this is the number of insertion points
+      remained_particles_of_each_type -= n_inserted_particles;
+
+      this->print_insertion_info(n_inserted_particles,
                                  remained_particles_of_each_type,
                                  current_inserting_particle_type,
                                  pcout);
@@ -113,13 +98,13 @@ NonUniformInsertion<dim>::create_random_number_container(
     }
 }
 
-// This function assigns the insertion points of the inserted particles
+// This function assigns the insertion points of the inserted particles. All the
+// processors generate the same points, hence no communication is required
 template <int dim>
 void
 NonUniformInsertion<dim>::assign_insertion_points(
   std::vector<Point<dim>> &                    insertion_positions,
-  const Parameters::Lagrangian::InsertionInfo &insertion_information,
-  const MPI_Comm &                             communicator)
+  const Parameters::Lagrangian::InsertionInfo &insertion_information)
 {
   // Calling random number generator
   std::vector<double> random_number_vector;
@@ -129,69 +114,46 @@ NonUniformInsertion<dim>::assign_insertion_points(
     insertion_information.random_number_range,
     insertion_information.random_number_seed);
 
-  unsigned int this_mpi_process =
-    Utilities::MPI::this_mpi_process(communicator);
-
-  // Creating a particle counter
-  unsigned int particle_counter     = 0;
-  unsigned int particle_counter_sum = 0;
+  // Adapt the last index to the dimensionality of the problem
+  const unsigned int dim_nz =
+    (dim == 3) ? this->number_of_particles_z_direction : 1;
 
   for (unsigned int i = 0; i < this->number_of_particles_x_direction; ++i)
     for (unsigned int j = 0; j < this->number_of_particles_y_direction; ++j)
-      {
-        // Adapt the last index to the dimensionality of the problem
-        unsigned int dim_nz =
-          (dim == 3) ? this->number_of_particles_z_direction : 1;
-        for (unsigned int k = 0; k < dim_nz; ++k)
-          {
-            if (this->particle_on_processor(i,
-                                            j,
-                                            k,
-                                            this_mpi_process,
-                                            Utilities::MPI::n_mpi_processes(
-                                              communicator)))
-              {
-                // We need to check if the number of inserted particles so far
-                // at this step (particle_counter) reached the total desired
-                // number of inserted particles at this step
-                particle_counter_sum =
-                  Utilities::MPI::sum(particle_counter, communicator);
-
-                if (particle_counter_sum < this->inserted_this_step)
-                  {
-                    Point<dim> position;
-                    // Obtaning position of the inserted particle
-                    // In non-uniform insertion, random numbers were created and
-                    // are added to the position of particles. In order to
-                    // create more randomness, the random vector is read once
-                    // from the beginning and once from the end to be used in
-                    // positions [0] and [1]
-                    position[0] =
-                      insertion_information.x_min +
-                      ((i + 0.5) * insertion_information.distance_threshold -
-                       random_number_vector[particle_counter]) *
-                        this->maximum_diameter;
-                    position[1] =
-                      insertion_information.y_min +
-                      ((j + 0.5) * insertion_information.distance_threshold -
-                       random_number_vector[this->inserted_this_step -
-                                            particle_counter - 1]) *
-                        this->maximum_diameter;
-                    if (dim == 3)
-                      {
-                        position[2] =
-                          insertion_information.z_min +
-                          ((k + 0.5) *
-                             insertion_information.distance_threshold -
-                           random_number_vector[particle_counter]) *
-                            this->maximum_diameter;
-                      }
-                    insertion_positions.push_back(position);
-                    particle_counter++;
-                  }
-              }
-          }
-      }
+      for (unsigned int k = 0; k < dim_nz; ++k)
+        {
+          // We need to check if the number of inserted particles so far at
+          // this step (particle_counter) reached the total desired number of
+          // inserted particles at this step
+          const unsigned int particle_counter = insertion_positions.size();
+          if (particle_counter >= this->inserted_this_step)
+            return;
+
+          Point<dim> position;
+          // Obtaning position of the inserted particle
+          // In non-uniform insertion, random numbers were created and are
+          // added to the position of particles. In order to create more
+          // randomness, the random vector is read once from the beginning and
+          // once from the end to be used in positions [0] and [1]
+          position[0] = insertion_information.x_min +
+                        ((i + 0.5) * insertion_information.distance_threshold -
+                         random_number_vector[particle_counter]) *
+                          this->maximum_diameter;
+          position[1] = insertion_information.y_min +
+                        ((j + 0.5) * insertion_information.distance_threshold -
+                         random_number_vector[this->inserted_this_step -
+                                              particle_counter - 1]) *
+                          this->maximum_diameter;
+          if (dim == 3)
+            {
+              position[2] =
+                insertion_information.z_min +
+                ((k + 0.5) * insertion_information.distance_threshold -
+                 random_number_vector[particle_counter]) *
+                  this->maximum_diameter;
+            }
+          insertion_positions.push_back(position);
+        }
 }
 
 template class NonUniformInsertion<2>;
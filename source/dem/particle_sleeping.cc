@@ -0,0 +1,481 @@
+#include <dem/particle_sleeping.h>
+
+using namespace DEM;
+
+template <int dim>
+ParticleSleeping<dim>::ParticleSleeping(
+  const DEMSolverParameters<dim> &dem_parameters)
+  : velocity_threshold(
+      dem_parameters.model_parameters.sleeping_velocity_threshold)
+  , acceleration_threshold(
+      dem_parameters.model_parameters.sleeping_acceleration_threshold)
+  , sleeping_steps(dem_parameters.model_parameters.sleeping_steps)
+{
+  // Particles in contact with a moving wall are continuously driven by the
+  // wall and must never sleep
+  for (auto const &[boundary_id, velocity] :
+       dem_parameters.boundary_motion.boundary_translational_velocity)
+    {
+      if (velocity.norm() > 0)
+        moving_boundaries.insert(boundary_id);
+    }
+  for (auto const &[boundary_id, rotational_speed] :
+       dem_parameters.boundary_motion.boundary_rotational_speed)
+    {
+      if (rotational_speed != 0)
+        moving_boundaries.insert(boundary_id);
+    }
+}
+
+template <int dim>
+void
+ParticleSleeping<dim>::wake_up_particle(ArrayView<double> &particle_properties,
+                                        const int          particle_id)
+{
+  sleeping_particles.erase(particle_id);
+  steps_at_rest[particle_id] = 0;
+
+  for (int d = 0; d < dim; ++d)
+    {
+      particle_properties[PropertiesIndex::force_x + d] = 0;
+      particle_properties[PropertiesIndex::M_x + d]     = 0;
+    }
+}
+
+template <int dim>
+void
+ParticleSleeping<dim>::put_particle_to_sleep(
+  ArrayView<double> &particle_properties,
+  const int          particle_id)
+{
+  sleeping_particles.insert(particle_id);
+  steps_at_rest.erase(particle_id);
+
+  for (int d = 0; d < dim; ++d)
+    {
+      particle_properties[PropertiesIndex::v_x + d]              = 0;
+      particle_properties[PropertiesIndex::omega_x + d]          = 0;
+      particle_properties[PropertiesIndex::acc_x + d]            = 0;
+      particle_properties[PropertiesIndex::acc_derivative_x + d] = 0;
+      particle_properties[PropertiesIndex::force_x + d]          = 0;
+      particle_properties[PropertiesIndex::M_x + d]              = 0;
+    }
+}
+
+template <int dim>
+void
+ParticleSleeping<dim>::update_sleeping_particles(
+  Particles::ParticleHandler<dim> &particle_handler,
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    &local_adjacent_particles,
+  const std::unordered_map<
+    int,
+    std::unordered_map<int, pp_contact_info_struct<dim>>>
+    &ghost_adjacent_particles,
+  std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+    &pw_pairs_in_contact,
+  const std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+    &pfw_pairs_in_contact,
+  const std::unordered_map<int, particle_point_line_contact_info_struct<dim>>
+    &particle_points_in_contact,
+  const std::unordered_map<int, particle_point_line_contact_info_struct<dim>>
+    &particle_lines_in_contact)
+{
+  const double velocity_threshold_squared =
+    velocity_threshold * velocity_threshold;
+  const double acceleration_threshold_squared =
+    acceleration_threshold * acceleration_threshold;
+
+  auto is_moving = [&](const ArrayView<const double> &particle_properties) {
+    double velocity_squared = 0;
+    for (int d = 0; d < dim; ++d)
+      velocity_squared += particle_properties[PropertiesIndex::v_x + d] *
+                          particle_properties[PropertiesIndex::v_x + d];
+    return velocity_squared > velocity_threshold_squared;
+  };
+
+  // 1. Waking up the sleeping particles which are adjacent to an awake particle
+  // moving faster than the velocity threshold. Only the active pairs can
+  // contain an awake particle, the dormant pairs only contain sleeping
+  // particles
+  bool particles_woken_up = false;
+  auto wake_up_if_sleeping = [&](Particles::ParticleIterator<dim> particle) {
+    if (sleeping_particles.count(particle->get_id()) > 0)
+      {
+        auto particle_properties = particle->get_properties();
+        wake_up_particle(particle_properties, particle->get_id());
+        particles_woken_up = true;
+      }
+  };
+
+  for (auto &&adjacent_particles_list :
+       local_adjacent_particles | boost::adaptors::map_values)
+    {
+      for (auto &&contact_info :
+           adjacent_particles_list | boost::adaptors::map_values)
+        {
+          auto      particle_one    = contact_info.particle_one;
+          auto      particle_two    = contact_info.particle_two;
+          const int particle_one_id = particle_one->get_id();
+          const int particle_two_id = particle_two->get_id();
+
+          const bool particle_one_sleeping =
+            sleeping_particles.count(particle_one_id) > 0;
+          const bool particle_two_sleeping =
+            sleeping_particles.count(particle_two_id) > 0;
+
+          if (particle_one_sleeping == particle_two_sleeping)
+            continue;
+
+          auto sleeping_particle =
+            particle_one_sleeping ? particle_one : particle_two;
+          auto awake_particle =
+            particle_one_sleeping ? particle_two : particle_one;
+
+          if (is_moving(awake_particle->get_properties()))
+            wake_up_if_sleeping(sleeping_particle);
+        }
+    }
+
+  // The ghost particles are never asleep, since their sleeping state is only
+  // known by their owner processor. Particle one of the local-ghost pairs is
+  // the local particle
+  for (auto &&adjacent_particles_list :
+       ghost_adjacent_particles | boost::adaptors::map_values)
+    {
+      for (auto &&contact_info :
+           adjacent_particles_list | boost::adaptors::map_values)
+        {
+          if (is_moving(contact_info.particle_two->get_properties()))
+            wake_up_if_sleeping(contact_info.particle_one);
+        }
+    }
+
+  // The floating walls and the moving walls drive the particles in contact with
+  // them, these particles are woken up regardless of the wall velocity
+  for (auto &&pairs_in_contact :
+       pfw_pairs_in_contact | boost::adaptors::map_values)
+    {
+      for (auto &&contact_information :
+           pairs_in_contact | boost::adaptors::map_values)
+        wake_up_if_sleeping(contact_information.particle);
+    }
+
+  if (!moving_boundaries.empty())
+    {
+      auto wake_up_moving_wall_contacts =
+        [&](std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+              &pairs_in_contact) {
+          for (auto &&particle_pairs :
+               pairs_in_contact | boost::adaptors::map_values)
+            {
+              for (auto &&contact_information :
+                   particle_pairs | boost::adaptors::map_values)
+                if (moving_boundaries.count(contact_information.boundary_id) >
+                    0)
+                  wake_up_if_sleeping(contact_information.particle);
+            }
+        };
+
+      // The walls found by the last contact search are in the active
+      // container, the previous ones of the sleeping particles are dormant
+      wake_up_moving_wall_contacts(pw_pairs_in_contact);
+      wake_up_moving_wall_contacts(dormant_pw_contacts);
+    }
+
+  // The dormant contacts of the particles which were woken up are restored
+  if (particles_woken_up)
+    {
+      for (auto dormant_iterator = dormant_pp_contacts.begin();
+           dormant_iterator != dormant_pp_contacts.end();)
+        {
+          const int particle_one_id = dormant_iterator->first;
+          auto &    dormant_pairs   = dormant_iterator->second;
+          for (auto pair_iterator = dormant_pairs.begin();
+               pair_iterator != dormant_pairs.end();)
+            {
+              if (sleeping_particles.count(particle_one_id) == 0 ||
+                  sleeping_particles.count(pair_iterator->first) == 0)
+                {
+                  local_adjacent_particles[particle_one_id].insert(
+                    *pair_iterator);
+                  pair_iterator = dormant_pairs.erase(pair_iterator);
+                }
+              else
+                ++pair_iterator;
+            }
+
+          if (dormant_pairs.empty())
+            dormant_iterator = dormant_pp_contacts.erase(dormant_iterator);
+          else
+            ++dormant_iterator;
+        }
+
+      for (auto dormant_iterator = dormant_pw_contacts.begin();
+           dormant_iterator != dormant_pw_contacts.end();)
+        {
+          if (sleeping_particles.count(dormant_iterator->first) == 0)
+            {
+              pw_pairs_in_contact[dormant_iterator->first].insert(
+                dormant_iterator->second.begin(),
+                dormant_iterator->second.end());
+              dormant_iterator = dormant_pw_contacts.erase(dormant_iterator);
+            }
+          else
+            ++dormant_iterator;
+        }
+    }
+
+  // 2. Updating the number of consecutive steps at rest of the awake particles.
+  // The force and torque exerted by the awake neighbors on the sleeping
+  // particles are discarded, since these are not reset by the integrator
+  std::vector<Particles::ParticleIterator<dim>> sleeping_candidates;
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle)
+    {
+      const int particle_id         = particle->get_id();
+      auto      particle_properties = particle->get_properties();
+
+      if (sleeping_particles.count(particle_id) > 0)
+        {
+          for (int d = 0; d < dim; ++d)
+            {
+              particle_properties[PropertiesIndex::force_x + d] = 0;
+              particle_properties[PropertiesIndex::M_x + d]     = 0;
+            }
+          continue;
+        }
+
+      double velocity_squared     = 0;
+      double acceleration_squared = 0;
+      double omega_squared        = 0;
+      for (int d = 0; d < dim; ++d)
+        {
+          velocity_squared += particle_properties[PropertiesIndex::v_x + d] *
+                              particle_properties[PropertiesIndex::v_x + d];
+          acceleration_squared +=
+            particle_properties[PropertiesIndex::acc_x + d] *
+            particle_properties[PropertiesIndex::acc_x + d];
+          omega_squared += particle_properties[PropertiesIndex::omega_x + d] *
+                           particle_properties[PropertiesIndex::omega_x + d];
+        }
+      const double radius = 0.5 * particle_properties[PropertiesIndex::dp];
+
+      bool at_rest =
+        velocity_squared < velocity_threshold_squared &&
+        omega_squared * radius * radius < velocity_threshold_squared &&
+        acceleration_squared < acceleration_threshold_squared;
+
+      // Particles in contact with ghost particles, floating walls, boundary
+      // points and lines never sleep
+      if (at_rest)
+        {
+          auto ghost_pairs = ghost_adjacent_particles.find(particle_id);
+          auto pfw_pairs   = pfw_pairs_in_contact.find(particle_id);
+          at_rest =
+            (ghost_pairs == ghost_adjacent_particles.end() ||
+             ghost_pairs->second.empty()) &&
+            (pfw_pairs == pfw_pairs_in_contact.end() ||
+             pfw_pairs->second.empty()) &&
+            particle_points_in_contact.count(particle_id) == 0 &&
+            particle_lines_in_contact.count(particle_id) == 0;
+        }
+
+      // Neither do the particles in contact with moving walls
+      if (at_rest && !moving_boundaries.empty())
+        {
+          auto pw_pairs = pw_pairs_in_contact.find(particle_id);
+          if (pw_pairs != pw_pairs_in_contact.end())
+            for (auto &&contact_information :
+                 pw_pairs->second | boost::adaptors::map_values)
+              if (moving_boundaries.count(contact_information.boundary_id) > 0)
+                at_rest = false;
+        }
+
+      unsigned int &particle_steps_at_rest = steps_at_rest[particle_id];
+      particle_steps_at_rest = at_rest ? particle_steps_at_rest + 1 : 0;
+
+      if (particle_steps_at_rest >= sleeping_steps)
+        sleeping_candidates.push_back(particle);
+    }
+
+  // 3. A particle only goes to sleep if all its neighbors are at rest or
+  // sleeping
+  auto is_ready_to_sleep = [&](const int particle_id) {
+    if (sleeping_particles.count(particle_id) > 0)
+      return true;
+    auto particle_steps = steps_at_rest.find(particle_id);
+    return particle_steps != steps_at_rest.end() &&
+           particle_steps->second >= sleeping_steps;
+  };
+
+  std::unordered_set<int> particles_with_active_neighbors;
+  if (!sleeping_candidates.empty())
+    {
+      for (auto &&adjacent_particles_list :
+           local_adjacent_particles | boost::adaptors::map_values)
+        {
+          for (auto &&contact_info :
+               adjacent_particles_list | boost::adaptors::map_values)
+            {
+              const int particle_one_id = contact_info.particle_one->get_id();
+              const int particle_two_id = contact_info.particle_two->get_id();
+
+              if (!is_ready_to_sleep(particle_one_id))
+                particles_with_active_neighbors.insert(particle_two_id);
+              if (!is_ready_to_sleep(particle_two_id))
+                particles_with_active_neighbors.insert(particle_one_id);
+            }
+        }
+    }
+
+  for (auto &particle : sleeping_candidates)
+    {
+      const int particle_id = particle->get_id();
+      if (particles_with_active_neighbors.count(particle_id) == 0)
+        {
+          auto particle_properties = particle->get_properties();
+          put_particle_to_sleep(particle_properties, particle_id);
+        }
+    }
+
+  // 4. Moving the contacts of the sleeping particles to the dormant containers
+  if (sleeping_particles.empty())
+    return;
+
+  for (auto &[particle_one_id, adjacent_particles_list] :
+       local_adjacent_particles)
+    {
+      if (sleeping_particles.count(particle_one_id) == 0)
+        continue;
+
+      for (auto pair_iterator = adjacent_particles_list.begin();
+           pair_iterator != adjacent_particles_list.end();)
+        {
+          if (sleeping_particles.count(pair_iterator->first) > 0)
+            {
+              dormant_pp_contacts[particle_one_id].insert(*pair_iterator);
+              pair_iterator = adjacent_particles_list.erase(pair_iterator);
+            }
+          else
+            ++pair_iterator;
+        }
+    }
+
+  for (auto &[particle_id, pairs_in_contact] : pw_pairs_in_contact)
+    {
+      if (!pairs_in_contact.empty() &&
+          sleeping_particles.count(particle_id) > 0)
+        {
+          dormant_pw_contacts[particle_id].insert(pairs_in_contact.begin(),
+                                                  pairs_in_contact.end());
+          pairs_in_contact.clear();
+        }
+    }
+}
+
+template <int dim>
+void
+ParticleSleeping<dim>::restore_dormant_contacts(
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    &local_adjacent_particles,
+  std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+    &pw_pairs_in_contact)
+{
+  for (auto &[particle_one_id, dormant_pairs] : dormant_pp_contacts)
+    local_adjacent_particles[particle_one_id].insert(dormant_pairs.begin(),
+                                                     dormant_pairs.end());
+
+  for (auto &[particle_id, dormant_pairs] : dormant_pw_contacts)
+    pw_pairs_in_contact[particle_id].insert(dormant_pairs.begin(),
+                                            dormant_pairs.end());
+
+  dormant_pp_contacts.clear();
+  dormant_pw_contacts.clear();
+}
+
+template <int dim>
+void
+ParticleSleeping<dim>::wake_up_all_particles(
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    &local_adjacent_particles,
+  std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+    &pw_pairs_in_contact)
+{
+  restore_dormant_contacts(local_adjacent_particles, pw_pairs_in_contact);
+
+  // The force and torque of the sleeping particles were reset at the end of
+  // the previous step, hence only the containers are cleared
+  sleeping_particles.clear();
+  steps_at_rest.clear();
+}
+
+template <int dim>
+void
+ParticleSleeping<dim>::remove_lost_particles(
+  const Particles::ParticleHandler<dim> &particle_handler)
+{
+  if (sleeping_particles.empty() && steps_at_rest.empty())
+    return;
+
+  std::unordered_set<int> local_particles;
+  local_particles.reserve(particle_handler.n_locally_owned_particles());
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle)
+    local_particles.insert(particle->get_id());
+
+  for (auto particle_iterator = sleeping_particles.begin();
+       particle_iterator != sleeping_particles.end();)
+    {
+      if (local_particles.count(*particle_iterator) == 0)
+        particle_iterator = sleeping_particles.erase(particle_iterator);
+      else
+        ++particle_iterator;
+    }
+
+  for (auto particle_iterator = steps_at_rest.begin();
+       particle_iterator != steps_at_rest.end();)
+    {
+      if (local_particles.count(particle_iterator->first) == 0)
+        particle_iterator = steps_at_rest.erase(particle_iterator);
+      else
+        ++particle_iterator;
+    }
+
+  // The dormant contacts of the lost particles refer to removed particles
+  for (auto dormant_iterator = dormant_pp_contacts.begin();
+       dormant_iterator != dormant_pp_contacts.end();)
+    {
+      auto &dormant_pairs = dormant_iterator->second;
+      if (local_particles.count(dormant_iterator->first) == 0)
+        dormant_pairs.clear();
+
+      for (auto pair_iterator = dormant_pairs.begin();
+           pair_iterator != dormant_pairs.end();)
+        {
+          if (local_particles.count(pair_iterator->first) == 0)
+            pair_iterator = dormant_pairs.erase(pair_iterator);
+          else
+            ++pair_iterator;
+        }
+
+      if (dormant_pairs.empty())
+        dormant_iterator = dormant_pp_contacts.erase(dormant_iterator);
+      else
+        ++dormant_iterator;
+    }
+
+  for (auto dormant_iterator = dormant_pw_contacts.begin();
+       dormant_iterator != dormant_pw_contacts.end();)
+    {
+      if (local_particles.count(dormant_iterator->first) == 0)
+        dormant_iterator = dormant_pw_contacts.erase(dormant_iterator);
+      else
+        ++dormant_iterator;
+    }
+}
+
+template class ParticleSleeping<2>;
+template class ParticleSleeping<3>;
@@ -1,5 +1,7 @@
 #include <dem/pp_broad_search.h>
 
+#include <algorithm>
+
 using namespace dealii;
 
 template <int dim>
@@ -191,5 +193,241 @@ PPBroadSearch<dim>::find_particle_particle_contact_pairs(
     }
 }
 
+template <int dim>
+const typename PPBroadSearch<dim>::cell_size_classes &
+PPBroadSearch<dim>::get_cell_size_classes(
+  dealii::Particles::ParticleHandler<dim> &                particle_handler,
+  const typename Triangulation<dim>::active_cell_iterator &cell,
+  const double maximum_particle_radius)
+{
+  const unsigned int cell_index = cell->active_cell_index();
+  AssertIndexRange(cell_index, size_classes_of_cells.size());
+
+  cell_size_classes &size_classes = size_classes_of_cells[cell_index];
+
+  // The size classes were already built during this search
+  if (size_classes.search_stamp == current_search_stamp)
+    return size_classes;
+
+  if (size_classes.particles.empty())
+    {
+      size_classes.particles.resize(n_size_classes);
+      size_classes.maximum_radius.resize(n_size_classes);
+    }
+
+  size_classes.search_stamp = current_search_stamp;
+  size_classes.n_particles  = 0;
+  size_classes.bounding_box = cell->bounding_box();
+  for (unsigned int size_class = 0; size_class < n_size_classes; ++size_class)
+    {
+      // The capacity of the vectors is kept from one search to the other
+      size_classes.particles[size_class].clear();
+      size_classes.maximum_radius[size_class] = 0;
+    }
+
+  typename Particles::ParticleHandler<dim>::particle_iterator_range
+    particles_in_cell = particle_handler.particles_in_cell(cell);
+
+  for (auto particle = particles_in_cell.begin();
+       particle != particles_in_cell.end();
+       ++particle)
+    {
+      const double radius =
+        0.5 * particle->get_properties()[DEM::PropertiesIndex::dp];
+
+      // The radii of the particles of class c are in the range
+      // (maximum radius / 2^(c+1), maximum radius / 2^c]
+      unsigned int size_class = 0;
+      while (size_class < n_size_classes - 1 &&
+             radius * (1 << (size_class + 1)) <= maximum_particle_radius)
+        ++size_class;
+
+      size_classes.particles[size_class].push_back(
+        {static_cast<int>(particle->get_id()),
+         particle->get_location(),
+         radius});
+      size_classes.maximum_radius[size_class] =
+        std::max(size_classes.maximum_radius[size_class], radius);
+      ++size_classes.n_particles;
+    }
+
+  return size_classes;
+}
+
+template <int dim>
+void
+PPBroadSearch<dim>::add_candidates_in_neighbor_cell(
+  const particle_search_info &main_particle,
+  const cell_size_classes &   neighbor_cell,
+  const double                contact_search_skin,
+  std::vector<int> &          particle_candidate_container)
+{
+  // Squared distance between the main particle and the bounding box of the
+  // neighbor cell
+  const auto &box_corners  = neighbor_cell.bounding_box.get_boundary_points();
+  double      box_distance = 0;
+  for (int d = 0; d < dim; ++d)
+    {
+      const double gap =
+        std::max({0.,
+                  box_corners.first[d] - main_particle.location[d],
+                  main_particle.location[d] - box_corners.second[d]});
+      box_distance += gap * gap;
+    }
+
+  for (unsigned int size_class = 0; size_class < n_size_classes; ++size_class)
+    {
+      const auto &particles_in_class = neighbor_cell.particles[size_class];
+      if (particles_in_class.empty())
+        continue;
+
+      // None of the particles of this class can reach the main particle
+      const double class_cutoff = main_particle.radius +
+                                  neighbor_cell.maximum_radius[size_class] +
+                                  contact_search_skin;
+      if (box_distance >= class_cutoff * class_cutoff)
+        continue;
+
+      for (const auto &neighbor_particle : particles_in_class)
+        {
+          const double pair_cutoff = main_particle.radius +
+                                     neighbor_particle.radius +
+                                     contact_search_skin;
+          if (main_particle.location.distance_square(
+                neighbor_particle.location) < pair_cutoff * pair_cutoff)
+            particle_candidate_container.emplace_back(neighbor_particle.id);
+        }
+    }
+}
+
+template <int dim>
+void
+PPBroadSearch<dim>::find_particle_particle_contact_pairs_polydisperse(
+  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const std::vector<
+    std::vector<typename Triangulation<dim>::active_cell_iterator>>
+    *cells_local_neighbor_list,
+  const std::vector<
+    std::vector<typename Triangulation<dim>::active_cell_iterator>>
+    *                                        cells_ghost_neighbor_list,
+  const double                               maximum_particle_diameter,
+  const double                               contact_search_skin,
+  std::unordered_map<int, std::vector<int>> &local_contact_pair_candidates,
+  std::unordered_map<int, std::vector<int>> &ghost_contact_pair_candidates)
+{
+  local_contact_pair_candidates.clear();
+  ghost_contact_pair_candidates.clear();
+
+  // Invalidating the size classes of the previous search. The particles have
+  // been sorted into cells since then and the triangulation may have changed.
+  // The container is resized before the search since the references to its
+  // elements are kept during the search
+  ++current_search_stamp;
+  if (!cells_local_neighbor_list->empty())
+    size_classes_of_cells.resize(cells_local_neighbor_list->front()
+                                   .front()
+                                   ->get_triangulation()
+                                   .n_active_cells());
+
+  const double maximum_particle_radius = 0.5 * maximum_particle_diameter;
+
+  // Local-local pairs
+  for (const auto &cell_neighbor_list : *cells_local_neighbor_list)
+    {
+      const cell_size_classes &main_cell =
+        get_cell_size_classes(particle_handler,
+                              cell_neighbor_list.front(),
+                              maximum_particle_radius);
+
+      if (main_cell.n_particles == 0)
+        continue;
+
+      // Pairs in the main cell, each pair is only captured once
+      for (unsigned int class_one = 0; class_one < n_size_classes; ++class_one)
+        for (unsigned int particle_one = 0;
+             particle_one < main_cell.particles[class_one].size();
+             ++particle_one)
+          {
+            const particle_search_info &main_particle =
+              main_cell.particles[class_one][particle_one];
+
+            std::vector<int> &particle_candidate_container =
+              local_contact_pair_candidates[main_particle.id];
+
+            for (unsigned int class_two = class_one;
+                 class_two < n_size_classes;
+                 ++class_two)
+              {
+                const auto &particles_in_class =
+                  main_cell.particles[class_two];
+                for (unsigned int particle_two =
+                       (class_two == class_one) ? particle_one + 1 : 0;
+                     particle_two < particles_in_class.size();
+                     ++particle_two)
+                  {
+                    const double pair_cutoff =
+                      main_particle.radius +
+                      particles_in_class[particle_two].radius +
+                      contact_search_skin;
+                    if (main_particle.location.distance_square(
+                          particles_in_class[particle_two].location) <
+                        pair_cutoff * pair_cutoff)
+                      particle_candidate_container.emplace_back(
+                        particles_in_class[particle_two].id);
+                  }
+              }
+          }
+
+      // Pairs with the particles of the neighbor cells
+      for (auto cell_neighbor_iterator = std::next(cell_neighbor_list.begin());
+           cell_neighbor_iterator != cell_neighbor_list.end();
+           ++cell_neighbor_iterator)
+        {
+          const cell_size_classes &neighbor_cell =
+            get_cell_size_classes(particle_handler,
+                                  *cell_neighbor_iterator,
+                                  maximum_particle_radius);
+
+          for (const auto &particles_in_class : main_cell.particles)
+            for (const auto &main_particle : particles_in_class)
+              add_candidates_in_neighbor_cell(
+                main_particle,
+                neighbor_cell,
+                contact_search_skin,
+                local_contact_pair_candidates[main_particle.id]);
+        }
+    }
+
+  // Local-ghost pairs
+  for (const auto &cell_neighbor_list : *cells_ghost_neighbor_list)
+    {
+      const cell_size_classes &main_cell =
+        get_cell_size_classes(particle_handler,
+                              cell_neighbor_list.front(),
+                              maximum_particle_radius);
+
+      if (main_cell.n_particles == 0)
+        continue;
+
+      for (auto cell_neighbor_iterator = std::next(cell_neighbor_list.begin());
+           cell_neighbor_iterator != cell_neighbor_list.end();
+           ++cell_neighbor_iterator)
+        {
+          const cell_size_classes &neighbor_cell =
+            get_cell_size_classes(particle_handler,
+                                  *cell_neighbor_iterator,
+                                  maximum_particle_radius);
+
+          for (const auto &particles_in_class : main_cell.particles)
+            for (const auto &main_particle : particles_in_class)
+              add_candidates_in_neighbor_cell(
+                main_particle,
+                neighbor_cell,
+                contact_search_skin,
+                ghost_contact_pair_candidates[main_particle.id]);
+        }
+    }
+}
+
 template class PPBroadSearch<2>;
 template class PPBroadSearch<3>;
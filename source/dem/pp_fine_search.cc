@@ -7,8 +7,9 @@ PPFineSearch<dim>::PPFineSearch()
 {}
 
 template <int dim>
+template <typename NeighborhoodCriterion>
 void
-PPFineSearch<dim>::particle_particle_fine_search(
+PPFineSearch<dim>::fine_search(
   const std::unordered_map<int, std::vector<int>>
     &local_contact_pair_candidates,
   const std::unordered_map<int, std::vector<int>>
@@ -18,7 +19,7 @@ PPFineSearch<dim>::particle_particle_fine_search(
   std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
     &ghost_adjacent_particles,
   std::unordered_map<int, Particles::ParticleIterator<dim>> &particle_container,
-  const double neighborhood_threshold)
+  const NeighborhoodCriterion &in_neighborhood)
 {
   // First iterating over local adjacent_particles
   for (auto &&adjacent_particles_list :
@@ -47,7 +48,7 @@ PPFineSearch<dim>::particle_particle_fine_search(
           // Finding distance
           const double square_distance =
             particle_one_location.distance_square(particle_two_location);
-          if (square_distance > neighborhood_threshold)
+          if (!in_neighborhood(particle_one, particle_two, square_distance))
             {
               adjacent_particles_list.erase(adjacent_particles_list_iterator++);
             }
@@ -81,7 +82,7 @@ PPFineSearch<dim>::particle_particle_fine_search(
             particle_one_location.distance_square(particle_two_location);
 
           // If the particles distance is less than the threshold
-          if (square_distance < neighborhood_threshold)
+          if (in_neighborhood(particle_one, particle_two, square_distance))
             {
               // Getting the particle one contact list and particle two id
               auto particle_one_contact_list =
@@ -131,7 +132,7 @@ PPFineSearch<dim>::particle_particle_fine_search(
           // Finding distance
           const double square_distance =
             particle_one_location.distance_square(particle_two_location);
-          if (square_distance > neighborhood_threshold)
+          if (!in_neighborhood(particle_one, particle_two, square_distance))
             {
               adjacent_particles_list.erase(adjacent_particles_list_iterator++);
             }
@@ -165,7 +166,7 @@ PPFineSearch<dim>::particle_particle_fine_search(
             particle_one_location.distance_square(particle_two_location);
 
           // If the particles distance is less than the threshold
-          if (square_distance < neighborhood_threshold)
+          if (in_neighborhood(particle_one, particle_two, square_distance))
             {
               // Getting the particle one contact list and particle two id
               auto particle_one_contact_list =
@@ -191,5 +192,63 @@ PPFineSearch<dim>::particle_particle_fine_search(
     }
 }
 
+template <int dim>
+void
+PPFineSearch<dim>::particle_particle_fine_search(
+  const std::unordered_map<int, std::vector<int>>
+    &local_contact_pair_candidates,
+  const std::unordered_map<int, std::vector<int>>
+    &ghost_contact_pair_candidates,
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    &local_adjacent_particles,
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    &ghost_adjacent_particles,
+  std::unordered_map<int, Particles::ParticleIterator<dim>> &particle_container,
+  const double neighborhood_threshold)
+{
+  fine_search(local_contact_pair_candidates,
+              ghost_contact_pair_candidates,
+              local_adjacent_particles,
+              ghost_adjacent_particles,
+              particle_container,
+              [neighborhood_threshold](const Particles::ParticleIterator<dim> &,
+                                       const Particles::ParticleIterator<dim> &,
+                                       const double square_distance) {
+                return square_distance < neighborhood_threshold;
+              });
+}
+
+template <int dim>
+void
+PPFineSearch<dim>::particle_particle_polydisperse_fine_search(
+  const std::unordered_map<int, std::vector<int>>
+    &local_contact_pair_candidates,
+  const std::unordered_map<int, std::vector<int>>
+    &ghost_contact_pair_candidates,
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    &local_adjacent_particles,
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    &ghost_adjacent_particles,
+  std::unordered_map<int, Particles::ParticleIterator<dim>> &particle_container,
+  const double contact_search_skin)
+{
+  fine_search(
+    local_contact_pair_candidates,
+    ghost_contact_pair_candidates,
+    local_adjacent_particles,
+    ghost_adjacent_particles,
+    particle_container,
+    [contact_search_skin](const Particles::ParticleIterator<dim> &particle_one,
+                          const Particles::ParticleIterator<dim> &particle_two,
+                          const double square_distance) {
+      // Per-pair cutoff: sum of the radii and the contact search skin
+      const double pair_cutoff =
+        0.5 * (particle_one->get_properties()[DEM::PropertiesIndex::dp] +
+               particle_two->get_properties()[DEM::PropertiesIndex::dp]) +
+        contact_search_skin;
+      return square_distance < pair_cutoff * pair_cutoff;
+    });
+}
+
 template class PPFineSearch<2>;
 template class PPFineSearch<3>;
@@ -71,15 +71,10 @@ PPNonLinearForce<dim>::PPNonLinearForce(
                (rolling_friction_coefficient_i +
                 rolling_friction_coefficient_j)});
 
-          double restitution_coefficient_particle_log =
-            std::log(this->effective_coefficient_of_restitution[i][j]);
-
           model_parameter_beta[i].insert(
             {j,
-             restitution_coefficient_particle_log /
-               sqrt(restitution_coefficient_particle_log *
-                      restitution_coefficient_particle_log +
-                    9.8696)});
+             calculate_model_parameter_beta(
+               this->effective_coefficient_of_restitution[i][j])});
         }
     }
 }
@@ -281,41 +276,33 @@ PPNonLinearForce<dim>::calculate_nonlinear_contact_force_and_torque(
   const unsigned int particle_two_type =
     particle_two_properties[DEM::PropertiesIndex::type];
 
-  const double radius_times_overlap_sqrt =
-    sqrt(this->effective_radius * normal_overlap);
-  const double model_parameter_sn =
-    2 * this->effective_youngs_modulus[particle_one_type][particle_two_type] *
-    radius_times_overlap_sqrt;
-  double model_parameter_st =
-    8 * this->effective_shear_modulus[particle_one_type][particle_two_type] *
-    radius_times_overlap_sqrt;
-
   // Calculation of normal and tangential spring and dashpot constants
   // using particle properties
-  double normal_spring_constant = 0.66665 * model_parameter_sn;
-  double normal_damping_constant =
-    -1.8257 * model_parameter_beta[particle_one_type][particle_two_type] *
-    sqrt(model_parameter_sn * this->effective_mass);
-  double tangential_spring_constant =
-    8 * this->effective_shear_modulus[particle_one_type][particle_two_type] *
-      radius_times_overlap_sqrt +
-    DBL_MIN;
-  double tangential_damping_constant =
-    normal_damping_constant * sqrt(model_parameter_st / model_parameter_sn);
+  const HertzMindlinCoefficients coefficients =
+    calculate_hertz_mindlin_coefficients(
+      normal_overlap,
+      this->effective_radius,
+      this->effective_mass,
+      this->effective_youngs_modulus[particle_one_type][particle_two_type],
+      this->effective_shear_modulus[particle_one_type][particle_two_type],
+      model_parameter_beta[particle_one_type][particle_two_type]);
 
   // Calculation of normal force using spring and dashpot normal forces
   normal_force =
-    ((normal_spring_constant * normal_overlap) * normal_unit_vector) +
-    ((normal_damping_constant * normal_relative_velocity_value) *
+    ((coefficients.normal_spring_constant * normal_overlap) *
+     normal_unit_vector) +
+    ((coefficients.normal_damping_constant * normal_relative_velocity_value) *
      normal_unit_vector);
 
   // Calculation of tangential force using spring and dashpot tangential
   // forces. Since we need dashpot tangential force in the gross sliding again,
   // we define it as a separate variable
   Tensor<1, dim> dashpot_tangential_force =
-    (tangential_damping_constant * contact_info.tangential_relative_velocity);
+    (coefficients.tangential_damping_constant *
+     contact_info.tangential_relative_velocity);
   tangential_force =
-    (tangential_spring_constant * contact_info.tangential_overlap) +
+    (coefficients.tangential_spring_constant *
+     contact_info.tangential_overlap) +
     dashpot_tangential_force;
 
   double coulomb_threshold =
@@ -332,7 +319,7 @@ PPNonLinearForce<dim>::calculate_nonlinear_contact_force_and_torque(
 
       contact_info.tangential_overlap =
         (tangential_force - dashpot_tangential_force) /
-        (tangential_spring_constant + DBL_MIN);
+        (coefficients.tangential_spring_constant + DBL_MIN);
     }
 
   // Calculation of torque
@@ -6,8 +6,28 @@ GLSVANSSolver<dim>::GLSVANSSolver(SimulationParameters<dim> &p_nsparam)
   : GLSNavierStokesSolver<dim>(p_nsparam)
   , void_fraction_dof_handler(*this->triangulation)
   , fe_void_fraction(p_nsparam.fem_parameters.velocity_order)
+  , void_fraction_projection(void_fraction_dof_handler,
+                             void_fraction_constraints,
+                             p_nsparam.void_fraction->mode,
+                             p_nsparam.void_fraction->smoothing_length)
+  , mapping(p_nsparam.fem_parameters.velocity_order,
+            p_nsparam.fem_parameters.qmapping_all)
+  , particle_handler(*this->triangulation,
+                     mapping,
+                     DEM::get_number_properties())
 
-{}
+{
+  // The particles follow the cells of the fluid triangulation when it is
+  // refined, coarsened or repartitioned
+  this->triangulation->signals.pre_distributed_refinement.connect(
+    [this]() { particle_handler.register_store_callback_function(); });
+  this->triangulation->signals.post_distributed_refinement.connect(
+    [this]() { particle_handler.register_load_callback_function(false); });
+  this->triangulation->signals.pre_distributed_repartition.connect(
+    [this]() { particle_handler.register_store_callback_function(); });
+  this->triangulation->signals.post_distributed_repartition.connect(
+    [this]() { particle_handler.register_load_callback_function(false); });
+}
 
 template <int dim>
 GLSVANSSolver<dim>::~GLSVANSSolver()
@@ -44,6 +64,18 @@ GLSVANSSolver<dim>::setup_dofs()
                           this->mpi_communicator);
   nodal_void_fraction_owned.reinit(locally_owned_dofs_voidfraction,
                                    this->mpi_communicator);
+
+  void_fraction_constraints.clear();
+  void_fraction_constraints.reinit(locally_relevant_dofs_voidfraction);
+  DoFTools::make_hanging_node_constraints(void_fraction_dof_handler,
+                                          void_fraction_constraints);
+  void_fraction_constraints.close();
+
+  if (this->simulation_parameters.void_fraction->mode !=
+      Parameters::VoidFractionMode::function)
+    void_fraction_projection.setup(locally_owned_dofs_voidfraction,
+                                   locally_relevant_dofs_voidfraction,
+                                   this->mpi_communicator);
 }
 
 template <int dim>
@@ -72,7 +104,25 @@ template <int dim>
 void
 GLSVANSSolver<dim>::calculate_void_fraction(const double time)
 {
-  const MappingQ<dim> mapping(this->velocity_fem_degree);
+  if (this->simulation_parameters.void_fraction->mode !=
+      Parameters::VoidFractionMode::function)
+    {
+      TimerOutput::Scope t(this->computing_timer, "calculate_void_fraction");
+
+      calculate_cell_void_fraction(*this->triangulation,
+                                   particle_handler,
+                                   cell_void_fraction);
+
+      void_fraction_projection.project(
+        mapping,
+        QGauss<dim>(this->number_quadrature_points),
+        cell_void_fraction,
+        nodal_void_fraction_owned,
+        this->simulation_parameters.linear_solver.max_iterations,
+        this->simulation_parameters.linear_solver.minimum_residual);
+      nodal_void_fraction_relevant = nodal_void_fraction_owned;
+      return;
+    }
 
   this->simulation_parameters.void_fraction->void_fraction.set_time(time);
 
@@ -86,6 +136,110 @@ GLSVANSSolver<dim>::calculate_void_fraction(const double time)
   nodal_void_fraction_relevant = nodal_void_fraction_owned;
 }
 
+template <int dim>
+void
+GLSVANSSolver<dim>::calculate_particle_fluid_forces()
+{
+  TimerOutput::Scope t(this->computing_timer,
+                       "calculate_particle_fluid_forces");
+
+  const double viscosity =
+    this->simulation_parameters.physical_properties.viscosity;
+  const double density =
+    this->simulation_parameters.physical_properties.density;
+
+  const FEValuesExtractors::Vector velocities(0);
+
+  std::vector<Point<dim>>     reference_locations;
+  std::vector<Tensor<1, dim>> fluid_velocity_values;
+  std::vector<double>         void_fraction_values;
+
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned() &&
+          particle_handler.n_particles_in_cell(cell) > 0)
+        {
+          typename DoFHandler<dim>::active_cell_iterator void_fraction_cell(
+            &(*this->triangulation),
+            cell->level(),
+            cell->index(),
+            &this->void_fraction_dof_handler);
+
+          const auto particles_in_cell =
+            particle_handler.particles_in_cell(cell);
+
+          // The fields are evaluated at the reference locations of the
+          // particles, which are known by the particle handler, using them as
+          // the quadrature points of the cell
+          reference_locations.clear();
+          for (const auto &particle : particles_in_cell)
+            reference_locations.push_back(particle.get_reference_location());
+
+          const Quadrature<dim> particle_quadrature(reference_locations);
+          const unsigned int    n_particles = reference_locations.size();
+          fluid_velocity_values.resize(n_particles);
+          void_fraction_values.resize(n_particles);
+
+          FEValues<dim> fe_values(mapping,
+                                  this->fe,
+                                  particle_quadrature,
+                                  update_values);
+          FEValues<dim> fe_values_void_fraction(mapping,
+                                                fe_void_fraction,
+                                                particle_quadrature,
+                                                update_values);
+          fe_values.reinit(cell);
+          fe_values_void_fraction.reinit(void_fraction_cell);
+
+          fe_values[velocities].get_function_values(this->present_solution,
+                                                    fluid_velocity_values);
+          fe_values_void_fraction.get_function_values(
+            nodal_void_fraction_relevant, void_fraction_values);
+
+          unsigned int particle_number = 0;
+          for (auto particle = particles_in_cell.begin();
+               particle != particles_in_cell.end();
+               ++particle, ++particle_number)
+            {
+              const Tensor<1, dim> &fluid_velocity =
+                fluid_velocity_values[particle_number];
+              const double void_fraction =
+                void_fraction_values[particle_number];
+
+              auto particle_properties = particle->get_properties();
+
+              const double dp = particle_properties[DEM::PropertiesIndex::dp];
+
+              Tensor<1, dim> relative_velocity;
+              for (int d = 0; d < dim; ++d)
+                relative_velocity[d] =
+                  fluid_velocity[d] -
+                  particle_properties[DEM::PropertiesIndex::v_x + d];
+              const double relative_velocity_norm = relative_velocity.norm();
+
+              // Di Felice drag model
+              const double re_p =
+                void_fraction * relative_velocity_norm * dp / viscosity;
+              Tensor<1, dim> drag_force;
+              if (re_p > 0)
+                {
+                  const double c_d = std::pow(0.63 + 4.8 / std::sqrt(re_p), 2);
+                  const double chi =
+                    3.7 -
+                    0.65 * std::exp(-0.5 * std::pow(1.5 - std::log10(re_p), 2));
+                  drag_force = 0.5 * c_d * density * M_PI * dp * dp / 4. *
+                               std::pow(void_fraction, 2. - chi) *
+                               relative_velocity_norm * relative_velocity;
+                }
+
+              for (int d = 0; d < dim; ++d)
+                particle_properties[DEM::PropertiesIndex::fem_force_x + d] =
+                  drag_force[d];
+            }
+        }
+    }
+}
+
 // Do an iteration with the NavierStokes Solver
 // Handles the fact that we may or may not be at a first
 // iteration with the solver and sets the initial conditions
@@ -224,10 +378,7 @@ GLSVANSSolver<dim>::assembleGLS()
   double viscosity = this->simulation_parameters.physical_properties.viscosity;
   Function<dim> *l_forcing_function = this->forcing_function;
 
-  QGauss<dim>         quadrature_formula(this->number_quadrature_points);
-  const MappingQ<dim> mapping(
-    this->velocity_fem_degree,
-    this->simulation_parameters.fem_parameters.qmapping_all);
+  QGauss<dim>   quadrature_formula(this->number_quadrature_points);
   FEValues<dim> fe_values(mapping,
                           this->fe,
                           quadrature_formula,
@@ -955,6 +1106,13 @@ GLSVANSSolver<dim>::solve()
             refine_mesh();
           this->iterate();
         }
+
+      // The drag force on the particles is available to the DEM solver
+      // which shares the particles
+      if (this->simulation_parameters.void_fraction->mode !=
+          Parameters::VoidFractionMode::function)
+        calculate_particle_fluid_forces();
+
       this->postprocess(false);
       this->finish_time_step();
     }
@@ -0,0 +1,263 @@
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_values.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparsity_tools.h>
+#include <deal.II/lac/trilinos_solver.h>
+
+#include <dem/dem_properties.h>
+#include <fem-dem/void_fraction.h>
+
+using namespace dealii;
+
+template <int dim>
+void
+calculate_cell_void_fraction(
+  const parallel::DistributedTriangulationBase<dim> &triangulation,
+  const Particles::ParticleHandler<dim> &            particle_handler,
+  Vector<double> &                                   cell_void_fraction)
+{
+  cell_void_fraction.reinit(triangulation.n_active_cells());
+  cell_void_fraction = 1;
+
+  for (const auto &cell : triangulation.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          // Volume of the particles whose centroid lies within the cell
+          double solid_volume = 0;
+
+          const auto particles_in_cell =
+            particle_handler.particles_in_cell(cell);
+          for (auto particle = particles_in_cell.begin();
+               particle != particles_in_cell.end();
+               ++particle)
+            {
+              const double dp =
+                particle->get_properties()[DEM::PropertiesIndex::dp];
+              if (dim == 2)
+                solid_volume += M_PI * dp * dp / 4.;
+              else
+                solid_volume += M_PI * dp * dp * dp / 6.;
+            }
+
+          cell_void_fraction[cell->active_cell_index()] =
+            std::max(0., 1. - solid_volume / cell->measure());
+        }
+    }
+}
+
+template <int dim>
+VoidFractionProjection<dim>::VoidFractionProjection(
+  const DoFHandler<dim> &            dof_handler,
+  const AffineConstraints<double> &  constraints,
+  const Parameters::VoidFractionMode mode,
+  const double                       smoothing_length)
+  : dof_handler(dof_handler)
+  , constraints(constraints)
+  , lumped(mode == Parameters::VoidFractionMode::pcm)
+  , smoothing_length(smoothing_length)
+  , is_assembled(false)
+{}
+
+template <int dim>
+void
+VoidFractionProjection<dim>::setup(const IndexSet &locally_owned_dofs,
+                                   const IndexSet &locally_relevant_dofs,
+                                   const MPI_Comm &mpi_communicator)
+{
+  system_rhs.reinit(locally_owned_dofs, mpi_communicator);
+
+  if (lumped)
+    lumped_mass.reinit(locally_owned_dofs, mpi_communicator);
+  else
+    {
+      DynamicSparsityPattern dsp(locally_relevant_dofs);
+      DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+      SparsityTools::distribute_sparsity_pattern(dsp,
+                                                 locally_owned_dofs,
+                                                 mpi_communicator,
+                                                 locally_relevant_dofs);
+      system_matrix.reinit(locally_owned_dofs,
+                           locally_owned_dofs,
+                           dsp,
+                           mpi_communicator);
+    }
+
+  // The operator is assembled again on the new mesh
+  is_assembled = false;
+  preconditioner.reset();
+}
+
+template <int dim>
+void
+VoidFractionProjection<dim>::assemble(const Mapping<dim> &   mapping,
+                                      const Quadrature<dim> &quadrature)
+{
+  const FiniteElement<dim> &fe = dof_handler.get_fe();
+
+  FEValues<dim> fe_values(mapping,
+                          fe,
+                          quadrature,
+                          update_values | update_gradients | update_JxW_values);
+
+  const unsigned int dofs_per_cell = fe.dofs_per_cell;
+  const unsigned int n_q_points    = quadrature.size();
+  FullMatrix<double> local_matrix(dofs_per_cell, dofs_per_cell);
+  std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+
+  cell_shape_function_integrals.assign(
+    dof_handler.get_triangulation().n_active_cells() * dofs_per_cell, 0.);
+  if (lumped)
+    lumped_mass = 0;
+  else
+    system_matrix = 0;
+
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          fe_values.reinit(cell);
+          local_matrix = 0;
+
+          // The integrals of the shape functions are the right-hand side of
+          // the projection of a unit cell void fraction and the rows of the
+          // lumped mass matrix
+          const ArrayView<double> shape_function_integrals(
+            cell_shape_function_integrals.data() +
+              cell->active_cell_index() * dofs_per_cell,
+            dofs_per_cell);
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              const double JxW = fe_values.JxW(q);
+              for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                {
+                  const double phi_i = fe_values.shape_value(i, q);
+                  shape_function_integrals[i] += phi_i * JxW;
+
+                  if (!lumped)
+                    for (unsigned int j = 0; j < dofs_per_cell; ++j)
+                      local_matrix(i, j) +=
+                        (phi_i * fe_values.shape_value(j, q) +
+                         smoothing_length * smoothing_length *
+                           fe_values.shape_grad(i, q) *
+                           fe_values.shape_grad(j, q)) *
+                        JxW;
+                }
+            }
+
+          cell->get_dof_indices(local_dof_indices);
+          if (lumped)
+            {
+              const Vector<double> local_lumped_mass(
+                shape_function_integrals.begin(),
+                shape_function_integrals.end());
+              constraints.distribute_local_to_global(local_lumped_mass,
+                                                     local_dof_indices,
+                                                     lumped_mass);
+            }
+          else
+            constraints.distribute_local_to_global(local_matrix,
+                                                   local_dof_indices,
+                                                   system_matrix);
+        }
+    }
+
+  if (lumped)
+    lumped_mass.compress(VectorOperation::add);
+  else
+    {
+      system_matrix.compress(VectorOperation::add);
+
+      // The operator only changes with the mesh, so does its preconditioner
+      TrilinosWrappers::PreconditionAMG::AdditionalData amg_data;
+      amg_data.elliptic              = true;
+      amg_data.higher_order_elements = fe.degree > 1;
+      preconditioner = std::make_shared<TrilinosWrappers::PreconditionAMG>();
+      preconditioner->initialize(system_matrix, amg_data);
+    }
+
+  is_assembled = true;
+}
+
+template <int dim>
+void
+VoidFractionProjection<dim>::project(
+  const Mapping<dim> &           mapping,
+  const Quadrature<dim> &        quadrature,
+  const Vector<double> &         cell_void_fraction,
+  TrilinosWrappers::MPI::Vector &nodal_void_fraction,
+  const unsigned int             max_iterations,
+  const double                   tolerance)
+{
+  if (!is_assembled)
+    assemble(mapping, quadrature);
+
+  const unsigned int dofs_per_cell = dof_handler.get_fe().dofs_per_cell;
+  Vector<double>     local_rhs(dofs_per_cell);
+  std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+
+  // The right-hand side is obtained from the cached integrals of the shape
+  // functions since the cell void fraction is constant over each cell
+  system_rhs = 0;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          const unsigned int cell_index    = cell->active_cell_index();
+          const double       void_fraction = cell_void_fraction[cell_index];
+          const double *     shape_function_integrals =
+            &cell_shape_function_integrals[cell_index * dofs_per_cell];
+          for (unsigned int i = 0; i < dofs_per_cell; ++i)
+            local_rhs(i) = void_fraction * shape_function_integrals[i];
+
+          cell->get_dof_indices(local_dof_indices);
+          constraints.distribute_local_to_global(local_rhs,
+                                                 local_dof_indices,
+                                                 system_rhs);
+        }
+    }
+  system_rhs.compress(VectorOperation::add);
+
+  if (lumped)
+    {
+      for (const auto index : lumped_mass.locally_owned_elements())
+        if (lumped_mass(index) > 0)
+          nodal_void_fraction(index) = system_rhs(index) / lumped_mass(index);
+      nodal_void_fraction.compress(VectorOperation::insert);
+    }
+  else
+    {
+      // The void fraction of the previous time step is the initial guess,
+      // which is usually close to the solution. With the cached operator and
+      // its preconditioner, a few iterations are then enough to reach the
+      // absolute tolerance.
+      SolverControl              solver_control(max_iterations, tolerance);
+      TrilinosWrappers::SolverCG solver(solver_control);
+
+      solver.solve(system_matrix,
+                   nodal_void_fraction,
+                   system_rhs,
+                   *preconditioner);
+    }
+
+  constraints.distribute(nodal_void_fraction);
+}
+
+template void
+calculate_cell_void_fraction(
+  const parallel::DistributedTriangulationBase<2> &triangulation,
+  const Particles::ParticleHandler<2> &            particle_handler,
+  Vector<double> &                                 cell_void_fraction);
+template void
+calculate_cell_void_fraction(
+  const parallel::DistributedTriangulationBase<3> &triangulation,
+  const Particles::ParticleHandler<3> &            particle_handler,
+  Vector<double> &                                 cell_void_fraction);
+
+template class VoidFractionProjection<2>;
+template class VoidFractionProjection<3>;
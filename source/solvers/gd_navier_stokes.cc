@@ -429,6 +429,19 @@ GDNavierStokesSolver<dim>::setup_dofs_fd()
 {
   TimerOutput::Scope t(this->computing_timer, "setup_dofs");
 
+  // Clear the preconditioners before the matrix they are associated with is
+  // cleared. The AMG hierarchies and the constant modes are rebuilt for the
+  // new distribution of the dofs.
+  system_amg_preconditioner.reset();
+  system_ilu_preconditioner.reset();
+  velocity_amg_preconditioner.reset();
+  pressure_amg_preconditioner.reset();
+  velocity_ilu_preconditioner.reset();
+  pressure_ilu_preconditioner.reset();
+  velocity_constant_modes.clear();
+  pressure_constant_modes.clear();
+  amg_rebuild_required = true;
+
   system_matrix.clear();
 
   this->dof_handler.distribute_dofs(this->fe);
@@ -463,127 +476,9 @@ GDNavierStokesSolver<dim>::setup_dofs_fd()
   this->locally_relevant_dofs[1] =
     locally_relevant_dofs_acquisition.get_view(dof_u, dof_u + dof_p);
 
-  const MappingQ<dim> mapping(
-    this->velocity_fem_degree,
-    this->simulation_parameters.fem_parameters.qmapping_all);
-  FEValuesExtractors::Vector velocities(0);
-
-  // Non-zero constraints
+  this->define_non_zero_constraints();
+  this->define_zero_constraints();
   auto &nonzero_constraints = this->nonzero_constraints;
-  {
-    nonzero_constraints.clear();
-
-    DoFTools::make_hanging_node_constraints(this->dof_handler,
-                                            nonzero_constraints);
-    for (unsigned int i_bc = 0;
-         i_bc < this->simulation_parameters.boundary_conditions.size;
-         ++i_bc)
-      {
-        if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-            BoundaryConditions::BoundaryType::noslip)
-          {
-            VectorTools::interpolate_boundary_values(
-              mapping,
-              this->dof_handler,
-              this->simulation_parameters.boundary_conditions.id[i_bc],
-              dealii::Functions::ZeroFunction<dim>(dim + 1),
-              nonzero_constraints,
-              this->fe.component_mask(velocities));
-          }
-        else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-                 BoundaryConditions::BoundaryType::slip)
-          {
-            std::set<types::boundary_id> no_normal_flux_boundaries;
-            no_normal_flux_boundaries.insert(
-              this->simulation_parameters.boundary_conditions.id[i_bc]);
-            VectorTools::compute_no_normal_flux_constraints(
-              this->dof_handler,
-              0,
-              no_normal_flux_boundaries,
-              nonzero_constraints);
-          }
-        else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-                 BoundaryConditions::BoundaryType::function)
-          {
-            VectorTools::interpolate_boundary_values(
-              mapping,
-              this->dof_handler,
-              this->simulation_parameters.boundary_conditions.id[i_bc],
-              NavierStokesFunctionDefined<dim>(
-                &this->simulation_parameters.boundary_conditions
-                   .bcFunctions[i_bc]
-                   .u,
-                &this->simulation_parameters.boundary_conditions
-                   .bcFunctions[i_bc]
-                   .v,
-                &this->simulation_parameters.boundary_conditions
-                   .bcFunctions[i_bc]
-                   .w),
-              nonzero_constraints,
-              this->fe.component_mask(velocities));
-          }
-
-        else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-                 BoundaryConditions::BoundaryType::periodic)
-          {
-            DoFTools::make_periodicity_constraints(
-              this->dof_handler,
-              this->simulation_parameters.boundary_conditions.id[i_bc],
-              this->simulation_parameters.boundary_conditions.periodic_id[i_bc],
-              this->simulation_parameters.boundary_conditions
-                .periodic_direction[i_bc],
-              nonzero_constraints);
-          }
-      }
-  }
-  nonzero_constraints.close();
-
-  {
-    this->zero_constraints.clear();
-    DoFTools::make_hanging_node_constraints(this->dof_handler,
-                                            this->zero_constraints);
-
-    for (unsigned int i_bc = 0;
-         i_bc < this->simulation_parameters.boundary_conditions.size;
-         ++i_bc)
-      {
-        if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-            BoundaryConditions::BoundaryType::slip)
-          {
-            std::set<types::boundary_id> no_normal_flux_boundaries;
-            no_normal_flux_boundaries.insert(
-              this->simulation_parameters.boundary_conditions.id[i_bc]);
-            VectorTools::compute_no_normal_flux_constraints(
-              this->dof_handler,
-              0,
-              no_normal_flux_boundaries,
-              this->zero_constraints);
-          }
-        else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-                 BoundaryConditions::BoundaryType::periodic)
-          {
-            DoFTools::make_periodicity_constraints(
-              this->dof_handler,
-              this->simulation_parameters.boundary_conditions.id[i_bc],
-              this->simulation_parameters.boundary_conditions.periodic_id[i_bc],
-              this->simulation_parameters.boundary_conditions
-                .periodic_direction[i_bc],
-              this->zero_constraints);
-          }
-        else // if(nsparam.boundaryConditions.boundaries[i_bc].type==Parameters::noslip
-          // || Parameters::function)
-          {
-            VectorTools::interpolate_boundary_values(
-              mapping,
-              this->dof_handler,
-              this->simulation_parameters.boundary_conditions.id[i_bc],
-              dealii::Functions::ZeroFunction<dim>(dim + 1),
-              this->zero_constraints,
-              this->fe.component_mask(velocities));
-          }
-      }
-  }
-  this->zero_constraints.close();
 
   this->present_solution.reinit(this->locally_owned_dofs,
                                 this->locally_relevant_dofs,
@@ -800,25 +695,46 @@ GDNavierStokesSolver<dim>::setup_AMG()
 {
   TimerOutput::Scope t(this->computing_timer, "setup_AMG");
 
+  // The sparsity pattern of the matrix only changes with the distribution of
+  // the dofs. The aggregates of the existing hierarchies are kept and only the
+  // prolongators, the smoothers and the coarse solvers are recomputed.
+  if (this->simulation_parameters.linear_solver.amg_reuse_hierarchy &&
+      !amg_rebuild_required && velocity_amg_preconditioner &&
+      pressure_amg_preconditioner && system_amg_preconditioner)
+    {
+      this->computing_timer.enter_subsection("reinit_AMG");
+      velocity_amg_preconditioner->reinit();
+      pressure_amg_preconditioner->reinit();
+      this->computing_timer.leave_subsection("reinit_AMG");
+      return;
+    }
+
+  amg_rebuild_required     = false;
+  amg_reference_iterations = 0;
+
   //**********************************************
   // Trillinos Wrapper AMG Preconditioner
   //*********************************************
 
-  // Constant modes for velocity
-  std::vector<std::vector<bool>> velocity_constant_modes;
-  std::vector<bool>              velocity_components(dim + 1, true);
-  velocity_components[dim] = false;
-  DoFTools::extract_constant_modes(this->dof_handler,
-                                   velocity_components,
-                                   velocity_constant_modes);
-
-  // Constant modes for pressure
-  std::vector<std::vector<bool>> pressure_constant_modes;
-  std::vector<bool>              pressure_components(dim + 1, false);
-  pressure_components[dim] = true;
-  DoFTools::extract_constant_modes(this->dof_handler,
-                                   pressure_components,
-                                   pressure_constant_modes);
+  // Constant modes for velocity and pressure, these only depend on the
+  // distribution of the dofs
+  if (velocity_constant_modes.empty())
+    {
+      std::vector<bool> velocity_components(dim + 1, true);
+      velocity_components[dim] = false;
+      DoFTools::extract_constant_modes(this->dof_handler,
+                                       velocity_components,
+                                       velocity_constant_modes);
+    }
+
+  if (pressure_constant_modes.empty())
+    {
+      std::vector<bool> pressure_components(dim + 1, false);
+      pressure_components[dim] = true;
+      DoFTools::extract_constant_modes(this->dof_handler,
+                                       pressure_components,
+                                       pressure_constant_modes);
+    }
 
   this->computing_timer.enter_subsection("AMG_velocity");
   const bool elliptic_velocity     = false;
@@ -1014,6 +930,17 @@ GDNavierStokesSolver<dim>::solve_system_AMG(const bool   initial_step,
                     << solver_control.last_step() << " steps " << std::endl;
       }
 
+    // The first solve with a fully built hierarchy sets the reference number
+    // of iterations. A reused hierarchy is discarded as soon as it requires
+    // significantly more iterations.
+    if (amg_reference_iterations == 0)
+      amg_reference_iterations = solver_control.last_step();
+    else if (solver_control.last_step() >
+             this->simulation_parameters.linear_solver
+                 .amg_rebuild_iteration_ratio *
+               amg_reference_iterations)
+      amg_rebuild_required = true;
+
     constraints_used.distribute(this->newton_update);
   }
 }
@@ -26,6 +26,82 @@
 #include "core/sdirk.h"
 #include "core/time_integration_utilities.h"
 
+GLSBlockSchurPreconditioner::GLSBlockSchurPreconditioner(
+  const TrilinosWrappers::SparseMatrix &      p_system_matrix,
+  const TrilinosWrappers::PreconditionAMG &   p_velocity_preconditioner,
+  const TrilinosWrappers::PreconditionJacobi &p_pressure_mass_preconditioner,
+  const TrilinosWrappers::PreconditionAMG &
+                  p_pressure_laplacian_preconditioner,
+  const IndexSet &locally_owned_velocity_dofs,
+  const IndexSet &locally_owned_pressure_dofs,
+  const double    p_viscosity,
+  const double    p_time_derivative_coefficient)
+  : system_matrix(p_system_matrix)
+  , velocity_preconditioner(p_velocity_preconditioner)
+  , pressure_mass_preconditioner(p_pressure_mass_preconditioner)
+  , pressure_laplacian_preconditioner(p_pressure_laplacian_preconditioner)
+  , n_locally_owned_velocity_dofs(locally_owned_velocity_dofs.n_elements())
+  , viscosity(p_viscosity)
+  , time_derivative_coefficient(p_time_derivative_coefficient)
+{
+  const MPI_Comm mpi_communicator = system_matrix.get_mpi_communicator();
+  velocity_rhs.reinit(locally_owned_velocity_dofs, mpi_communicator);
+  velocity_update.reinit(locally_owned_velocity_dofs, mpi_communicator);
+  pressure_rhs.reinit(locally_owned_pressure_dofs, mpi_communicator);
+  pressure_update.reinit(locally_owned_pressure_dofs, mpi_communicator);
+  pressure_tmp.reinit(locally_owned_pressure_dofs, mpi_communicator);
+  full_tmp.reinit(system_matrix.locally_owned_domain_indices(),
+                  mpi_communicator);
+  full_product.reinit(system_matrix.locally_owned_range_indices(),
+                      mpi_communicator);
+}
+
+void
+GLSBlockSchurPreconditioner::vmult(
+  TrilinosWrappers::MPI::Vector &      dst,
+  const TrilinosWrappers::MPI::Vector &src) const
+{
+  // The locally owned velocity dofs are stored before the locally owned
+  // pressure dofs, the blocks can thus be extracted with plain copies
+  AssertDimension(src.local_size(),
+                  n_locally_owned_velocity_dofs + pressure_rhs.local_size());
+
+  std::copy(src.begin(),
+            src.begin() + n_locally_owned_velocity_dofs,
+            velocity_rhs.begin());
+  std::copy(src.begin() + n_locally_owned_velocity_dofs,
+            src.end(),
+            pressure_rhs.begin());
+
+  // Pressure : approximate inverse of the Schur complement
+  pressure_mass_preconditioner.vmult(pressure_update, pressure_rhs);
+  pressure_update *= viscosity;
+  if (time_derivative_coefficient > 0)
+    {
+      pressure_laplacian_preconditioner.vmult(pressure_tmp, pressure_rhs);
+      pressure_update.add(time_derivative_coefficient, pressure_tmp);
+    }
+
+  // Velocity : the pressure gradient contribution B^T p is obtained from the
+  // monolithic matrix to avoid storing the off-diagonal blocks
+  full_tmp = 0;
+  std::copy(pressure_update.begin(),
+            pressure_update.end(),
+            full_tmp.begin() + n_locally_owned_velocity_dofs);
+  system_matrix.vmult(full_product, full_tmp);
+
+  auto product = full_product.begin();
+  for (auto &value : velocity_rhs)
+    value -= *product++;
+
+  velocity_preconditioner.vmult(velocity_update, velocity_rhs);
+
+  std::copy(velocity_update.begin(), velocity_update.end(), dst.begin());
+  std::copy(pressure_update.begin(),
+            pressure_update.end(),
+            dst.begin() + n_locally_owned_velocity_dofs);
+}
+
 // Constructor for class GLSNavierStokesSolver
 template <int dim>
 GLSNavierStokesSolver<dim>::GLSNavierStokesSolver(
@@ -58,138 +134,51 @@ GLSNavierStokesSolver<dim>::setup_dofs_fd()
   // cleared
   amg_preconditioner.reset();
   ilu_preconditioner.reset();
+  block_preconditioner.reset();
+  velocity_amg_preconditioner.reset();
+  pressure_mass_preconditioner.reset();
+  pressure_laplacian_preconditioner.reset();
 
   // Now reset system matrix
   system_matrix.clear();
+  velocity_matrix.clear();
+  pressure_mass_matrix.clear();
+  pressure_laplacian_matrix.clear();
 
   this->dof_handler.distribute_dofs(this->fe);
-  DoFRenumbering::Cuthill_McKee(this->dof_handler);
+
+  // The block preconditioner requires the velocity and the pressure dofs to
+  // form two contiguous blocks
+  const bool block_solver = this->simulation_parameters.linear_solver.solver ==
+                            Parameters::LinearSolver::SolverType::block_amg;
+  if (block_solver)
+    {
+      std::vector<unsigned int> block_component(dim + 1, 0);
+      block_component[dim] = 1;
+      DoFRenumbering::component_wise(this->dof_handler, block_component);
+      n_velocity_dofs =
+        DoFTools::count_dofs_per_fe_block(this->dof_handler,
+                                          block_component)[0];
+    }
+  else
+    DoFRenumbering::Cuthill_McKee(this->dof_handler);
 
   this->locally_owned_dofs = this->dof_handler.locally_owned_dofs();
   DoFTools::extract_locally_relevant_dofs(this->dof_handler,
                                           this->locally_relevant_dofs);
 
-  const MappingQ<dim> mapping(
-    this->velocity_fem_degree,
-    this->simulation_parameters.fem_parameters.qmapping_all);
-  FEValuesExtractors::Vector velocities(0);
+  if (block_solver)
+    {
+      locally_owned_velocity_dofs =
+        this->locally_owned_dofs.get_view(0, n_velocity_dofs);
+      locally_owned_pressure_dofs =
+        this->locally_owned_dofs.get_view(n_velocity_dofs,
+                                          this->dof_handler.n_dofs());
+    }
 
-  // Non-zero constraints
+  this->define_non_zero_constraints();
+  this->define_zero_constraints();
   auto &nonzero_constraints = this->get_nonzero_constraints();
-  {
-    nonzero_constraints.clear();
-
-    DoFTools::make_hanging_node_constraints(this->dof_handler,
-                                            nonzero_constraints);
-    for (unsigned int i_bc = 0;
-         i_bc < this->simulation_parameters.boundary_conditions.size;
-         ++i_bc)
-      {
-        if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-            BoundaryConditions::BoundaryType::noslip)
-          {
-            VectorTools::interpolate_boundary_values(
-              mapping,
-              this->dof_handler,
-              this->simulation_parameters.boundary_conditions.id[i_bc],
-              dealii::Functions::ZeroFunction<dim>(dim + 1),
-              nonzero_constraints,
-              this->fe.component_mask(velocities));
-          }
-        else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-                 BoundaryConditions::BoundaryType::slip)
-          {
-            std::set<types::boundary_id> no_normal_flux_boundaries;
-            no_normal_flux_boundaries.insert(
-              this->simulation_parameters.boundary_conditions.id[i_bc]);
-            VectorTools::compute_no_normal_flux_constraints(
-              this->dof_handler,
-              0,
-              no_normal_flux_boundaries,
-              nonzero_constraints);
-          }
-        else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-                 BoundaryConditions::BoundaryType::function)
-          {
-            VectorTools::interpolate_boundary_values(
-              mapping,
-              this->dof_handler,
-              this->simulation_parameters.boundary_conditions.id[i_bc],
-              NavierStokesFunctionDefined<dim>(
-                &this->simulation_parameters.boundary_conditions
-                   .bcFunctions[i_bc]
-                   .u,
-                &this->simulation_parameters.boundary_conditions
-                   .bcFunctions[i_bc]
-                   .v,
-                &this->simulation_parameters.boundary_conditions
-                   .bcFunctions[i_bc]
-                   .w),
-              nonzero_constraints,
-              this->fe.component_mask(velocities));
-          }
-
-        else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-                 BoundaryConditions::BoundaryType::periodic)
-          {
-            DoFTools::make_periodicity_constraints(
-              this->dof_handler,
-              this->simulation_parameters.boundary_conditions.id[i_bc],
-              this->simulation_parameters.boundary_conditions.periodic_id[i_bc],
-              this->simulation_parameters.boundary_conditions
-                .periodic_direction[i_bc],
-              nonzero_constraints);
-          }
-      }
-  }
-  nonzero_constraints.close();
-
-  {
-    this->zero_constraints.clear();
-    DoFTools::make_hanging_node_constraints(this->dof_handler,
-                                            this->zero_constraints);
-
-    for (unsigned int i_bc = 0;
-         i_bc < this->simulation_parameters.boundary_conditions.size;
-         ++i_bc)
-      {
-        if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-            BoundaryConditions::BoundaryType::slip)
-          {
-            std::set<types::boundary_id> no_normal_flux_boundaries;
-            no_normal_flux_boundaries.insert(
-              this->simulation_parameters.boundary_conditions.id[i_bc]);
-            VectorTools::compute_no_normal_flux_constraints(
-              this->dof_handler,
-              0,
-              no_normal_flux_boundaries,
-              this->zero_constraints);
-          }
-        else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
-                 BoundaryConditions::BoundaryType::periodic)
-          {
-            DoFTools::make_periodicity_constraints(
-              this->dof_handler,
-              this->simulation_parameters.boundary_conditions.id[i_bc],
-              this->simulation_parameters.boundary_conditions.periodic_id[i_bc],
-              this->simulation_parameters.boundary_conditions
-                .periodic_direction[i_bc],
-              this->zero_constraints);
-          }
-        else // if(nsparam.boundaryConditions.boundaries[i_bc].type==Parameters::noslip
-             // || Parameters::function)
-          {
-            VectorTools::interpolate_boundary_values(
-              mapping,
-              this->dof_handler,
-              this->simulation_parameters.boundary_conditions.id[i_bc],
-              dealii::Functions::ZeroFunction<dim>(dim + 1),
-              this->zero_constraints,
-              this->fe.component_mask(velocities));
-          }
-      }
-  }
-  this->zero_constraints.close();
 
   this->present_solution.reinit(this->locally_owned_dofs,
                                 this->locally_relevant_dofs,
@@ -367,10 +356,25 @@ GLSNavierStokesSolver<dim>::assembleGLS()
   if (is_sdirk3(scheme))
     sdirk_coefs = sdirk_coefficients(3, dt);
 
+  // Coefficient of the time derivative in the matrix, used by the block
+  // preconditioner
+  if (assemble_matrix)
+    {
+      if (is_bdf(scheme))
+        time_derivative_coefficient = bdf_coefs[0];
+      else if (is_sdirk(scheme))
+        time_derivative_coefficient = sdirk_coefs[0][0];
+      else
+        time_derivative_coefficient = 0;
+    }
+
   // Element size
   double h;
   auto & evaluation_point = this->evaluation_point;
 
+  // CFL accumulated at the quadrature points
+  this->assembly_max_CFL = 0;
+
   for (const auto &cell : this->dof_handler.active_cell_iterators())
     {
       if (cell->is_locally_owned())
@@ -444,6 +448,9 @@ GLSNavierStokesSolver<dim>::assembleGLS()
               const double u_mag =
                 std::max(velocity.norm(), 1e-12 * GLS_u_scale);
 
+              this->assembly_max_CFL =
+                std::max(this->assembly_max_CFL, velocity.norm() / h * dt);
+
               // Store JxW in local variable for faster access;
               const double JxW = fe_values.JxW(q);
 
@@ -819,6 +826,8 @@ GLSNavierStokesSolver<dim>::assembleGLS()
   if (assemble_matrix)
     system_matrix.compress(VectorOperation::add);
   this->system_rhs.compress(VectorOperation::add);
+
+  this->assembly_diagnostics_available = true;
 }
 
 /**
@@ -1272,6 +1281,12 @@ GLSNavierStokesSolver<dim>::solve_linear_system(const bool initial_step,
                         absolute_residual,
                         relative_residual,
                         renewed_matrix);
+  else if (this->simulation_parameters.linear_solver.solver ==
+           Parameters::LinearSolver::SolverType::block_amg)
+    solve_system_block_AMG(initial_step,
+                           absolute_residual,
+                           relative_residual,
+                           renewed_matrix);
   else
     throw(std::runtime_error("This solver is not allowed"));
 }
@@ -1364,6 +1379,284 @@ GLSNavierStokesSolver<dim>::setup_AMG()
   amg_preconditioner->initialize(system_matrix, parameter_ml);
 }
 
+template <int dim>
+void
+GLSNavierStokesSolver<dim>::assemble_pressure_operators()
+{
+  TimerOutput::Scope t(this->computing_timer, "assemble_pressure_operators");
+
+  const types::global_dof_index n_dofs = this->dof_handler.n_dofs();
+  const types::global_dof_index n_pressure_dofs = n_dofs - n_velocity_dofs;
+  const IndexSet                locally_relevant_pressure_dofs =
+    this->locally_relevant_dofs.get_view(n_velocity_dofs, n_dofs);
+
+  QGauss<dim>         quadrature_formula(this->number_quadrature_points);
+  const MappingQ<dim> mapping(
+    this->velocity_fem_degree,
+    this->simulation_parameters.fem_parameters.qmapping_all);
+  FEValues<dim> fe_values(mapping,
+                          this->fe,
+                          quadrature_formula,
+                          update_values | update_gradients |
+                            update_JxW_values);
+
+  const unsigned int dofs_per_cell = this->fe.dofs_per_cell;
+  const unsigned int n_q_points    = quadrature_formula.size();
+
+  // Shape functions of the pressure component
+  std::vector<unsigned int> pressure_shape_functions;
+  for (unsigned int i = 0; i < dofs_per_cell; ++i)
+    if (this->fe.system_to_component_index(i).first == dim)
+      pressure_shape_functions.push_back(i);
+  const unsigned int n_pressure_shape_functions =
+    pressure_shape_functions.size();
+
+  std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+  std::vector<types::global_dof_index> pressure_dof_indices(
+    n_pressure_shape_functions);
+
+  // Sparsity pattern of the pressure block
+  DynamicSparsityPattern dsp(n_pressure_dofs,
+                             n_pressure_dofs,
+                             locally_relevant_pressure_dofs);
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int k = 0; k < n_pressure_shape_functions; ++k)
+            pressure_dof_indices[k] =
+              local_dof_indices[pressure_shape_functions[k]] - n_velocity_dofs;
+          for (const auto row : pressure_dof_indices)
+            dsp.add_entries(row,
+                            pressure_dof_indices.begin(),
+                            pressure_dof_indices.end());
+        }
+    }
+  SparsityTools::distribute_sparsity_pattern(dsp,
+                                             locally_owned_pressure_dofs,
+                                             this->mpi_communicator,
+                                             locally_relevant_pressure_dofs);
+  pressure_mass_matrix.reinit(locally_owned_pressure_dofs,
+                              locally_owned_pressure_dofs,
+                              dsp,
+                              this->mpi_communicator);
+  pressure_laplacian_matrix.reinit(locally_owned_pressure_dofs,
+                                   locally_owned_pressure_dofs,
+                                   dsp,
+                                   this->mpi_communicator);
+
+  FullMatrix<double> local_mass_matrix(n_pressure_shape_functions,
+                                       n_pressure_shape_functions);
+  FullMatrix<double> local_laplacian_matrix(n_pressure_shape_functions,
+                                            n_pressure_shape_functions);
+
+  std::vector<double>         phi_p(n_pressure_shape_functions);
+  std::vector<Tensor<1, dim>> grad_phi_p(n_pressure_shape_functions);
+
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          fe_values.reinit(cell);
+          local_mass_matrix      = 0;
+          local_laplacian_matrix = 0;
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              const double JxW = fe_values.JxW(q);
+              for (unsigned int k = 0; k < n_pressure_shape_functions; ++k)
+                {
+                  phi_p[k] =
+                    fe_values.shape_value(pressure_shape_functions[k], q);
+                  grad_phi_p[k] =
+                    fe_values.shape_grad(pressure_shape_functions[k], q);
+                }
+
+              for (unsigned int i = 0; i < n_pressure_shape_functions; ++i)
+                for (unsigned int j = 0; j < n_pressure_shape_functions; ++j)
+                  {
+                    local_mass_matrix(i, j) += phi_p[i] * phi_p[j] * JxW;
+                    local_laplacian_matrix(i, j) +=
+                      grad_phi_p[i] * grad_phi_p[j] * JxW;
+                  }
+            }
+
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int k = 0; k < n_pressure_shape_functions; ++k)
+            pressure_dof_indices[k] =
+              local_dof_indices[pressure_shape_functions[k]] - n_velocity_dofs;
+
+          pressure_mass_matrix.add(pressure_dof_indices, local_mass_matrix);
+          pressure_laplacian_matrix.add(pressure_dof_indices,
+                                        local_laplacian_matrix);
+        }
+    }
+  pressure_mass_matrix.compress(VectorOperation::add);
+  pressure_laplacian_matrix.compress(VectorOperation::add);
+
+  // The Laplacian only has natural boundary conditions, hence the constant
+  // pressure is in its kernel and the matrix is singular for enclosed flows.
+  // The first pressure dof is pinned by doubling its diagonal entry, which
+  // makes the matrix regular without changing its sparsity pattern. The AMG
+  // preconditioner is then built on a positive definite matrix.
+  if (locally_owned_pressure_dofs.is_element(0))
+    {
+      const double diagonal_entry = pressure_laplacian_matrix.diag_element(0);
+      if (diagonal_entry > 0)
+        pressure_laplacian_matrix.add(0, 0, diagonal_entry);
+    }
+  pressure_laplacian_matrix.compress(VectorOperation::add);
+}
+
+template <int dim>
+void
+GLSNavierStokesSolver<dim>::setup_block_AMG()
+{
+  TimerOutput::Scope t(this->computing_timer, "setup_block_AMG");
+
+  // The pressure operators only depend on the mesh
+  if (pressure_mass_matrix.m() == 0)
+    {
+      assemble_pressure_operators();
+
+      pressure_mass_preconditioner =
+        std::make_shared<TrilinosWrappers::PreconditionJacobi>();
+      pressure_mass_preconditioner->initialize(pressure_mass_matrix);
+
+      TrilinosWrappers::PreconditionAMG::AdditionalData pressure_amg_data;
+      pressure_amg_data.elliptic              = true;
+      pressure_amg_data.higher_order_elements = this->pressure_fem_degree > 1;
+      pressure_amg_data.n_cycles =
+        this->simulation_parameters.linear_solver.amg_n_cycles;
+      pressure_amg_data.w_cycle =
+        this->simulation_parameters.linear_solver.amg_w_cycles;
+      pressure_amg_data.aggregation_threshold =
+        this->simulation_parameters.linear_solver.amg_aggregation_threshold;
+      pressure_amg_data.smoother_sweeps =
+        this->simulation_parameters.linear_solver.amg_smoother_sweeps;
+      pressure_amg_data.smoother_overlap =
+        this->simulation_parameters.linear_solver.amg_smoother_overlap;
+      pressure_laplacian_preconditioner =
+        std::make_shared<TrilinosWrappers::PreconditionAMG>();
+      pressure_laplacian_preconditioner->initialize(pressure_laplacian_matrix,
+                                                    pressure_amg_data);
+    }
+
+  // Copy the velocity block out of the system matrix. Its sparsity pattern
+  // only changes with the distribution of the dofs.
+  if (velocity_matrix.m() == 0)
+    {
+      DynamicSparsityPattern dsp(n_velocity_dofs,
+                                 n_velocity_dofs,
+                                 locally_owned_velocity_dofs);
+      for (const auto row : locally_owned_velocity_dofs)
+        for (auto entry = system_matrix.begin(row);
+             entry != system_matrix.end(row);
+             ++entry)
+          if (entry->column() < n_velocity_dofs)
+            dsp.add(row, entry->column());
+
+      velocity_matrix.reinit(locally_owned_velocity_dofs,
+                             locally_owned_velocity_dofs,
+                             dsp,
+                             this->mpi_communicator);
+    }
+
+  std::vector<types::global_dof_index> columns;
+  std::vector<double>                  values;
+  for (const auto row : locally_owned_velocity_dofs)
+    {
+      columns.clear();
+      values.clear();
+      for (auto entry = system_matrix.begin(row);
+           entry != system_matrix.end(row);
+           ++entry)
+        if (entry->column() < n_velocity_dofs)
+          {
+            columns.push_back(entry->column());
+            values.push_back(entry->value());
+          }
+      velocity_matrix.set(row, columns, values);
+    }
+  velocity_matrix.compress(VectorOperation::insert);
+
+  // The constant modes of the velocity are the first entries of the locally
+  // owned constant modes since the velocity dofs are numbered first
+  std::vector<std::vector<bool>> constant_modes;
+  std::vector<bool>              velocity_components(dim + 1, true);
+  velocity_components[dim] = false;
+  DoFTools::extract_constant_modes(this->dof_handler,
+                                   velocity_components,
+                                   constant_modes);
+  for (auto &mode : constant_modes)
+    mode.resize(locally_owned_velocity_dofs.n_elements());
+
+  const bool elliptic              = false;
+  bool       higher_order_elements = false;
+  if (this->velocity_fem_degree > 1)
+    higher_order_elements = true;
+  const unsigned int n_cycles =
+    this->simulation_parameters.linear_solver.amg_n_cycles;
+  const bool   w_cycle = this->simulation_parameters.linear_solver.amg_w_cycles;
+  const double aggregation_threshold =
+    this->simulation_parameters.linear_solver.amg_aggregation_threshold;
+  const unsigned int smoother_sweeps =
+    this->simulation_parameters.linear_solver.amg_smoother_sweeps;
+  const unsigned int smoother_overlap =
+    this->simulation_parameters.linear_solver.amg_smoother_overlap;
+  const bool                                        output_details = false;
+  const char *                                      smoother_type  = "ILU";
+  const char *                                      coarse_type    = "ILU";
+  TrilinosWrappers::PreconditionAMG::AdditionalData preconditionerOptions(
+    elliptic,
+    higher_order_elements,
+    n_cycles,
+    w_cycle,
+    aggregation_threshold,
+    constant_modes,
+    smoother_sweeps,
+    smoother_overlap,
+    output_details,
+    smoother_type,
+    coarse_type);
+
+  Teuchos::ParameterList              parameter_ml;
+  std::unique_ptr<Epetra_MultiVector> distributed_constant_modes;
+  preconditionerOptions.set_parameters(parameter_ml,
+                                       distributed_constant_modes,
+                                       velocity_matrix);
+  const double ilu_fill =
+    this->simulation_parameters.linear_solver.amg_precond_ilu_fill;
+  const double ilu_atol =
+    this->simulation_parameters.linear_solver.amg_precond_ilu_atol;
+  const double ilu_rtol =
+    this->simulation_parameters.linear_solver.amg_precond_ilu_rtol;
+  parameter_ml.set("smoother: ifpack level-of-fill", ilu_fill);
+  parameter_ml.set("smoother: ifpack absolute threshold", ilu_atol);
+  parameter_ml.set("smoother: ifpack relative threshold", ilu_rtol);
+
+  parameter_ml.set("coarse: ifpack level-of-fill", ilu_fill);
+  parameter_ml.set("coarse: ifpack absolute threshold", ilu_atol);
+  parameter_ml.set("coarse: ifpack relative threshold", ilu_rtol);
+  velocity_amg_preconditioner =
+    std::make_shared<TrilinosWrappers::PreconditionAMG>();
+  velocity_amg_preconditioner->initialize(velocity_matrix, parameter_ml);
+
+  // The time derivative contributes alpha * Lp^-1 to the inverse of the
+  // Schur complement, alpha being the coefficient of the velocity mass matrix
+  // of the last assembly (the first BDF coefficient)
+  block_preconditioner = std::make_shared<GLSBlockSchurPreconditioner>(
+    system_matrix,
+    *velocity_amg_preconditioner,
+    *pressure_mass_preconditioner,
+    *pressure_laplacian_preconditioner,
+    locally_owned_velocity_dofs,
+    locally_owned_pressure_dofs,
+    this->simulation_parameters.physical_properties.viscosity,
+    time_derivative_coefficient);
+}
+
 template <int dim>
 void
 GLSNavierStokesSolver<dim>::solve_system_GMRES(const bool   initial_step,
@@ -1536,6 +1829,67 @@ GLSNavierStokesSolver<dim>::solve_system_AMG(const bool   initial_step,
   }
 }
 
+template <int dim>
+void
+GLSNavierStokesSolver<dim>::solve_system_block_AMG(
+  const bool   initial_step,
+  const double absolute_residual,
+  const double relative_residual,
+  const bool   renewed_matrix)
+{
+  auto &system_rhs          = this->system_rhs;
+  auto &nonzero_constraints = this->nonzero_constraints;
+
+  const AffineConstraints<double> &constraints_used =
+    initial_step ? nonzero_constraints : this->zero_constraints;
+
+  const double linear_solver_tolerance =
+    std::max(relative_residual * system_rhs.l2_norm(), absolute_residual);
+  if (this->simulation_parameters.linear_solver.verbosity !=
+      Parameters::Verbosity::quiet)
+    {
+      this->pcout << "  -Tolerance of iterative solver is : "
+                  << linear_solver_tolerance << std::endl;
+    }
+  TrilinosWrappers::MPI::Vector completely_distributed_solution(
+    this->locally_owned_dofs, this->mpi_communicator);
+
+  SolverControl solver_control(
+    this->simulation_parameters.linear_solver.max_iterations,
+    linear_solver_tolerance,
+    true,
+    true);
+
+  SolverGMRES<TrilinosWrappers::MPI::Vector>::AdditionalData
+    solver_parameters(
+      this->simulation_parameters.linear_solver.max_krylov_vectors);
+
+  SolverGMRES<TrilinosWrappers::MPI::Vector> solver(solver_control,
+                                                    solver_parameters);
+
+  if (renewed_matrix || !block_preconditioner)
+    setup_block_AMG();
+
+  {
+    TimerOutput::Scope t(this->computing_timer, "solve_linear_system");
+
+    solver.solve(system_matrix,
+                 completely_distributed_solution,
+                 system_rhs,
+                 *block_preconditioner);
+
+    if (this->simulation_parameters.linear_solver.verbosity !=
+        Parameters::Verbosity::quiet)
+      {
+        this->pcout << "  -Iterative solver took : "
+                    << solver_control.last_step() << " steps " << std::endl;
+      }
+
+    constraints_used.distribute(completely_distributed_solution);
+
+    this->newton_update = completely_distributed_solution;
+  }
+}
 
 template <int dim>
 void
@@ -20,7 +20,9 @@
 
 #include "solvers/gls_nitsche_navier_stokes.h"
 
-#include <deal.II/numerics/fe_field_function.h>
+#include <deal.II/base/table.h>
+
+#include <deal.II/fe/fe_values.h>
 
 #include <deal.II/particles/data_out.h>
 
@@ -62,11 +64,28 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::assemble_nitsche_restriction()
   dealii::Vector<double> local_rhs(dofs_per_cell);
 
   Tensor<1, spacedim> velocity;
+  Tensor<1, spacedim> solid_velocity_value;
   Function<spacedim> *solid_velocity = solid.get_solid_velocity();
 
   // Penalization terms
   const double beta = this->simulation_parameters.nitsche->beta;
 
+  // The component of each DoF is only required for the velocity DoFs, which
+  // are gathered once instead of querying the finite element in the loops
+  // over the particles
+  std::vector<unsigned int> velocity_dofs;
+  std::vector<unsigned int> component_of_dof(dofs_per_cell);
+  for (unsigned int k = 0; k < dofs_per_cell; ++k)
+    {
+      component_of_dof[k] = this->fe.system_to_component_index(k).first;
+      if (component_of_dof[k] < spacedim)
+        velocity_dofs.push_back(k);
+    }
+
+  // Values of the shape functions at the particles of the current cell,
+  // indexed by particle and by DoF
+  Table<2, double> shape_values;
+
   // Loop over all local particles
   auto particle = solid_ph->begin();
   while (particle != solid_ph->end())
@@ -90,50 +109,53 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::assemble_nitsche_restriction()
 
       const auto pic = solid_ph->particles_in_cell(cell);
       Assert(pic.begin() == particle, ExcInternalError());
+
+      // Evaluate the shape functions at all the particles of the cell once,
+      // these values are used for the velocity, the matrix and the rhs
+      shape_values.reinit(solid_ph->n_particles_in_cell(cell), dofs_per_cell);
+      unsigned int q = 0;
+      for (const auto &p : pic)
+        {
+          const auto &ref_q = p.get_reference_location();
+          for (const unsigned int k : velocity_dofs)
+            shape_values(q, k) = this->fe.shape_value(k, ref_q);
+          ++q;
+        }
+
+      const auto &evaluation_point = this->evaluation_point;
+
+      q = 0;
       for (const auto &p : pic)
         {
-          velocity           = 0;
-          const auto &ref_q  = p.get_reference_location();
           const auto &real_q = p.get_location();
           const auto &JxW    = p.get_properties()[0];
 
-          for (unsigned int k = 0; k < dofs_per_cell; ++k)
-            {
-              const auto comp_k = this->fe.system_to_component_index(k).first;
-              if (comp_k < spacedim)
-                {
-                  // Get the velocity at non-quadrature point (particle in
-                  // fluid)
-                  auto &evaluation_point = this->evaluation_point;
-                  velocity[comp_k] += evaluation_point[fluid_dof_indices[k]] *
-                                      this->fe.shape_value(k, ref_q);
-                }
-            }
-          for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          const double penalty_JxW = penalty_parameter * beta * JxW;
+
+          // Get the velocity at non-quadrature point (particle in fluid)
+          velocity = 0;
+          for (const unsigned int k : velocity_dofs)
+            velocity[component_of_dof[k]] +=
+              evaluation_point[fluid_dof_indices[k]] * shape_values(q, k);
+
+          for (unsigned int d = 0; d < spacedim; ++d)
+            solid_velocity_value[d] = solid_velocity->value(real_q, d);
+
+          for (const unsigned int i : velocity_dofs)
             {
-              const auto comp_i = this->fe.system_to_component_index(i).first;
-              if (comp_i < spacedim)
+              const auto   comp_i  = component_of_dof[i];
+              const double phi_i_q = shape_values(q, i);
+              if (assemble_matrix)
                 {
-                  if (assemble_matrix)
-                    {
-                      for (unsigned int j = 0; j < dofs_per_cell; ++j)
-                        {
-                          const auto comp_j =
-                            this->fe.system_to_component_index(j).first;
-                          if (comp_i == comp_j)
-                            local_matrix(i, j) +=
-                              penalty_parameter * beta *
-                              this->fe.shape_value(i, ref_q) *
-                              this->fe.shape_value(j, ref_q) * JxW;
-                        }
-                    }
-                  local_rhs(i) += -penalty_parameter * beta * velocity[comp_i] *
-                                    this->fe.shape_value(i, ref_q) * JxW +
-                                  penalty_parameter * beta *
-                                    solid_velocity->value(real_q, comp_i) *
-                                    this->fe.shape_value(i, ref_q) * JxW;
+                  for (const unsigned int j : velocity_dofs)
+                    if (comp_i == component_of_dof[j])
+                      local_matrix(i, j) +=
+                        penalty_JxW * phi_i_q * shape_values(q, j);
                 }
+              local_rhs(i) += penalty_JxW * phi_i_q *
+                              (solid_velocity_value[comp_i] - velocity[comp_i]);
             }
+          ++q;
         }
       const AffineConstraints<double> &constraints_used =
         this->zero_constraints;
@@ -156,10 +178,6 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::calculate_forces_on_solid()
   std::shared_ptr<Particles::ParticleHandler<spacedim>> solid_ph =
     solid.get_solid_particle_handler();
 
-  const unsigned int dofs_per_cell = this->fe.dofs_per_cell;
-
-  std::vector<types::global_dof_index> fluid_dof_indices(dofs_per_cell);
-
   Tensor<2, spacedim> velocity_gradient;
   double              pressure;
   Tensor<1, spacedim> normal_vector;
@@ -170,6 +188,13 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::calculate_forces_on_solid()
   const double viscosity =
     this->simulation_parameters.physical_properties.viscosity;
 
+  const FEValuesExtractors::Vector velocities(0);
+  const FEValuesExtractors::Scalar pressure_extractor(spacedim);
+
+  std::vector<Point<spacedim>>     reference_locations;
+  std::vector<Tensor<2, spacedim>> velocity_gradients;
+  std::vector<double>              pressure_values;
+
   // Loop over all local particles
   auto particle = solid_ph->begin();
   while (particle != solid_ph->end())
@@ -177,26 +202,37 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::calculate_forces_on_solid()
       const auto &cell = particle->get_surrounding_cell(*this->triangulation);
       const auto &dh_cell =
         typename DoFHandler<spacedim>::cell_iterator(*cell, &this->dof_handler);
-      dh_cell->get_dof_indices(fluid_dof_indices);
 
       const auto pic = solid_ph->particles_in_cell(cell);
       Assert(pic.begin() == particle, ExcInternalError());
 
-      // Generate FEField functoin to evaluate values and gradients
-      // at the particle location
-      auto &evaluation_point = this->evaluation_point;
-      Functions::FEFieldFunction<spacedim,
-                                 DoFHandler<spacedim>,
-                                 TrilinosWrappers::MPI::Vector>
-        fe_field(this->dof_handler, evaluation_point);
+      // Evaluate the velocity gradients and the pressure at all the
+      // particles of the cell at once, using the reference locations of the
+      // particles as a quadrature rule
+      reference_locations.clear();
+      for (const auto &p : pic)
+        reference_locations.push_back(p.get_reference_location());
+
+      const unsigned int n_particles = reference_locations.size();
+      velocity_gradients.resize(n_particles);
+      pressure_values.resize(n_particles);
 
-      fe_field.set_active_cell(dh_cell);
+      FEValues<spacedim> fe_values(this->fe,
+                                   Quadrature<spacedim>(reference_locations),
+                                   update_values | update_gradients);
+      fe_values.reinit(dh_cell);
 
+      auto &evaluation_point = this->evaluation_point;
+      fe_values[velocities].get_function_gradients(evaluation_point,
+                                                   velocity_gradients);
+      fe_values[pressure_extractor].get_function_values(evaluation_point,
+                                                        pressure_values);
+
+      unsigned int q = 0;
       for (const auto &p : pic)
         {
-          velocity_gradient = 0;
-          pressure          = 0;
-          const auto &q     = p.get_location();
+          velocity_gradient = velocity_gradients[q];
+          pressure          = pressure_values[q];
           const auto &JxW   = p.get_properties()[0];
           normal_vector[0]  = -p.get_properties()[1];
           normal_vector[1]  = -p.get_properties()[2];
@@ -205,13 +241,6 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::calculate_forces_on_solid()
               normal_vector[2] = -p.get_properties()[3];
             }
 
-          for (int k = 0; k < spacedim; ++k)
-            {
-              velocity_gradient[k] = fe_field.gradient(q, k);
-            }
-
-          pressure = fe_field.value(q, 3);
-
           for (int d = 0; d < dim; ++d)
             {
               fluid_pressure[d][d] = pressure;
@@ -221,6 +250,7 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::calculate_forces_on_solid()
             viscosity * (velocity_gradient + transpose(velocity_gradient)) -
             fluid_pressure;
           force += fluid_stress * normal_vector * JxW;
+          ++q;
         }
 
       particle = pic.end();
@@ -297,6 +327,38 @@ GLSNitscheNavierStokesSolver<dim, spacedim>::postprocess_solid_forces()
   solid_forces_table.write_text(output);
 }
 
+template <int dim, int spacedim>
+unsigned int
+GLSNitscheNavierStokesSolver<dim, spacedim>::cell_weight(
+  const typename parallel::distributed::Triangulation<spacedim>::cell_iterator
+    &cell,
+  const typename parallel::distributed::Triangulation<spacedim>::CellStatus
+    status) const
+{
+  const unsigned int particle_weight =
+    this->simulation_parameters.mesh_adaptation.immersed_cell_weight;
+
+  if (status ==
+        parallel::distributed::Triangulation<spacedim>::CELL_PERSIST ||
+      status == parallel::distributed::Triangulation<spacedim>::CELL_REFINE)
+    return solid.n_particles_in_cell(cell) * particle_weight;
+
+  else if (status ==
+           parallel::distributed::Triangulation<spacedim>::CELL_COARSEN)
+    {
+      unsigned int n_particles_in_cell = 0;
+      for (unsigned int child_index = 0;
+           child_index < GeometryInfo<spacedim>::max_children_per_cell;
+           ++child_index)
+        n_particles_in_cell +=
+          solid.n_particles_in_cell(cell->child(child_index));
+
+      return n_particles_in_cell * particle_weight;
+    }
+
+  return 0;
+}
+
 template <int dim, int spacedim>
 void
 GLSNitscheNavierStokesSolver<dim, spacedim>::solve()
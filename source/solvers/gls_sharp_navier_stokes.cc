@@ -25,16 +25,30 @@
 #include "core/time_integration_utilities.h"
 #include "core/utilities.h"
 
+#include <cfloat>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
 // Constructor for class GLSNavierStokesSolver
 template <int dim>
 GLSSharpNavierStokesSolver<dim>::GLSSharpNavierStokesSolver(
   SimulationParameters<dim> &p_nsparam)
   : GLSNavierStokesSolver<dim>(p_nsparam)
-{}
+  , point_locator(this->dof_handler)
+  , sharp_edge_stencils_outdated(true)
+{
+  // The stencils hold dof indices and cells, they are rebuilt after any
+  // change of the triangulation
+  tria_change_connection = this->triangulation->signals.any_change.connect(
+    [&]() { sharp_edge_stencils_outdated = true; });
+}
 
 template <int dim>
 GLSSharpNavierStokesSolver<dim>::~GLSSharpNavierStokesSolver()
-{}
+{
+  tria_change_connection.disconnect();
+}
 
 template <int dim>
 void
@@ -84,6 +98,24 @@ GLSSharpNavierStokesSolver<dim>::define_particles()
   particles = this->simulation_parameters.particlesParameters.particles;
   table_f.resize(particles.size());
   table_t.resize(particles.size());
+
+  if (dim == 3)
+    force_evaluation_directions = fibonacci_sphere_directions(
+      this->simulation_parameters.particlesParameters.nb_force_eval);
+
+  if (this->simulation_parameters.particlesParameters.integrate_motion)
+    {
+      AssertThrow(
+        this->simulation_parameters.particlesParameters.calculate_force_ib,
+        ExcMessage(
+          "The integration of the motion of the particles requires the "
+          "calculation of the forces on the immersed boundaries"));
+
+      particles_dem = std::make_shared<IBParticlesDEM<dim>>(
+        this->simulation_parameters.particlesParameters,
+        this->simulation_parameters.physical_properties.density);
+      particles_dem->update_walls(*this->triangulation);
+    }
 }
 
 
@@ -141,6 +173,45 @@ GLSSharpNavierStokesSolver<dim>::refine_ib()
 }
 
 
+template <int dim>
+unsigned int
+GLSSharpNavierStokesSolver<dim>::cell_weight(
+  const typename parallel::distributed::Triangulation<dim>::cell_iterator &cell,
+  const typename parallel::distributed::Triangulation<dim>::CellStatus
+  /*status*/) const
+{
+  // The cell is cut if its vertices are on both sides of the surface of a
+  // particle. For a coarsened or refined cell, the test is done on the parent
+  // cell, which is sufficient to balance the load.
+  for (unsigned int p = 0; p < particles.size(); ++p)
+    {
+      unsigned int count_small = 0;
+      for (unsigned int v = 0; v < GeometryInfo<dim>::vertices_per_cell; ++v)
+        {
+          if ((cell->vertex(v) - particles[p].position).norm() <=
+              particles[p].radius)
+            ++count_small;
+        }
+      if (count_small > 0 &&
+          count_small < GeometryInfo<dim>::vertices_per_cell)
+        return this->simulation_parameters.mesh_adaptation.immersed_cell_weight;
+    }
+  return 0;
+}
+
+template <int dim>
+typename DoFHandler<dim>::active_cell_iterator
+GLSSharpNavierStokesSolver<dim>::locate_cell(
+  const Point<dim> &                                    point,
+  const typename DoFHandler<dim>::active_cell_iterator &hint)
+{
+  const auto cell = point_locator.find_cell(point, hint);
+  if (cell != this->dof_handler.end())
+    return cell;
+
+  return find_cell_around_point_with_tree(this->dof_handler, point);
+}
+
 template <int dim>
 void
 GLSSharpNavierStokesSolver<dim>::force_on_ib()
@@ -201,6 +272,10 @@ GLSSharpNavierStokesSolver<dim>::force_on_ib()
           double fx_p_2 = 0;
           double fy_p_2 = 0;
 
+          // Cell found for the previous point, successive evaluation points
+          // are close to each other and are located from this cell first.
+          typename DoFHandler<dim>::active_cell_iterator cell_hint;
+
 
           // loop on all the evaluation point
 
@@ -247,13 +322,10 @@ GLSSharpNavierStokesSolver<dim>::force_on_ib()
                     eval_point[0] + surf_normal[0] * (nb_step + 1) * step_ratio,
                     eval_point[1] +
                       surf_normal[1] * (nb_step + 1) * step_ratio);
-                  /*const auto &cell_iter =
-                    GridTools::find_active_cell_around_point(this->dof_handler,
-                                                             eval_point_iter);*/
                   // std::cout << "before cell found " << i << std::endl;
-                  const auto &cell_iter =
-                    find_cell_around_point_with_tree(this->dof_handler,
-                                                     eval_point_iter);
+                  const auto cell_iter =
+                    locate_cell(eval_point_iter, cell_hint);
+                  cell_hint = cell_iter;
                   // std::cout << "cell found " << i<< std::endl;
                   // std::cout << "cell found v index " << cell_vertex_map.first
                   // << std::endl; std::cout << "cell found map " <<
@@ -325,9 +397,7 @@ GLSSharpNavierStokesSolver<dim>::force_on_ib()
 
 
 
-              const auto &cell_2 =
-                find_cell_around_point_with_tree(this->dof_handler,
-                                                 second_point);
+              const auto cell_2 = locate_cell(second_point, cell_hint);
 
 
 
@@ -337,14 +407,10 @@ GLSSharpNavierStokesSolver<dim>::force_on_ib()
               // &cell_2=this->vertices_to_cell[cell_vertex_map.first][cell_vertex_map.second];
               if (cell_2->is_locally_owned())
                 {
-                  const auto &cell_3 =
-                    find_cell_around_point_with_tree(this->dof_handler,
-                                                     third_point);
+                  const auto cell_3 = locate_cell(third_point, cell_2);
                   // =
                   // this->vertices_to_cell[cell_vertex_map.first][cell_vertex_map.second];
-                  const auto &cell_4 =
-                    find_cell_around_point_with_tree(this->dof_handler,
-                                                     fourth_point);
+                  const auto cell_4 = locate_cell(fourth_point, cell_3);
                   // const auto &cell_4 =
                   // this->vertices_to_cell[cell_vertex_map.first][cell_vertex_map.second];
                   cell_2->get_dof_indices(local_dof_indices);
@@ -529,6 +595,10 @@ GLSSharpNavierStokesSolver<dim>::force_on_ib()
           // unsigned int nb_eval_total   = Utilities::MPI::sum(nb_eval,
           // this->mpi_communicator);
 
+          particles[p].forces[0]  = fx_p_2_ + fx_v_;
+          particles[p].forces[1]  = fy_p_2_ + fy_v_;
+          particles[p].torques[2] = t_torque_;
+
 
           // Present the solution of the force on the boundary of the particle p
           if (this->this_mpi_process == 0)
@@ -604,438 +674,278 @@ GLSSharpNavierStokesSolver<dim>::force_on_ib()
     }
 
 
-  // same structure as for the 2d case but used 3d variables  so there is 1 more
-  // vector on the surface for the evaluation
+  // The surface of the sphere is sampled by the Fibonacci lattice, every
+  // evaluation point represents the same area of the surface. The stencil of
+  // a point is the same as in 2D, with two tangent vectors instead of one.
   if (dim == 3)
     {
-      QGauss<dim>   q_formula(this->fe.degree + 1);
-      FEValues<dim> fe_values(this->fe, q_formula, update_quadrature_points);
-
-      double mu = this->simulation_parameters.physical_properties.viscosity;
+      const double mu =
+        this->simulation_parameters.physical_properties.viscosity;
       MappingQ1<dim>                                immersed_map;
       std::map<types::global_dof_index, Point<dim>> support_points;
       DoFTools::map_dofs_to_support_points(immersed_map,
                                            this->dof_handler,
                                            support_points);
 
-
       std::vector<types::global_dof_index> local_dof_indices(
         this->fe.dofs_per_cell);
       std::vector<types::global_dof_index> local_dof_indices_2(
         this->fe.dofs_per_cell);
       std::vector<types::global_dof_index> local_dof_indices_3(
         this->fe.dofs_per_cell);
-      unsigned int nb_evaluation =
-        this->simulation_parameters.particlesParameters.nb_force_eval;
 
-      // the number of evaluation is round up to the closest square number so
-      // there is the same number of evaluation in theta and phi direction
-      nb_evaluation = ceil(pow(nb_evaluation, 0.5));
+      const unsigned int nb_evaluation = force_evaluation_directions.size();
+      const double       step_ratio    = 0.5;
+      const double       step          = dr * step_ratio;
+
+      // Bounding box of the locally owned cells, enlarged by the maximal
+      // length of a stencil. The evaluation points outside of this box
+      // cannot have their stencil in a locally owned cell and are skipped
+      // without being located.
+      const double margin =
+        2 * GridTools::maximal_cell_diameter(*this->triangulation);
+      Point<dim> local_box_min;
+      Point<dim> local_box_max;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          local_box_min[d] = DBL_MAX;
+          local_box_max[d] = -DBL_MAX;
+        }
+      for (const auto &cell : this->dof_handler.active_cell_iterators())
+        if (cell->is_locally_owned())
+          for (unsigned int v = 0; v < GeometryInfo<dim>::vertices_per_cell;
+               ++v)
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                local_box_min[d] =
+                  std::min(local_box_min[d], cell->vertex(v)[d]);
+                local_box_max[d] =
+                  std::max(local_box_max[d], cell->vertex(v)[d]);
+              }
+
+      // Pressure force, viscous force and torque of every particle, summed
+      // over the processes in a single reduction
+      const unsigned int  n_values = 9;
+      std::vector<double> local_values(particles.size() * n_values, 0);
+      std::vector<double> global_values(particles.size() * n_values, 0);
+
+      const std::vector<std::string> torque_names = {"T_x", "T_y", "T_z"};
+      const std::vector<std::string> force_names  = {"f_x", "f_y", "f_z"};
 
       for (unsigned int p = 0; p < particles.size(); ++p)
         {
-          const double center_x = particles[p].position[0];
-          const double center_y = particles[p].position[1];
-          const double center_z = particles[p].position[2];
+          const double radius = particles[p].radius;
+          const double da     = 4 * PI * radius * radius / nb_evaluation;
 
-          double torque_x = 0;
-          double torque_y = 0;
-          double torque_z = 0;
+          Tensor<1, dim> f_p;
+          Tensor<1, dim> f_v;
+          Tensor<1, 3>   torque;
 
-          // unsigned int nb_eval =0;
-
-          double fx_v = 0;
-          double fy_v = 0;
-          double fz_v = 0;
-
-          double fx_p_2 = 0;
-          double fy_p_2 = 0;
-          double fz_p_2 = 0;
+          typename DoFHandler<dim>::active_cell_iterator cell_hint;
 
           for (unsigned int i = 0; i < nb_evaluation; ++i)
             {
-              for (unsigned int j = 0; j < nb_evaluation; ++j)
+              // Orthonormal basis of the surface at the evaluation point. The
+              // first tangent is built from the axis which is the least
+              // aligned with the normal.
+              const Tensor<1, 3> &direction = force_evaluation_directions[i];
+              Tensor<1, 3>        axis;
+              if (std::abs(direction[2]) < 0.9)
+                axis[2] = 1;
+              else
+                axis[0] = 1;
+              Tensor<1, 3> tangent_1_3d = cross_product_3d(direction, axis);
+              tangent_1_3d /= tangent_1_3d.norm();
+              const Tensor<1, 3> tangent_2_3d =
+                cross_product_3d(direction, tangent_1_3d);
+
+              Tensor<1, dim> normal;
+              Tensor<1, dim> tangent_1;
+              Tensor<1, dim> tangent_2;
+              for (unsigned int d = 0; d < dim; ++d)
                 {
-                  Tensor<1, dim, double> surf_normal;
-                  Tensor<1, dim, double> surf_vect_1;
-                  Tensor<1, dim, double> surf_vect_2;
-
-                  double theta  = (i + 0.5) * PI / (nb_evaluation);
-                  double phi    = j * 2 * PI / (nb_evaluation);
-                  double dtheta = PI / (nb_evaluation);
-                  double dphi   = 2 * PI / (nb_evaluation);
-
-                  double da =
-                    particles[p].radius * particles[p].radius * dphi *
-                    (-cos(theta + dtheta / 2) + cos(theta - dtheta / 2));
-
-                  const Point<dim> eval_point(
-                    particles[p].radius * sin(theta) * cos(phi) + center_x,
-                    particles[p].radius * sin(theta) * sin(phi) + center_y,
-                    particles[p].radius * cos(theta) + center_z);
-
-                  double step_ratio = 0.5;
-                  surf_normal[0]    = dr * (sin(theta) * cos(phi));
-                  surf_normal[1]    = dr * (sin(theta) * sin(phi));
-                  surf_normal[2]    = dr * (cos(theta));
-
-                  surf_vect_1[0] = dr * (sin(theta + PI / 2) * cos(phi));
-                  surf_vect_1[1] = dr * (sin(theta + PI / 2) * sin(phi));
-                  surf_vect_1[2] = dr * (cos(theta + PI / 2));
+                  normal[d]    = direction[d];
+                  tangent_1[d] = tangent_1_3d[d];
+                  tangent_2[d] = tangent_2_3d[d];
+                }
 
-                  surf_vect_2 = cross_product_3d(surf_normal, surf_vect_1);
-                  surf_vect_2 = dr * surf_vect_2 / surf_vect_2.norm();
+              const Point<dim> eval_point =
+                particles[p].position + radius * normal;
+
+              bool outside_local_box = false;
+              for (unsigned int d = 0; d < dim; ++d)
+                if (eval_point[d] < local_box_min[d] - margin ||
+                    eval_point[d] > local_box_max[d] + margin)
+                  outside_local_box = true;
+              if (outside_local_box)
+                continue;
+
+              // Step in the normal direction until the point used for the
+              // stencil is not in a cell cut by the boundary
+              unsigned int nb_step    = 0;
+              bool         cell_found = false;
+              while (cell_found == false)
+                {
+                  const Point<dim> eval_point_2 =
+                    eval_point + (nb_step + 1) * step * normal;
 
+                  const auto cell_iter = locate_cell(eval_point_2, cell_hint);
+                  cell_hint            = cell_iter;
 
-                  unsigned int nb_step    = 0;
-                  bool         cell_found = false;
+                  if (cell_iter->is_artificial())
+                    break;
 
-                  while (cell_found == false)
+                  cell_iter->get_dof_indices(local_dof_indices);
+                  unsigned int count_small = 0;
+                  for (unsigned int j = 0; j < local_dof_indices.size(); ++j)
                     {
-                      Point<dim> eval_point_2(
-                        eval_point[0] +
-                          surf_normal[0] * (nb_step + 1) * step_ratio,
-                        eval_point[1] +
-                          surf_normal[1] * (nb_step + 1) * step_ratio,
-                        eval_point[2] +
-                          surf_normal[2] * (nb_step + 1) * step_ratio);
-
-                      const auto &cell_iter =
-                        find_cell_around_point_with_tree(this->dof_handler,
-                                                         eval_point_2);
-
-                      if (cell_iter->is_artificial() == false)
-                        {
-                          cell_iter->get_dof_indices(local_dof_indices);
-
-                          unsigned int count_small = 0;
-                          if (dim == 3)
-                            {
-                              center_immersed(0) = particles[p].position[0];
-                              center_immersed(1) = particles[p].position[1];
-                              center_immersed(2) = particles[p].position[2];
-                            }
-                          for (unsigned int j = 0; j < local_dof_indices.size();
-                               ++j)
-                            {
-                              // Count the number of dof that ar smaller or
-                              // larger then the radius of the particles if all
-                              // the dof are on one side the cell is not cut by
-                              // the boundary meaning we dont have to do
-                              // anything
-
-                              if ((support_points[local_dof_indices[j]] -
-                                   center_immersed)
-                                    .norm() <= particles[p].radius)
-                                {
-                                  ++count_small;
-                                }
-                            }
-
-                          if (count_small != 0 and
-                              count_small != local_dof_indices.size())
-                            {
-                              cell_found = false;
-                            }
-                          else
-                            {
-                              cell_found = true;
-                            }
+                      if ((support_points[local_dof_indices[j]] -
+                           particles[p].position)
+                            .norm() <= radius)
+                        ++count_small;
+                    }
 
+                  cell_found = (count_small == 0 ||
+                                count_small == local_dof_indices.size());
+                  if (cell_found == false)
+                    nb_step += 1;
+                }
 
-                          if (cell_found == false)
-                            nb_step += 1;
-                        }
-                      else
-                        {
-                          break;
-                        }
+              const Point<dim> second_point =
+                eval_point + (nb_step + 1) * step * normal;
+              const Point<dim> third_point  = second_point + step * normal;
+              const Point<dim> fourth_point = third_point + step * normal;
+
+              const auto cell_2 = locate_cell(second_point, cell_hint);
+              if (!cell_2->is_locally_owned())
+                continue;
+
+              const auto cell_3 = locate_cell(third_point, cell_2);
+              const auto cell_4 = locate_cell(fourth_point, cell_3);
+              cell_2->get_dof_indices(local_dof_indices);
+              cell_3->get_dof_indices(local_dof_indices_2);
+              cell_4->get_dof_indices(local_dof_indices_3);
+
+              const Point<dim> second_point_v =
+                immersed_map.transform_real_to_unit_cell(cell_2, second_point);
+              const Point<dim> third_point_v =
+                immersed_map.transform_real_to_unit_cell(cell_3, third_point);
+              const Point<dim> fourth_point_v =
+                immersed_map.transform_real_to_unit_cell(cell_4, fourth_point);
+
+              // Interpolate the velocity and the pressure at the points of
+              // the stencil
+              Tensor<1, dim> u_2;
+              Tensor<1, dim> u_3;
+              double         P1 = 0;
+              double         P2 = 0;
+              double         P3 = 0;
+              for (unsigned int j = 0; j < local_dof_indices.size(); ++j)
+                {
+                  const unsigned int component_i =
+                    this->fe.system_to_component_index(j).first;
+                  auto &present_solution = this->present_solution;
+                  if (component_i < dim)
+                    {
+                      u_2[component_i] +=
+                        this->fe.shape_value(j, second_point_v) *
+                        present_solution(local_dof_indices[j]);
+                      u_3[component_i] +=
+                        this->fe.shape_value(j, third_point_v) *
+                        present_solution(local_dof_indices_2[j]);
                     }
-
-                  const Point<dim> second_point(
-                    eval_point[0] + surf_normal[0] * (nb_step + 1) * step_ratio,
-                    eval_point[1] + surf_normal[1] * (nb_step + 1) * step_ratio,
-                    eval_point[2] +
-                      surf_normal[2] * (nb_step + 1) * step_ratio);
-
-                  const Point<dim> third_point(
-                    second_point[0] + surf_normal[0] * step_ratio,
-                    second_point[1] + surf_normal[1] * step_ratio,
-                    second_point[2] + surf_normal[2] * step_ratio);
-
-                  const Point<dim> fourth_point(
-                    third_point[0] + surf_normal[0] * step_ratio,
-                    third_point[1] + surf_normal[1] * step_ratio,
-                    third_point[2] + surf_normal[2] * step_ratio);
-
-                  const auto &cell_2 =
-                    find_cell_around_point_with_tree(this->dof_handler,
-                                                     second_point);
-
-                  // if (cell_vertex_map.first!=vertices_to_cell.size()+1) {
-                  // const auto &cell_2 =
-                  // this->vertices_to_cell[cell_vertex_map.first][cell_vertex_map.second];
-                  if (cell_2->is_locally_owned())
+                  if (component_i == dim)
                     {
-                      const auto &cell_3 =
-                        find_cell_around_point_with_tree(this->dof_handler,
-                                                         third_point);
-                      // const auto &cell_3 =
-                      // this->vertices_to_cell[cell_vertex_map.first][cell_vertex_map.second];
-                      const auto &cell_4 =
-                        find_cell_around_point_with_tree(this->dof_handler,
-                                                         fourth_point);
-                      // const auto &cell_4 =
-                      // this->vertices_to_cell[cell_vertex_map.first][cell_vertex_map.second];
-                      cell_2->get_dof_indices(local_dof_indices);
-                      cell_3->get_dof_indices(local_dof_indices_2);
-                      cell_4->get_dof_indices(local_dof_indices_3);
-
-                      // Define the tensor used for the velocity evaluation.
-                      Tensor<1, dim, double> u_1;
-                      Tensor<1, dim, double> u_2;
-                      Tensor<1, dim, double> u_3;
-                      double                 P1 = 0;
-                      double                 P2 = 0;
-                      double                 P3 = 0;
-
-                      // Define the velocity component of the particle at the
-                      // boundary on the reference point in 3 d the only
-                      // rotation is around the z axis
-                      u_1[0] = particles[p].omega[1] * particles[p].radius *
-                                 surf_normal[2] / surf_normal.norm() -
-                               particles[p].omega[2] * particles[p].radius *
-                                 surf_normal[1] / surf_normal.norm();
-                      u_1[1] = particles[p].omega[2] * particles[p].radius *
-                                 surf_normal[0] / surf_normal.norm() -
-                               particles[p].omega[0] * particles[p].radius *
-                                 surf_normal[2] / surf_normal.norm();
-                      u_1[2] = particles[p].omega[0] * particles[p].radius *
-                                 surf_normal[1] / surf_normal.norm() -
-                               particles[p].omega[1] * particles[p].radius *
-                                 surf_normal[0] / surf_normal.norm();
-
-                      // Projection of the speed of the boundary on the plan of
-                      // the surface used for evaluation
-                      double U1_1 =
-                        (surf_vect_1[0] * u_1[0] + surf_vect_1[1] * u_1[1] +
-                         surf_vect_1[2] * u_1[2]) /
-                        surf_vect_1.norm();
-
-                      double U1_2 =
-                        (surf_vect_2[0] * u_1[0] + surf_vect_2[1] * u_1[1] +
-                         surf_vect_2[2] * u_1[2]) /
-                        surf_vect_2.norm();
-
-
-                      // Used support function of the cell to define the
-                      // interpolation of the velocity
-                      Point<dim> second_point_v =
-                        immersed_map.transform_real_to_unit_cell(cell_2,
-                                                                 second_point);
-                      Point<dim> third_point_v =
-                        immersed_map.transform_real_to_unit_cell(cell_3,
-                                                                 third_point);
-                      Point<dim> fourth_point_v =
-                        immersed_map.transform_real_to_unit_cell(cell_4,
-                                                                 fourth_point);
-
-
-                      cell_3->get_dof_indices(local_dof_indices_2);
-                      for (unsigned int j = 0; j < local_dof_indices.size();
-                           ++j)
-                        {
-                          const unsigned int component_i =
-                            this->fe.system_to_component_index(j).first;
-                          auto &present_solution = this->present_solution;
-                          if (component_i < dim)
-                            {
-                              u_2[component_i] +=
-                                this->fe.shape_value(j, second_point_v) *
-                                present_solution(local_dof_indices[j]);
-
-                              u_3[component_i] +=
-                                this->fe.shape_value(j, third_point_v) *
-                                present_solution(local_dof_indices_2[j]);
-                            }
-                          if (component_i == dim)
-                            {
-                              P1 += this->fe.shape_value(j, second_point_v) *
-                                    present_solution(local_dof_indices[j]);
-                              P2 += this->fe.shape_value(j, third_point_v) *
-                                    present_solution(local_dof_indices_2[j]);
-                              P3 += this->fe.shape_value(j, fourth_point_v) *
-                                    present_solution(local_dof_indices_3[j]);
-                            }
-                        }
-
-                      // Evaluate the solution in the reference frame of the
-                      // particle
-                      u_2[0] = u_2[0] - particles[p].velocity[0];
-                      u_2[1] = u_2[1] - particles[p].velocity[1];
-                      u_2[2] = u_2[2] - particles[p].velocity[2];
-                      u_3[0] = u_3[0] - particles[p].velocity[0];
-                      u_3[1] = u_3[1] - particles[p].velocity[1];
-                      u_3[2] = u_3[2] - particles[p].velocity[2];
-
-                      double U2_1 =
-                        (surf_vect_1[0] * u_2[0] + surf_vect_1[1] * u_2[1] +
-                         surf_vect_1[2] * u_2[2]) /
-                        surf_vect_1.norm();
-                      double U3_1 =
-                        (surf_vect_1[0] * u_3[0] + surf_vect_1[1] * u_3[1] +
-                         surf_vect_1[2] * u_3[2]) /
-                        surf_vect_1.norm();
-                      double U2_2 =
-                        (surf_vect_2[0] * u_2[0] + surf_vect_2[1] * u_2[1] +
-                         surf_vect_2[2] * u_2[2]) /
-                        surf_vect_2.norm();
-                      double U3_2 =
-                        (surf_vect_2[0] * u_3[0] + surf_vect_2[1] * u_3[1] +
-                         surf_vect_2[2] * u_3[2]) /
-                        surf_vect_2.norm();
-
-                      double U1_r =
-                        (surf_normal[0] * u_1[0] + surf_normal[1] * u_1[1] +
-                         surf_normal[2] * u_1[2]) /
-                        surf_normal.norm();
-                      double U2_r =
-                        (surf_normal[0] * u_2[0] + surf_normal[1] * u_2[1] +
-                         surf_normal[2] * u_2[2]) /
-                        surf_normal.norm();
-                      double U3_r =
-                        (surf_normal[0] * u_3[0] + surf_normal[1] * u_3[1] +
-                         surf_normal[2] * u_3[2]) /
-                        surf_normal.norm();
-
-                      double du_dn_1_1 =
-                        (U2_1 /
-                           (particles[p].radius +
-                            surf_normal.norm() * (nb_step + 1) * step_ratio) -
-                         U1_1 / particles[p].radius) /
-                        ((nb_step + 1) * surf_normal.norm() * step_ratio);
-
-                      double du_dn_2_1 =
-                        (U3_1 /
-                           (particles[p].radius +
-                            surf_normal.norm() * (nb_step + 2) * step_ratio) -
-                         U2_1 /
-                           (particles[p].radius +
-                            surf_normal.norm() * (nb_step + 1) * step_ratio)) /
-                        (surf_normal.norm() * step_ratio);
-
-                      double du_dn_1_2 =
-                        (U2_2 /
-                           (particles[p].radius +
-                            surf_normal.norm() * (nb_step + 1) * step_ratio) -
-                         U1_2 / particles[p].radius) /
-                        ((nb_step + 1) * surf_normal.norm() * step_ratio);
-
-                      double du_dn_2_2 =
-                        (U3_2 /
-                           (particles[p].radius +
-                            surf_normal.norm() * (nb_step + 2) * step_ratio) -
-                         U2_2 /
-                           (particles[p].radius +
-                            surf_normal.norm() * (nb_step + 1) * step_ratio)) /
-                        (surf_normal.norm() * step_ratio);
-
-
-                      double du_dr_1 =
-                        (U2_r - U1_r) /
-                        ((nb_step + 1) * surf_normal.norm() * step_ratio);
-
-                      double du_dr_2 =
-                        (U3_r - U2_r) / (surf_normal.norm() * step_ratio);
-
-                      double du_dn_1 = du_dn_1_1 - (du_dn_2_1 - du_dn_1_1) *
-                                                     (nb_step + 1) /
-                                                     ((nb_step + 1) + 1);
-
-                      double du_dn_2 = du_dn_1_2 - (du_dn_2_2 - du_dn_1_2) *
-                                                     (nb_step + 1) /
-                                                     ((nb_step + 1) + 1);
-
-                      double du_dr = du_dr_1 - (du_dr_2 - du_dr_1) *
-                                                 (nb_step + 1) /
-                                                 ((nb_step + 1) + 1);
-
-                      double P_local = P1 + (nb_step + 1) * (P1 - P2) +
-                                       ((nb_step + 2) * (nb_step + 1) / 2) *
-                                         ((P1 - P2) - (P2 - P3));
-
-                      double local_fx_v =
-                        ((-mu * du_dr * 2 * surf_normal[0] /
-                          surf_normal.norm()) +
-                         (-particles[p].radius * mu * du_dn_1 * surf_vect_1[0] /
-                          surf_vect_1.norm()) +
-                         (-particles[p].radius * mu * du_dn_2 * surf_vect_2[0] /
-                          surf_vect_2.norm())) *
-                        da;
-
-                      double local_fy_v =
-                        ((-mu * du_dr * 2 * surf_normal[1] /
-                          surf_normal.norm()) +
-                         (-particles[p].radius * mu * du_dn_1 * surf_vect_1[1] /
-                          surf_vect_1.norm()) +
-                         (-particles[p].radius * mu * du_dn_2 * surf_vect_2[1] /
-                          surf_vect_2.norm())) *
-                        da;
-
-                      double local_fz_v =
-                        ((-mu * du_dr * 2 * surf_normal[2] /
-                          surf_normal.norm()) +
-                         (-particles[p].radius * mu * du_dn_1 * surf_vect_1[2] /
-                          surf_vect_1.norm()) +
-                         (-particles[p].radius * mu * du_dn_2 * surf_vect_2[2] /
-                          surf_vect_2.norm())) *
-                        da;
-
-                      double local_fx_p_2 =
-                        P_local * da * surf_normal[0] / surf_normal.norm();
-                      double local_fy_p_2 =
-                        P_local * da * surf_normal[1] / surf_normal.norm();
-                      double local_fz_p_2 =
-                        P_local * da * surf_normal[2] / surf_normal.norm();
-
-                      fx_v += -local_fx_v;
-                      fy_v += -local_fy_v;
-                      fz_v += -local_fz_v;
-                      fx_p_2 += -local_fx_p_2;
-                      fy_p_2 += -local_fy_p_2;
-                      fz_p_2 += -local_fz_p_2;
-
-                      torque_x += local_fy_v * surf_normal[2] /
-                                    surf_normal.norm() * particles[p].radius -
-                                  local_fz_v * surf_normal[1] /
-                                    surf_normal.norm() * particles[p].radius;
-                      torque_y += local_fz_v * surf_normal[0] /
-                                    surf_normal.norm() * particles[p].radius -
-                                  local_fx_v * surf_normal[2] /
-                                    surf_normal.norm() * particles[p].radius;
-                      torque_z += local_fx_v * surf_normal[1] /
-                                    surf_normal.norm() * particles[p].radius -
-                                  local_fy_v * surf_normal[0] /
-                                    surf_normal.norm() * particles[p].radius;
-                      // nb_eval+=1;
+                      P1 += this->fe.shape_value(j, second_point_v) *
+                            present_solution(local_dof_indices[j]);
+                      P2 += this->fe.shape_value(j, third_point_v) *
+                            present_solution(local_dof_indices_2[j]);
+                      P3 += this->fe.shape_value(j, fourth_point_v) *
+                            present_solution(local_dof_indices_3[j]);
                     }
-                  //}
                 }
+
+              // Velocity of the boundary and of the fluid in the reference
+              // frame of the particle
+              Tensor<1, dim> u_1;
+              for (unsigned int d = 0; d < dim; ++d)
+                u_1[d] = radius * cross_product_3d(particles[p].omega,
+                                                   direction)[d];
+              u_2 -= particles[p].velocity;
+              u_3 -= particles[p].velocity;
+
+              // 2nd order stencils of the derivatives at the boundary with a
+              // variable length between the points
+              const double d_1         = (nb_step + 1) * step;
+              const double extrapolate = (nb_step + 1.) / (nb_step + 2.);
+
+              const double du_dn_1_1 =
+                ((u_2 * tangent_1) / (radius + d_1) -
+                 (u_1 * tangent_1) / radius) /
+                d_1;
+              const double du_dn_2_1 =
+                ((u_3 * tangent_1) / (radius + d_1 + step) -
+                 (u_2 * tangent_1) / (radius + d_1)) /
+                step;
+              const double du_dn_1_2 =
+                ((u_2 * tangent_2) / (radius + d_1) -
+                 (u_1 * tangent_2) / radius) /
+                d_1;
+              const double du_dn_2_2 =
+                ((u_3 * tangent_2) / (radius + d_1 + step) -
+                 (u_2 * tangent_2) / (radius + d_1)) /
+                step;
+              const double du_dr_1 = ((u_2 - u_1) * normal) / d_1;
+              const double du_dr_2 = ((u_3 - u_2) * normal) / step;
+
+              const double du_dn_1 =
+                du_dn_1_1 - (du_dn_2_1 - du_dn_1_1) * extrapolate;
+              const double du_dn_2 =
+                du_dn_1_2 - (du_dn_2_2 - du_dn_1_2) * extrapolate;
+              const double du_dr = du_dr_1 - (du_dr_2 - du_dr_1) * extrapolate;
+
+              // 3rd order stencil of the pressure at the boundary
+              const double P_local = P1 + (nb_step + 1) * (P1 - P2) +
+                                     ((nb_step + 2) * (nb_step + 1) / 2) *
+                                       ((P1 - P2) - (P2 - P3));
+
+              const Tensor<1, dim> local_f_v =
+                (-mu * du_dr * 2 * normal -
+                 radius * mu * (du_dn_1 * tangent_1 + du_dn_2 * tangent_2)) *
+                da;
+              const Tensor<1, dim> local_f_p = P_local * da * normal;
+
+              f_v -= local_f_v;
+              f_p -= local_f_p;
+
+              Tensor<1, 3> local_f_v_3d;
+              for (unsigned int d = 0; d < dim; ++d)
+                local_f_v_3d[d] = local_f_v[d];
+              torque += radius * cross_product_3d(local_f_v_3d, direction);
             }
-          double t_torque_x =
-            Utilities::MPI::sum(torque_x, this->mpi_communicator);
-          double t_torque_y =
-            Utilities::MPI::sum(torque_y, this->mpi_communicator);
-          double t_torque_z =
-            Utilities::MPI::sum(torque_z, this->mpi_communicator);
-          double fx_p_2_ = Utilities::MPI::sum(fx_p_2, this->mpi_communicator);
-          double fy_p_2_ = Utilities::MPI::sum(fy_p_2, this->mpi_communicator);
-          double fz_p_2_ = Utilities::MPI::sum(fz_p_2, this->mpi_communicator);
-          double fx_v_   = Utilities::MPI::sum(fx_v, this->mpi_communicator);
-          double fy_v_   = Utilities::MPI::sum(fy_v, this->mpi_communicator);
-          double fz_v_   = Utilities::MPI::sum(fz_v, this->mpi_communicator);
-          // unsigned int nb_eval_total   = Utilities::MPI::sum(nb_eval,
-          // this->mpi_communicator);
+
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              local_values[p * n_values + d]           = f_p[d];
+              local_values[p * n_values + dim + d]     = f_v[d];
+              local_values[p * n_values + 2 * dim + d] = torque[d];
+            }
+        }
+
+      Utilities::MPI::sum(local_values, this->mpi_communicator, global_values);
+
+      for (unsigned int p = 0; p < particles.size(); ++p)
+        {
+          Tensor<1, dim> f_p;
+          Tensor<1, dim> f_v;
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              f_p[d]                 = global_values[p * n_values + d];
+              f_v[d]                 = global_values[p * n_values + dim + d];
+              particles[p].forces[d] = f_p[d] + f_v[d];
+            }
+          for (unsigned int d = 0; d < 3; ++d)
+            particles[p].torques[d] = global_values[p * n_values + 2 * dim + d];
 
           if (this->this_mpi_process == 0)
             {
@@ -1049,62 +959,45 @@ GLSSharpNavierStokesSolver<dim>::force_on_ib()
                   std::cout << "+------------------------------------------+"
                             << std::endl;
 
-                  std::cout << "particle : " << p
-                            << " total_torque_x :" << t_torque_x << std::endl;
-                  std::cout << "particle : " << p
-                            << " total_torque_y :" << t_torque_y << std::endl;
-                  std::cout << "particle : " << p
-                            << " total_torque_z :" << t_torque_z << std::endl;
-                  std::cout << "fx_P: " << fx_p_2_ << std::endl;
-                  std::cout << "fy_P: " << fy_p_2_ << std::endl;
-                  std::cout << "fz_P: " << fz_p_2_ << std::endl;
-                  std::cout << "fx_v: " << fx_v_ << std::endl;
-                  std::cout << "fy_v: " << fy_v_ << std::endl;
-                  std::cout << "fz_v: " << fz_v_ << std::endl;
-                  // std::cout << "nb eval" << nb_eval_total << std::endl;
+                  std::cout << "particle : " << p << " total_torque_x :"
+                            << particles[p].torques[0] << std::endl;
+                  std::cout << "particle : " << p << " total_torque_y :"
+                            << particles[p].torques[1] << std::endl;
+                  std::cout << "particle : " << p << " total_torque_z :"
+                            << particles[p].torques[2] << std::endl;
+                  std::cout << "fx_P: " << f_p[0] << std::endl;
+                  std::cout << "fy_P: " << f_p[1] << std::endl;
+                  std::cout << "fz_P: " << f_p[2] << std::endl;
+                  std::cout << "fx_v: " << f_v[0] << std::endl;
+                  std::cout << "fy_v: " << f_v[1] << std::endl;
+                  std::cout << "fz_v: " << f_v[2] << std::endl;
+
+                  const unsigned int log_precision =
+                    this->simulation_parameters.simulation_control
+                      .log_precision;
                   table_t[p].add_value("particle ID", p);
-                  if (this->simulation_parameters.simulation_control.method !=
-                      Parameters::SimulationControl::TimeSteppingMethod::steady)
-                    table_t[p].add_value(
-                      "time", this->simulation_control->get_current_time());
-                  table_t[p].add_value("T_x", t_torque_x);
-                  table_t[p].set_precision("T_x",
-                                           this->simulation_parameters
-                                             .simulation_control.log_precision);
-                  table_t[p].add_value("T_y", t_torque_x);
-                  table_t[p].set_precision("T_y",
-                                           this->simulation_parameters
-                                             .simulation_control.log_precision);
-                  table_t[p].add_value("T_z", t_torque_x);
-                  table_t[p].set_precision("T_z",
-                                           this->simulation_parameters
-                                             .simulation_control.log_precision);
-
-
-
                   table_f[p].add_value("particle ID", p);
                   if (this->simulation_parameters.simulation_control.method !=
                       Parameters::SimulationControl::TimeSteppingMethod::steady)
-                    table_f[p].add_value(
-                      "time", this->simulation_control->get_current_time());
-
-                  table_f[p].add_value("f_x", fx_p_2_ + fx_v_);
-                  table_f[p].add_value("f_y", fy_p_2_ + fy_v_);
-
-                  table_f[p].set_precision("f_x",
-                                           this->simulation_parameters
-                                             .simulation_control.log_precision);
-                  table_f[p].set_precision("f_y",
-                                           this->simulation_parameters
-                                             .simulation_control.log_precision);
-
-                  table_f[p].add_value("f_z", fz_p_2_ + fz_v_);
-                  table_f[p].set_precision("f_z",
-                                           this->simulation_parameters
-                                             .simulation_control.log_precision);
+                    {
+                      table_t[p].add_value(
+                        "time", this->simulation_control->get_current_time());
+                      table_f[p].add_value(
+                        "time", this->simulation_control->get_current_time());
+                    }
+                  for (unsigned int d = 0; d < dim; ++d)
+                    {
+                      table_t[p].add_value(torque_names[d],
+                                           particles[p].torques[d]);
+                      table_t[p].set_precision(torque_names[d], log_precision);
+                      table_f[p].add_value(force_names[d],
+                                           particles[p].forces[d]);
+                      table_f[p].set_precision(force_names[d], log_precision);
+                    }
                 }
             }
         }
+
       if (this->this_mpi_process == 0)
         {
           if (this->simulation_parameters.forces_parameters.verbosity ==
@@ -1151,6 +1044,85 @@ GLSSharpNavierStokesSolver<dim>::write_force_ib()
 }
 
 
+template <int dim>
+void
+GLSSharpNavierStokesSolver<dim>::write_checkpoint()
+{
+  NavierStokesBase<dim, TrilinosWrappers::MPI::Vector, IndexSet>::
+    write_checkpoint();
+
+  if (this->this_mpi_process == 0)
+    {
+      const std::string prefix =
+        this->simulation_parameters.restart_parameters.filename;
+      const std::string filename = prefix + ".ib_particles";
+      std::ofstream     output(filename.c_str());
+      output << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+      output << "IB particles " << particles.size() << std::endl;
+      for (unsigned int p = 0; p < particles.size(); ++p)
+        {
+          output << "Particle " << p << std::endl;
+          output << "Position";
+          for (unsigned int d = 0; d < dim; ++d)
+            output << " " << particles[p].position[d];
+          output << std::endl << "Velocity";
+          for (unsigned int d = 0; d < dim; ++d)
+            output << " " << particles[p].velocity[d];
+          output << std::endl << "Omega";
+          for (unsigned int d = 0; d < 3; ++d)
+            output << " " << particles[p].omega[d];
+          output << std::endl;
+        }
+
+      if (particles_dem)
+        particles_dem->save(prefix);
+    }
+}
+
+template <int dim>
+void
+GLSSharpNavierStokesSolver<dim>::read_checkpoint()
+{
+  NavierStokesBase<dim, TrilinosWrappers::MPI::Vector, IndexSet>::
+    read_checkpoint();
+
+  // Every process stores all the particles, hence every process reads them
+  const std::string prefix =
+    this->simulation_parameters.restart_parameters.filename;
+  const std::string filename = prefix + ".ib_particles";
+  std::ifstream     input(filename.c_str());
+  AssertThrow(input, ExcFileNotOpen(filename));
+
+  std::string  buffer;
+  unsigned int n_particles;
+  input >> buffer >> buffer >> n_particles;
+  AssertThrow(n_particles == particles.size(),
+              ExcMessage("The number of particles of the restart file <" +
+                         filename +
+                         "> differs from the number of particles of the "
+                         "parameter file"));
+
+  for (unsigned int p = 0; p < particles.size(); ++p)
+    {
+      unsigned int id;
+      input >> buffer >> id;
+      input >> buffer;
+      for (unsigned int d = 0; d < dim; ++d)
+        input >> particles[p].position[d];
+      input >> buffer;
+      for (unsigned int d = 0; d < dim; ++d)
+        input >> particles[p].velocity[d];
+      input >> buffer;
+      for (unsigned int d = 0; d < 3; ++d)
+        input >> particles[p].omega[d];
+    }
+  AssertThrow(!input.fail(), ExcIO());
+
+  if (particles_dem)
+    particles_dem->read(prefix);
+}
+
 template <int dim>
 void
 GLSSharpNavierStokesSolver<dim>::postprocess_fd(bool firstIter)
@@ -1341,14 +1313,96 @@ GLSSharpNavierStokesSolver<dim>::calculate_L2_error_particles()
 }
 
 
+template <int dim>
+bool
+GLSSharpNavierStokesSolver<dim>::sharp_edge_stencils_are_valid() const
+{
+  if (sharp_edge_stencils_outdated ||
+      sharp_edge_particles.size() != particles.size())
+    return false;
+
+  for (unsigned int p = 0; p < particles.size(); ++p)
+    {
+      if (particles[p].position != sharp_edge_particles[p].position ||
+          particles[p].velocity != sharp_edge_particles[p].velocity ||
+          particles[p].omega != sharp_edge_particles[p].omega ||
+          particles[p].radius != sharp_edge_particles[p].radius ||
+          particles[p].pressure_location !=
+            sharp_edge_particles[p].pressure_location)
+        return false;
+    }
+  return true;
+}
+
 template <int dim>
 void
-GLSSharpNavierStokesSolver<dim>::sharp_edge()
+GLSSharpNavierStokesSolver<dim>::sharp_edge(const bool assemble_matrix)
+{
+  TimerOutput::Scope t(this->computing_timer, "assemble_sharp");
+
+  if (!sharp_edge_stencils_are_valid())
+    {
+      vertices_cell_mapping();
+      build_sharp_edge_stencils();
+      sharp_edge_particles         = particles;
+      sharp_edge_stencils_outdated = false;
+    }
+
+  // Overwrite the rows of the dofs constrained by the immersed boundaries.
+  // The matrix is not modified by the assembly of the right-hand side only,
+  // its rows are thus only overwritten when the matrix is assembled.
+  auto &system_rhs       = this->system_rhs;
+  auto &evaluation_point = this->evaluation_point;
+  for (const auto &row : sharp_edge_rows)
+    {
+      if (assemble_matrix)
+        for (const auto &entry : row.entries)
+          this->system_matrix.set(row.index, entry.first, entry.second);
+
+      if (row.has_rhs)
+        {
+          double rhs = row.rhs_value;
+          if (row.residual)
+            for (const auto &entry : row.entries)
+              if (entry.second != 0)
+                rhs -= entry.second * evaluation_point(entry.first);
+          system_rhs(row.index) = rhs;
+        }
+    }
+
+  if (assemble_matrix)
+    this->system_matrix.compress(VectorOperation::insert);
+  system_rhs.compress(VectorOperation::insert);
+}
+
+template <int dim>
+void
+GLSSharpNavierStokesSolver<dim>::build_sharp_edge_stencils()
 {
   // This function defines a Immersed Boundary based on the sharp edge method on
   // a hyper_shere of dim=2 or dim=3
 
-  TimerOutput::Scope t(this->computing_timer, "assemble_sharp");
+  // The rows are gathered in ordered maps since a row may be overwritten by
+  // the stencils of more than one cell. The last value set is kept, as if it
+  // had been written directly in the matrix.
+  std::map<types::global_dof_index, std::map<types::global_dof_index, double>>
+    row_entries;
+
+  // Value of the right-hand side of the rows and whether the residual of the
+  // row must be subtracted from it
+  std::map<types::global_dof_index, std::pair<double, bool>> row_rhs;
+
+  auto set_entry = [&row_entries](const types::global_dof_index row,
+                                  const types::global_dof_index column,
+                                  const double                  value) {
+    row_entries[row][column] = value;
+  };
+  auto set_rhs = [&row_rhs](const types::global_dof_index row,
+                            const double                  value,
+                            const bool                    residual) {
+    row_rhs[row] = std::make_pair(value, residual);
+  };
+
   using numbers::PI;
   Point<dim>                                                  center_immersed;
   Point<dim>                                                  pressure_bridge;
@@ -1478,7 +1532,7 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                        o < local_dof_indices_3.size();
                                        ++o)
                                     {
-                                      this->system_matrix.set(
+                                      set_entry(
                                         inside_index,
                                         local_dof_indices_3[o],
                                         0);
@@ -1488,16 +1542,11 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                         }
                     }
 
-                  // this->system_matrix.clear_row(inside_index);
                   // set new equation for the first pressure dof of the
                   // cell. this is the new reference pressure inside a
                   // particle
-                  this->system_matrix.set(inside_index,
-                                          local_dof_indices[dim],
-                                          sum_line);
-                  auto &system_rhs = this->system_rhs;
-                  system_rhs(inside_index) =
-                    0 - this->local_evaluation_point(inside_index) * sum_line;
+                  set_entry(inside_index, local_dof_indices[dim], sum_line);
+                  set_rhs(inside_index, 0, true);
                 }
 
 
@@ -1728,8 +1777,7 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                         << std::endl;
                               std::cout << "second point  " << second_point
                                         << std::endl;
-                              cell_2 = GridTools::find_active_cell_around_point(
-                                this->dof_handler, second_point);
+                              cell_2 = locate_cell(second_point, cell);
                               cell_2->get_dof_indices(local_dof_indices_2);
                               std::cout
                                 << "dof point  "
@@ -1785,7 +1833,7 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                            o < local_dof_indices_3.size();
                                            ++o)
                                         {
-                                          this->system_matrix.set(
+                                          set_entry(
                                             global_index_overwrite,
                                             local_dof_indices_3[o],
                                             0);
@@ -1799,32 +1847,19 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                           if (cell_2 == cell)
                             {
                               skip_stencil = true;
-                              this->system_matrix.set(global_index_overwrite,
-                                                      global_index_overwrite,
-                                                      sum_line);
-                              auto &system_rhs = this->system_rhs;
-                              system_rhs(global_index_overwrite) = 0;
+                              set_entry(global_index_overwrite,
+                                        global_index_overwrite,
+                                        sum_line);
+                              set_rhs(global_index_overwrite, 0, false);
                               // Tolerence to define a intersection of
                               // the DOF and IB
                               if (vect_dist.norm() <= 1e-12 * dr)
                                 {
                                   do_rhs = true;
                                 }
-                              else
-                                {
-                                  system_rhs(global_index_overwrite) = 0;
-                                }
                             }
 
 
-                          // Define the variable used for the
-                          // extrapolation of the actual solution at the
-                          // boundary in order to define the correction
-                          double local_interp_sol   = 0;
-                          double local_interp_sol_2 = 0;
-                          double local_interp_sol_3 = 0;
-                          double local_interp_sol_4 = 0;
-
                           // Define the new matrix entry for this dof
                           if (skip_stencil == false)
                             {
@@ -1849,13 +1884,11 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                           // then 5 the stencil is define
                                           // trough direct extrapolation of
                                           // the cell
-                                          auto &evaluation_point =
-                                            this->evaluation_point;
 
                                           if (this->simulation_parameters
                                                 .particlesParameters.order == 1)
                                             {
-                                              this->system_matrix.set(
+                                              set_entry(
                                                 global_index_overwrite,
                                                 local_dof_indices_2[j],
                                                 sp_2 *
@@ -1863,19 +1896,12 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                                       j, second_point_v) *
                                                     sum_line +
                                                   dof_2 * sum_line);
-                                              local_interp_sol +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, second_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
                                             }
 
                                           if (this->simulation_parameters
                                                 .particlesParameters.order == 2)
                                             {
-                                              this->system_matrix.set(
+                                              set_entry(
                                                 global_index_overwrite,
                                                 local_dof_indices_2[j],
                                                 sp_3 *
@@ -1887,26 +1913,11 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                                     this->fe.shape_value(
                                                       j, third_point_v) *
                                                     sum_line);
-
-                                              local_interp_sol +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, second_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_2 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, third_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
                                             }
                                           if (this->simulation_parameters
                                                 .particlesParameters.order == 3)
                                             {
-                                              this->system_matrix.set(
+                                              set_entry(
                                                 global_index_overwrite,
                                                 local_dof_indices_2[j],
                                                 sp_4 *
@@ -1922,50 +1933,22 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                                     this->fe.shape_value(
                                                       j, fourth_point_v) *
                                                     sum_line);
-
-                                              local_interp_sol +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, second_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_2 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, third_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_3 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, fourth_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
                                             }
                                           if (this->simulation_parameters
                                                 .particlesParameters.order > 4)
                                             {
-                                              this->system_matrix.set(
+                                              set_entry(
                                                 global_index_overwrite,
                                                 local_dof_indices_2[j],
                                                 this->fe.shape_value(
                                                   j, first_point_v) *
                                                   sum_line);
-                                              local_interp_sol +=
-                                                this->fe.shape_value(
-                                                  j, first_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
                                             }
 
                                           if (this->simulation_parameters
                                                 .particlesParameters.order == 4)
                                             {
-                                              this->system_matrix.set(
+                                              set_entry(
                                                 global_index_overwrite,
                                                 local_dof_indices_2[j],
                                                 dof_5 * sum_line +
@@ -1986,35 +1969,6 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                                       j, fifth_point_v) *
                                                     sum_line);
 
-
-                                              local_interp_sol +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, second_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_2 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, third_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_3 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, fourth_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_4 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, fifth_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
                                             }
                                         }
                                       // Then the third point trough
@@ -2022,31 +1976,22 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                       // cell in which the third point is
                                       else
                                         {
-                                          auto &evaluation_point =
-                                            this->evaluation_point;
                                           if (this->simulation_parameters
                                                 .particlesParameters.order == 1)
                                             {
-                                              this->system_matrix.set(
+                                              set_entry(
                                                 global_index_overwrite,
                                                 local_dof_indices_2[j],
                                                 sp_2 *
                                                   this->fe.shape_value(
                                                     j, second_point_v) *
                                                   sum_line);
-                                              local_interp_sol +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, second_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
                                             }
 
                                           if (this->simulation_parameters
                                                 .particlesParameters.order == 2)
                                             {
-                                              this->system_matrix.set(
+                                              set_entry(
                                                 global_index_overwrite,
                                                 local_dof_indices_2[j],
                                                 sp_3 *
@@ -2057,26 +2002,11 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                                     this->fe.shape_value(
                                                       j, third_point_v) *
                                                     sum_line);
-
-                                              local_interp_sol +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, second_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_2 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, third_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
                                             }
                                           if (this->simulation_parameters
                                                 .particlesParameters.order == 3)
                                             {
-                                              this->system_matrix.set(
+                                              set_entry(
                                                 global_index_overwrite,
                                                 local_dof_indices_2[j],
                                                 sp_4 *
@@ -2091,49 +2021,21 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                                     this->fe.shape_value(
                                                       j, fourth_point_v) *
                                                     sum_line);
-
-                                              local_interp_sol +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, second_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_2 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, third_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_3 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, fourth_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
                                             }
                                           if (this->simulation_parameters
                                                 .particlesParameters.order > 4)
                                             {
-                                              this->system_matrix.set(
+                                              set_entry(
                                                 global_index_overwrite,
                                                 local_dof_indices_2[j],
                                                 this->fe.shape_value(
                                                   j, first_point_v) *
                                                   sum_line);
-                                              local_interp_sol +=
-                                                this->fe.shape_value(
-                                                  j, first_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
                                             }
                                           if (this->simulation_parameters
                                                 .particlesParameters.order == 4)
                                             {
-                                              this->system_matrix.set(
+                                              set_entry(
                                                 global_index_overwrite,
                                                 local_dof_indices_2[j],
                                                 sp_5 *
@@ -2152,35 +2054,6 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
                                                     this->fe.shape_value(
                                                       j, fifth_point_v) *
                                                     sum_line);
-
-                                              local_interp_sol +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, second_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_2 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, third_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_3 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, fourth_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
-                                              local_interp_sol_4 +=
-                                                1 *
-                                                this->fe.shape_value(
-                                                  j, fifth_point_v) *
-                                                sum_line *
-                                                evaluation_point(
-                                                  local_dof_indices_2[j]);
                                             }
                                         }
                                     }
@@ -2190,272 +2063,31 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
 
 
                           // Define the RHS of the stencil used for the
-                          // IB
+                          // IB. The value imposed is the velocity of the
+                          // boundary of the particle at the projection of
+                          // the dof on the boundary.
                           if (skip_stencil == false || do_rhs)
                             {
-                              // Different boundary condition depending
-                              // if the dof is vx ,vy or vz and if the
-                              // problem we solve is 2d or 3d.
-                              if (component_i == 0)
-                                {
-                                  double vx      = 0;
-                                  double rhs_add = 0;
-                                  if (dim == 2)
-                                    {
-                                      vx = -particles[p].omega[2] *
-                                             particles[p].radius *
-                                             ((support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed) /
-                                              (support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed)
-                                                .norm())[1] +
-                                           particles[p].velocity[0];
-                                    }
-                                  if (dim == 3)
-                                    {
-                                      vx = particles[p].omega[1] *
-                                             ((support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed) /
-                                              (support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed)
-                                                .norm())[2] *
-                                             particles[p].radius -
-                                           particles[p].omega[2] *
-                                             ((support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed) /
-                                              (support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed)
-                                                .norm())[1] *
-                                             particles[p].radius +
-                                           particles[p].velocity[0];
-                                    }
-
-                                  auto &evaluation_point =
-                                    this->evaluation_point;
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 1)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_2 -
-                                                local_interp_sol * sp_2;
-                                    }
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 2)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_3 -
-                                                local_interp_sol * sp_3 -
-                                                local_interp_sol_2 * tp_3;
-                                    }
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 3)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_4 -
-                                                local_interp_sol * sp_4 -
-                                                local_interp_sol_2 * tp_4 -
-                                                local_interp_sol_3 * fp_4;
-                                    }
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order > 4)
-                                    rhs_add = -local_interp_sol;
-
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 4)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_5 -
-                                                local_interp_sol * sp_5 -
-                                                local_interp_sol_2 * tp_5 -
-                                                local_interp_sol_3 * fp1_5 -
-                                                local_interp_sol_4 * fp2_5;
-                                    }
-
-                                  auto &system_rhs = this->system_rhs;
-                                  system_rhs(global_index_overwrite) =
-                                    vx * sum_line + rhs_add;
-                                  if (do_rhs)
-                                    system_rhs(global_index_overwrite) =
-                                      vx * sum_line -
-                                      evaluation_point(global_index_overwrite) *
-                                        sum_line;
-                                }
-                              else if (component_i == 1)
-                                {
-                                  double vy      = 0;
-                                  double rhs_add = 0;
-                                  if (dim == 2)
-                                    {
-                                      vy = particles[p].omega[2] *
-                                             particles[p].radius *
-                                             ((support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed) /
-                                              (support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed)
-                                                .norm())[0] +
-                                           particles[p].velocity[1];
-                                    }
-                                  if (dim == 3)
-                                    {
-                                      vy = particles[p].omega[2] *
-                                             ((support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed) /
-                                              (support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed)
-                                                .norm())[0] *
-                                             particles[p].radius -
-                                           particles[p].omega[0] *
-                                             ((support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed) /
-                                              (support_points
-                                                 [local_dof_indices[i]] -
-                                               center_immersed)
-                                                .norm())[2] *
-                                             particles[p].radius +
-                                           particles[p].velocity[2];
-                                    }
-
-                                  auto &evaluation_point =
-                                    this->evaluation_point;
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 1)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_2 -
-                                                local_interp_sol * sp_2;
-                                    }
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 2)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_3 -
-                                                local_interp_sol * sp_3 -
-                                                local_interp_sol_2 * tp_3;
-                                    }
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 3)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_4 -
-                                                local_interp_sol * sp_4 -
-                                                local_interp_sol_2 * tp_4 -
-                                                local_interp_sol_3 * fp_4;
-                                    }
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order > 4)
-                                    rhs_add = -local_interp_sol;
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 4)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_5 -
-                                                local_interp_sol * sp_5 -
-                                                local_interp_sol_2 * tp_5 -
-                                                local_interp_sol_3 * fp1_5 -
-                                                local_interp_sol_4 * fp2_5;
-                                    }
-
-                                  auto &system_rhs = this->system_rhs;
-                                  system_rhs(global_index_overwrite) =
-                                    vy * sum_line + rhs_add;
-                                  if (do_rhs)
-                                    system_rhs(global_index_overwrite) =
-                                      vy * sum_line -
-                                      evaluation_point(global_index_overwrite) *
-                                        sum_line;
-                                }
-                              else if (component_i == 2 && dim == 3)
-                                {
-                                  double vz =
-                                    particles[p].omega[0] *
-                                      ((support_points[local_dof_indices[i]] -
-                                        center_immersed) /
-                                       (support_points[local_dof_indices[i]] -
-                                        center_immersed)
-                                         .norm())[1] *
-                                      particles[p].radius -
-                                    particles[p].omega[1] *
-                                      ((support_points[local_dof_indices[i]] -
-                                        center_immersed) /
-                                       (support_points[local_dof_indices[i]] -
-                                        center_immersed)
-                                         .norm())[0] *
-                                      particles[p].radius +
-                                    particles[p].velocity[2];
-
-                                  double rhs_add = 0;
-                                  auto & evaluation_point =
-                                    this->evaluation_point;
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 1)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_2 -
-                                                local_interp_sol * sp_2;
-                                    }
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 2)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_3 -
-                                                local_interp_sol * sp_3 -
-                                                local_interp_sol_2 * tp_3;
-                                    }
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 3)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_4 -
-                                                local_interp_sol * sp_4 -
-                                                local_interp_sol_2 * tp_4 -
-                                                local_interp_sol_3 * fp_4;
-                                    }
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order > 4)
-                                    rhs_add = -local_interp_sol;
-                                  if (this->simulation_parameters
-                                        .particlesParameters.order == 4)
-                                    {
-                                      rhs_add = -evaluation_point(
-                                                  global_index_overwrite) *
-                                                  sum_line * dof_5 -
-                                                local_interp_sol * sp_5 -
-                                                local_interp_sol_2 * tp_5 -
-                                                local_interp_sol_3 * fp1_5 -
-                                                local_interp_sol_4 * fp2_5;
-                                    }
-
-                                  auto &system_rhs = this->system_rhs;
-                                  system_rhs(global_index_overwrite) =
-                                    vz * sum_line + rhs_add;
-                                  if (do_rhs)
-                                    system_rhs(global_index_overwrite) =
-                                      vz * sum_line -
-                                      evaluation_point(global_index_overwrite) *
-                                        sum_line;
-                                }
+                              const Tensor<1, dim> radial_direction =
+                                (support_points[local_dof_indices[i]] -
+                                 center_immersed) /
+                                (support_points[local_dof_indices[i]] -
+                                 center_immersed)
+                                  .norm();
+                              Tensor<1, 3> radial_direction_3d;
+                              for (unsigned int d = 0; d < dim; ++d)
+                                radial_direction_3d[d] = radial_direction[d];
+
+                              const double boundary_velocity =
+                                particles[p].velocity[component_i] +
+                                particles[p].radius *
+                                  cross_product_3d(
+                                    particles[p].omega,
+                                    radial_direction_3d)[component_i];
+
+                              set_rhs(global_index_overwrite,
+                                      boundary_velocity * sum_line,
+                                      true);
                             }
                         }
 
@@ -2528,11 +2160,10 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
 
                           if (dummy_dof)
                             {
-                              this->system_matrix.set(global_index_overwrite,
-                                                      global_index_overwrite,
-                                                      sum_line);
-                              auto &system_rhs = this->system_rhs;
-                              system_rhs(global_index_overwrite) = 0;
+                              set_entry(global_index_overwrite,
+                                        global_index_overwrite,
+                                        sum_line);
+                              set_rhs(global_index_overwrite, 0, false);
                             }
                         }
                     }
@@ -2541,8 +2172,25 @@ GLSSharpNavierStokesSolver<dim>::sharp_edge()
         }
     }
 
-  this->system_matrix.compress(VectorOperation::insert);
-  this->system_rhs.compress(VectorOperation::insert);
+  // Flatten the rows in the cache
+  sharp_edge_rows.clear();
+  sharp_edge_rows.reserve(row_entries.size());
+  for (const auto &entries : row_entries)
+    {
+      SharpEdgeRow row;
+      row.index = entries.first;
+      row.entries.assign(entries.second.begin(), entries.second.end());
+
+      const auto rhs = row_rhs.find(entries.first);
+      row.has_rhs    = (rhs != row_rhs.end());
+      if (row.has_rhs)
+        {
+          row.rhs_value = rhs->second.first;
+          row.residual  = rhs->second.second;
+        }
+      sharp_edge_rows.push_back(std::move(row));
+    }
+}
 }
 
 template <int dim>
@@ -3212,8 +2860,7 @@ GLSSharpNavierStokesSolver<dim>::assemble_matrix_and_rhs(
                     Parameters::SimulationControl::TimeSteppingMethod::steady,
                     Parameters::VelocitySource::VelocitySourceType::srf>();
     }
-  vertices_cell_mapping();
-  sharp_edge();
+  sharp_edge(true);
 }
 template <int dim>
 void
@@ -3330,8 +2977,7 @@ GLSSharpNavierStokesSolver<dim>::assemble_rhs(
                     Parameters::SimulationControl::TimeSteppingMethod::steady,
                     Parameters::VelocitySource::VelocitySourceType::srf>();
     }
-  vertices_cell_mapping();
-  sharp_edge();
+  sharp_edge(false);
 }
 
 template <int dim>
@@ -3388,12 +3034,20 @@ GLSSharpNavierStokesSolver<dim>::solve()
 
       this->postprocess_fd(false);
 
-      this->finish_time_step();
-
       if (this->simulation_parameters.particlesParameters.calculate_force_ib)
         force_on_ib();
       write_force_ib();
+
+      // The particles are moved after the time step, the sharp edge stencils
+      // are rebuilt at the next assembly since the particles have changed.
+      // They are moved before the checkpoint is written at the end of the
+      // time step, hence a restart resumes from their integrated state.
+      if (particles_dem)
+        particles_dem->integrate(particles,
+                                 this->simulation_control->get_time_step());
       MPI_Barrier(this->mpi_communicator);
+
+      this->finish_time_step();
     }
 
   if (this->simulation_parameters.particlesParameters.calculate_force_ib)
@@ -25,7 +25,19 @@ void
 HeatTransfer<dim>::assemble_matrix_and_rhs(
   const Parameters::SimulationControl::TimeSteppingMethod time_stepping_method)
 {
-  assemble_system<true>(time_stepping_method);
+  // The matrix of the energy equation does not depend on the temperature,
+  // only the right-hand side is assembled if the operator is unchanged
+  if (system_matrix_is_unchanged(time_stepping_method))
+    {
+      assemble_system<false>(time_stepping_method);
+      system_matrix_renewed = false;
+    }
+  else
+    {
+      assemble_system<true>(time_stepping_method);
+      store_system_matrix_state(time_stepping_method);
+      system_matrix_renewed = true;
+    }
 }
 
 
@@ -38,6 +50,32 @@ HeatTransfer<dim>::assemble_rhs(
 }
 
 
+template <int dim>
+bool
+HeatTransfer<dim>::system_matrix_is_unchanged(
+  const Parameters::SimulationControl::TimeSteppingMethod time_stepping_method)
+{
+  // The time steps and the version of the fluid solution are the same on all
+  // the processors, hence no communication is required
+  return system_matrix_is_valid &&
+         time_stepping_method == matrix_time_stepping_method &&
+         this->get_time_steps_vector() == matrix_time_steps &&
+         multiphysics->get_fluid_solution_version() == matrix_fluid_version;
+}
+
+
+template <int dim>
+void
+HeatTransfer<dim>::store_system_matrix_state(
+  const Parameters::SimulationControl::TimeSteppingMethod time_stepping_method)
+{
+  matrix_time_stepping_method = time_stepping_method;
+  matrix_time_steps           = this->get_time_steps_vector();
+  matrix_fluid_version        = multiphysics->get_fluid_solution_version();
+  system_matrix_is_valid      = true;
+}
+
+
 template <int dim>
 template <bool assemble_matrix>
 void
@@ -68,8 +106,7 @@ HeatTransfer<dim>::assemble_system(
   // 1 - n
   // 2 - n-1
   // 3 - n-2
-  std::vector<double> time_steps_vector =
-    simulation_control->get_time_steps_vector();
+  std::vector<double> time_steps_vector = this->get_time_steps_vector();
 
   // Time steps and inverse time steps which is used for numerous calculations
   const double dt  = time_steps_vector[0];
@@ -103,7 +140,7 @@ HeatTransfer<dim>::assemble_system(
 
 
   auto &source_term = simulation_parameters.sourceTerm->heat_transfer_source;
-  source_term.set_time(simulation_control->get_current_time());
+  source_term.set_time(this->get_current_time());
 
   const QGauss<dim> quadrature_formula(fe.degree + 1);
   FEValues<dim>     fe_values_ht(fe,
@@ -126,12 +163,11 @@ HeatTransfer<dim>::assemble_system(
   const MappingQ<dim> mapping(
     fe.degree, simulation_parameters.fem_parameters.qmapping_all);
 
-  const DoFHandler<dim> *dof_handler_fluid =
-    multiphysics->get_dof_handler(PhysicsID::fluid_dynamics);
-  FEValues<dim> fe_values_flow(dof_handler_fluid->get_fe(),
-                               quadrature_formula,
-                               update_values | update_quadrature_points |
-                                 update_gradients);
+  // The fluid velocity at the quadrature points is evaluated once by the
+  // multiphysics interface after each update of the fluid dynamics solution,
+  // only when an auxiliary physics is assembled
+  if (!multiphysics->fluid_quadrature_cache_is_valid())
+    multiphysics->update_fluid_quadrature_cache();
 
   // FaceValues for Robin boundary condition
   QGauss<dim - 1>   face_quadrature_formula(fe.degree + 1);
@@ -147,13 +183,6 @@ HeatTransfer<dim>::assemble_system(
   std::vector<double>         laplacian_phi_T(dofs_per_cell);
 
 
-  // Velocity values
-  const FEValuesExtractors::Vector velocities(0);
-  const FEValuesExtractors::Scalar pressure(dim);
-
-  std::vector<Tensor<1, dim>> velocity_values(n_q_points);
-  std::vector<Tensor<2, dim>> velocity_gradient_values(n_q_points);
-
   std::vector<double>         present_temperature_values(n_q_points);
   std::vector<Tensor<1, dim>> temperature_gradients(n_q_points);
   std::vector<double>         present_temperature_laplacians(n_q_points);
@@ -184,29 +213,13 @@ HeatTransfer<dim>::assemble_system(
                                               temperature_gradients);
 
 
-          typename DoFHandler<dim>::active_cell_iterator velocity_cell(
-            &(*triangulation), cell->level(), cell->index(), dof_handler_fluid);
-
-          fe_values_flow.reinit(velocity_cell);
-
-          if (multiphysics->fluid_dynamics_is_block())
-            {
-              fe_values_flow[velocities].get_function_values(
-                *multiphysics->get_block_solution(PhysicsID::fluid_dynamics),
-                velocity_values);
-              fe_values_flow[velocities].get_function_gradients(
-                *multiphysics->get_block_solution(PhysicsID::fluid_dynamics),
-                velocity_gradient_values);
-            }
-          else
-            {
-              fe_values_flow[velocities].get_function_values(
-                *multiphysics->get_solution(PhysicsID::fluid_dynamics),
-                velocity_values);
-              fe_values_flow[velocities].get_function_gradients(
-                *multiphysics->get_solution(PhysicsID::fluid_dynamics),
-                velocity_gradient_values);
-            }
+          // Velocity values
+          const auto velocity_values =
+            multiphysics->get_cached_fluid_velocity_values(
+              cell->active_cell_index());
+          const auto velocity_gradient_values =
+            multiphysics->get_cached_fluid_velocity_gradients(
+              cell->active_cell_index());
 
           // Gather present value
           fe_values_ht.get_function_values(evaluation_point,
@@ -520,7 +533,7 @@ HeatTransfer<dim>::calculate_L2_error()
   std::vector<double> q_scalar_values(n_q_points);
 
   auto &exact_solution = simulation_parameters.analytical_solution->temperature;
-  exact_solution.set_time(simulation_control->get_current_time());
+  exact_solution.set_time(this->get_current_time());
 
   double l2error = 0.;
 
@@ -583,6 +596,9 @@ HeatTransfer<dim>::percolate_time_vectors()
   solution_m3 = solution_m2;
   solution_m2 = solution_m1;
   solution_m1 = present_solution;
+
+  this->number_of_previous_solutions =
+    std::min(this->number_of_previous_solutions + 1, 3U);
 }
 
 template <int dim>
@@ -797,6 +813,11 @@ HeatTransfer<dim>::setup_dofs()
                        dsp,
                        mpi_communicator);
 
+  // The matrix and the preconditioners must be rebuilt on the new dofs
+  system_matrix_is_valid = false;
+  ilu_preconditioner.reset();
+  amg_preconditioner.reset();
+
   this->pcout << "   Number of thermal degrees of freedom: "
               << dof_handler.n_dofs() << std::endl;
 }
@@ -815,6 +836,78 @@ HeatTransfer<dim>::set_initial_conditions()
   finish_time_step();
 }
 
+template <int dim>
+void
+HeatTransfer<dim>::setup_ILU()
+{
+  const double ilu_fill = simulation_parameters.linear_solver.ilu_precond_fill;
+  const double ilu_atol = simulation_parameters.linear_solver.ilu_precond_atol;
+  const double ilu_rtol = simulation_parameters.linear_solver.ilu_precond_rtol;
+  TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
+    ilu_fill, ilu_atol, ilu_rtol, 0);
+
+  ilu_preconditioner = std::make_shared<TrilinosWrappers::PreconditionILU>();
+
+  ilu_preconditioner->initialize(system_matrix, preconditionerOptions);
+}
+
+template <int dim>
+void
+HeatTransfer<dim>::setup_AMG()
+{
+  std::vector<std::vector<bool>> constant_modes;
+  DoFTools::extract_constant_modes(dof_handler,
+                                   std::vector<bool>(1, true),
+                                   constant_modes);
+
+  const bool         elliptic              = false;
+  const bool         higher_order_elements = fe.degree > 1;
+  const unsigned int n_cycles = simulation_parameters.linear_solver.amg_n_cycles;
+  const bool         w_cycle  = simulation_parameters.linear_solver.amg_w_cycles;
+  const double       aggregation_threshold =
+    simulation_parameters.linear_solver.amg_aggregation_threshold;
+  const unsigned int smoother_sweeps =
+    simulation_parameters.linear_solver.amg_smoother_sweeps;
+  const unsigned int smoother_overlap =
+    simulation_parameters.linear_solver.amg_smoother_overlap;
+  const bool                                        output_details = false;
+  const char *                                      smoother_type  = "ILU";
+  const char *                                      coarse_type    = "ILU";
+  TrilinosWrappers::PreconditionAMG::AdditionalData preconditionerOptions(
+    elliptic,
+    higher_order_elements,
+    n_cycles,
+    w_cycle,
+    aggregation_threshold,
+    constant_modes,
+    smoother_sweeps,
+    smoother_overlap,
+    output_details,
+    smoother_type,
+    coarse_type);
+
+  Teuchos::ParameterList              parameter_ml;
+  std::unique_ptr<Epetra_MultiVector> distributed_constant_modes;
+  preconditionerOptions.set_parameters(parameter_ml,
+                                       distributed_constant_modes,
+                                       system_matrix);
+  const double ilu_fill =
+    simulation_parameters.linear_solver.amg_precond_ilu_fill;
+  const double ilu_atol =
+    simulation_parameters.linear_solver.amg_precond_ilu_atol;
+  const double ilu_rtol =
+    simulation_parameters.linear_solver.amg_precond_ilu_rtol;
+  parameter_ml.set("smoother: ifpack level-of-fill", ilu_fill);
+  parameter_ml.set("smoother: ifpack absolute threshold", ilu_atol);
+  parameter_ml.set("smoother: ifpack relative threshold", ilu_rtol);
+
+  parameter_ml.set("coarse: ifpack level-of-fill", ilu_fill);
+  parameter_ml.set("coarse: ifpack absolute threshold", ilu_atol);
+  parameter_ml.set("coarse: ifpack relative threshold", ilu_rtol);
+  amg_preconditioner = std::make_shared<TrilinosWrappers::PreconditionAMG>();
+  amg_preconditioner->initialize(system_matrix, parameter_ml);
+}
+
 template <int dim>
 void
 HeatTransfer<dim>::solve_linear_system(const bool initial_step,
@@ -840,16 +933,6 @@ HeatTransfer<dim>::solve_linear_system(const bool initial_step,
                   << linear_solver_tolerance << std::endl;
     }
 
-  const double ilu_fill = simulation_parameters.linear_solver.ilu_precond_fill;
-  const double ilu_atol = simulation_parameters.linear_solver.ilu_precond_atol;
-  const double ilu_rtol = simulation_parameters.linear_solver.ilu_precond_rtol;
-  TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
-    ilu_fill, ilu_atol, ilu_rtol, 0);
-
-  TrilinosWrappers::PreconditionILU ilu_preconditioner;
-
-  ilu_preconditioner.initialize(system_matrix, preconditionerOptions);
-
   TrilinosWrappers::MPI::Vector completely_distributed_solution(
     locally_owned_dofs, mpi_communicator);
 
@@ -866,10 +949,30 @@ HeatTransfer<dim>::solve_linear_system(const bool initial_step,
   TrilinosWrappers::SolverGMRES solver(solver_control, solver_parameters);
 
 
-  solver.solve(system_matrix,
-               completely_distributed_solution,
-               system_rhs,
-               ilu_preconditioner);
+  // The preconditioner is only set-up again when the matrix was renewed by
+  // the assembly, the energy equation being linear in temperature
+  if (simulation_parameters.multiphysics.heat_transfer_preconditioner ==
+      Parameters::Multiphysics::HeatTransferPreconditioner::amg)
+    {
+      if (system_matrix_renewed || !amg_preconditioner)
+        setup_AMG();
+
+      solver.solve(system_matrix,
+                   completely_distributed_solution,
+                   system_rhs,
+                   *amg_preconditioner);
+    }
+  else
+    {
+      if (system_matrix_renewed || !ilu_preconditioner)
+        setup_ILU();
+
+      solver.solve(system_matrix,
+                   completely_distributed_solution,
+                   system_rhs,
+                   *ilu_preconditioner);
+    }
+  system_matrix_renewed = false;
 
   if (simulation_parameters.linear_solver.verbosity !=
       Parameters::Verbosity::quiet)
@@ -1,7 +1,11 @@
+#include <deal.II/fe/fe_values.h>
+
 #include <solvers/multiphysics_interface.h>
 
 #include "solvers/heat_transfer.h"
 
+#include <fstream>
+
 
 template <int dim>
 MultiphysicsInterface<dim>::MultiphysicsInterface(
@@ -9,6 +13,9 @@ MultiphysicsInterface<dim>::MultiphysicsInterface(
   std::shared_ptr<parallel::DistributedTriangulationBase<dim>> p_triangulation,
   std::shared_ptr<SimulationControl> p_simulation_control)
   : multiphysics_parameters(nsparam.multiphysics)
+  , restart_prefix(nsparam.restart_parameters.filename)
+  , mpi_communicator(p_triangulation->get_communicator())
+  , simulation_control(p_simulation_control)
 {
   if (multiphysics_parameters.fluid_dynamics)
     {
@@ -19,6 +26,137 @@ MultiphysicsInterface<dim>::MultiphysicsInterface(
       active_physics.push_back(PhysicsID::heat_transfer);
       physics[PhysicsID::heat_transfer] = std::make_shared<HeatTransfer<dim>>(
         this, nsparam, p_triangulation, p_simulation_control);
+      physics[PhysicsID::heat_transfer]->set_time_step_ratio(
+        multiphysics_parameters.heat_transfer_time_step_ratio,
+        multiphysics_parameters.heat_transfer_subcycles);
+    }
+}
+
+template <int dim>
+void
+MultiphysicsInterface<dim>::update_fluid_quadrature_cache()
+{
+  const DoFHandler<dim> *dof_handler_fluid =
+    get_dof_handler(PhysicsID::fluid_dynamics);
+
+  const unsigned int n_q_points = fluid_quadrature.size();
+  const unsigned int n_cells =
+    dof_handler_fluid->get_triangulation().n_active_cells();
+
+  cached_fluid_velocity_values.resize(n_cells * n_q_points);
+  cached_fluid_velocity_gradients.resize(n_cells * n_q_points);
+
+  FEValues<dim> fe_values_flow(dof_handler_fluid->get_fe(),
+                               fluid_quadrature,
+                               update_values | update_gradients);
+
+  const FEValuesExtractors::Vector velocities(0);
+
+  std::vector<Tensor<1, dim>> velocity_values(n_q_points);
+  std::vector<Tensor<2, dim>> velocity_gradient_values(n_q_points);
+
+  for (const auto &cell : dof_handler_fluid->active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          fe_values_flow.reinit(cell);
+
+          if (fluid_dynamics_is_block())
+            {
+              fe_values_flow[velocities].get_function_values(
+                *get_block_solution(PhysicsID::fluid_dynamics),
+                velocity_values);
+              fe_values_flow[velocities].get_function_gradients(
+                *get_block_solution(PhysicsID::fluid_dynamics),
+                velocity_gradient_values);
+            }
+          else
+            {
+              fe_values_flow[velocities].get_function_values(
+                *get_solution(PhysicsID::fluid_dynamics), velocity_values);
+              fe_values_flow[velocities].get_function_gradients(
+                *get_solution(PhysicsID::fluid_dynamics),
+                velocity_gradient_values);
+            }
+
+          const unsigned int offset = cell->active_cell_index() * n_q_points;
+          std::copy(velocity_values.begin(),
+                    velocity_values.end(),
+                    cached_fluid_velocity_values.begin() + offset);
+          std::copy(velocity_gradient_values.begin(),
+                    velocity_gradient_values.end(),
+                    cached_fluid_velocity_gradients.begin() + offset);
+        }
+    }
+
+  fluid_quadrature_cache_valid = true;
+}
+
+template <int dim>
+void
+MultiphysicsInterface<dim>::write_time_stepping_checkpoint()
+{
+  if (Utilities::MPI::this_mpi_process(mpi_communicator) != 0 ||
+      (physics.empty() && block_physics.empty()))
+    return;
+
+  const std::string filename = restart_prefix + ".multiphysics";
+  std::ofstream     output(filename.c_str());
+  output << "Multiphysics time-stepping" << std::endl;
+  for (auto &iphys : physics)
+    {
+      output << static_cast<unsigned int>(iphys.first) << " ";
+      iphys.second->save_time_stepping(output);
+    }
+  for (auto &iphys : block_physics)
+    {
+      output << static_cast<unsigned int>(iphys.first) << " ";
+      iphys.second->save_time_stepping(output);
+    }
+}
+
+template <int dim>
+void
+MultiphysicsInterface<dim>::read_time_stepping_checkpoint()
+{
+  if (physics.empty() && block_physics.empty())
+    return;
+
+  // The physics solved with the time step of the fluid dynamics copy its
+  // time-stepping at every time step, the restart files written before the
+  // cycling of the physics was introduced can thus still be read
+  const std::string filename = restart_prefix + ".multiphysics";
+  std::ifstream     input(filename.c_str());
+  if (!input)
+    {
+      bool has_own_time_step = false;
+      for (auto &iphys : physics)
+        has_own_time_step |= iphys.second->has_own_time_step();
+      for (auto &iphys : block_physics)
+        has_own_time_step |= iphys.second->has_own_time_step();
+      AssertThrow(!has_own_time_step, ExcFileNotOpen(filename));
+      return;
+    }
+
+  std::string buffer;
+  std::getline(input, buffer);
+
+  unsigned int physics_id;
+  for (auto &iphys : physics)
+    {
+      input >> physics_id;
+      AssertThrow(physics_id == static_cast<unsigned int>(iphys.first),
+                  ExcMessage("The physics of the restart file <" + filename +
+                             "> do not match the enabled physics"));
+      iphys.second->read_time_stepping(input);
+    }
+  for (auto &iphys : block_physics)
+    {
+      input >> physics_id;
+      AssertThrow(physics_id == static_cast<unsigned int>(iphys.first),
+                  ExcMessage("The physics of the restart file <" + filename +
+                             "> do not match the enabled physics"));
+      iphys.second->read_time_stepping(input);
     }
 }
 
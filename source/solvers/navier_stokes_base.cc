@@ -35,6 +35,8 @@
 
 #include "core/time_integration_utilities.h"
 
+#include <cfloat>
+
 
 /*
  * Constructor for the Navier-Stokes base class
@@ -66,6 +68,8 @@ NavierStokesBase<dim, VectorType, DofsType>::NavierStokesBase(
   , velocity_fem_degree(p_nsparam.fem_parameters.velocity_order)
   , pressure_fem_degree(p_nsparam.fem_parameters.pressure_order)
   , number_quadrature_points(p_nsparam.fem_parameters.velocity_order + 1)
+  , assembly_max_CFL(0)
+  , assembly_diagnostics_available(false)
 {
   this->pcout.set_condition(
     Utilities::MPI::this_mpi_process(this->mpi_communicator) == 0);
@@ -102,6 +106,17 @@ NavierStokesBase<dim, VectorType, DofsType>::NavierStokesBase(
   if (simulation_parameters.timer.type == Parameters::Timer::Type::none)
     this->computing_timer.disable_output();
 
+  // Weight the cells by their computational cost when the triangulation is
+  // partitioned. The weight is calculated by the solver, since only the
+  // solver knows which cells carry additional work.
+  if (simulation_parameters.mesh_adaptation.weighted_repartitioning)
+    triangulation->signals.cell_weight.connect(
+      [&](
+        const typename parallel::distributed::Triangulation<dim>::cell_iterator
+          &cell,
+        const typename parallel::distributed::Triangulation<dim>::CellStatus
+          status) -> unsigned int { return this->cell_weight(cell, status); });
+
   // Pre-allocate the force tables to match the number of boundary conditions
   forces_on_boundaries.resize(simulation_parameters.boundary_conditions.size);
   torques_on_boundaries.resize(simulation_parameters.boundary_conditions.size);
@@ -132,6 +147,7 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocessing_flow_rate(
 {
   this->flow_rate =
     calculate_flow_rate(this->dof_handler,
+                        this->boundary_faces,
                         evaluation_point,
                         simulation_parameters.flow_control.boundary_flow_id,
                         simulation_parameters.fem_parameters,
@@ -171,8 +187,6 @@ NavierStokesBase<dim, VectorType, DofsType>::dynamic_flow_control()
 }
 
 
-// This is a primitive first implementation that could be greatly improved by
-// doing a single pass instead of N boundary passes
 template <int dim, typename VectorType, typename DofsType>
 void
 NavierStokesBase<dim, VectorType, DofsType>::postprocessing_forces(
@@ -182,6 +196,7 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocessing_forces(
 
   this->forces_on_boundaries =
     calculate_forces(this->dof_handler,
+                     this->boundary_faces,
                      evaluation_point,
                      simulation_parameters.physical_properties,
                      simulation_parameters.boundary_conditions,
@@ -251,6 +266,7 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocessing_torques(
 
   this->torques_on_boundaries =
     calculate_torques(this->dof_handler,
+                      this->boundary_faces,
                       evaluation_point,
                       simulation_parameters.physical_properties,
                       simulation_parameters.fem_parameters,
@@ -360,6 +376,71 @@ NavierStokesBase<dim, VectorType, DofsType>::percolate_time_vectors_fd()
   this->solution_m3 = this->solution_m2;
   this->solution_m2 = this->solution_m1;
   this->solution_m1 = this->present_solution;
+
+  this->number_of_previous_solutions =
+    std::min(this->number_of_previous_solutions + 1, 3U);
+}
+
+template <int dim, typename VectorType, typename DofsType>
+double
+NavierStokesBase<dim, VectorType, DofsType>::estimate_time_step_error(
+  const Parameters::SimulationControl::TimeSteppingMethod time_stepping_method)
+{
+  if (!is_bdf(time_stepping_method) ||
+      time_stepping_method ==
+        Parameters::SimulationControl::TimeSteppingMethod::steady_bdf)
+    return 0;
+
+  // The bdf3 error is estimated with a second order predictor, which
+  // overestimates its error
+  const unsigned int order = std::min(bdf_order(time_stepping_method), 2U);
+  if (this->number_of_previous_solutions < order + 1)
+    return 0;
+
+  std::vector<const VectorType *> previous_solutions = {&this->solution_m1,
+                                                        &this->solution_m2,
+                                                        &this->solution_m3};
+  previous_solutions.resize(order + 1);
+
+  this->extrapolate_solution(previous_solutions,
+                             simulation_control->get_time_steps_vector(),
+                             local_evaluation_point);
+
+  // The error of the bdf scheme is a fraction of the difference between the
+  // solution and the predictor, which depends on the error constants of the
+  // scheme (1/2 for bdf1, 2/9 for bdf2) and of the predictor (1)
+  const double error_constant = (order == 1) ? 0.5 : 2. / 9.;
+
+  VectorType solution(local_evaluation_point);
+  solution = present_solution;
+  local_evaluation_point -= solution;
+
+  // The error is only measured on the velocity, the pressure is not
+  // integrated in time and its predictor is meaningless
+  const FEValuesExtractors::Scalar pressure(dim);
+  const MappingQ<dim>              mapping(
+    this->velocity_fem_degree,
+    this->simulation_parameters.fem_parameters.qmapping_all);
+  VectorTools::interpolate(mapping,
+                           this->dof_handler,
+                           dealii::Functions::ZeroFunction<dim>(dim + 1),
+                           local_evaluation_point,
+                           this->fe.component_mask(pressure));
+  VectorTools::interpolate(mapping,
+                           this->dof_handler,
+                           dealii::Functions::ZeroFunction<dim>(dim + 1),
+                           solution,
+                           this->fe.component_mask(pressure));
+
+  const double error = error_constant / (error_constant + 1.) *
+                       local_evaluation_point.l2_norm();
+  const double error_ratio =
+    error / (simulation_parameters.simulation_control.error_tolerance *
+             std::max(solution.l2_norm(), DBL_MIN));
+
+  simulation_control->set_time_step_error(error_ratio, order);
+
+  return error_ratio;
 }
 
 template <int dim, typename VectorType, typename DofsType>
@@ -370,10 +451,20 @@ NavierStokesBase<dim, VectorType, DofsType>::finish_time_step_fd()
       Parameters::SimulationControl::TimeSteppingMethod::steady)
     {
       percolate_time_vectors_fd();
-      const double CFL = calculate_CFL(this->dof_handler,
-                                       this->present_solution,
-                                       simulation_control->get_time_step(),
-                                       mpi_communicator);
+
+      // The assembly of the last non-linear iteration was carried out at the
+      // present solution, the CFL it accumulated is reduced over the
+      // processors. Otherwise, the CFL is calculated by an additional sweep
+      // over the mesh.
+      double CFL;
+      if (simulation_parameters.simulation_control.assembly_CFL &&
+          assembly_diagnostics_available)
+        CFL = Utilities::MPI::max(assembly_max_CFL, mpi_communicator);
+      else
+        CFL = calculate_CFL(this->dof_handler,
+                            this->present_solution,
+                            simulation_control->get_time_step(),
+                            mpi_communicator);
       this->simulation_control->set_CFL(CFL);
     }
   if (this->simulation_parameters.restart_parameters.checkpoint &&
@@ -400,6 +491,12 @@ void
 NavierStokesBase<dim, VectorType, DofsType>::iterate()
 {
   auto &present_solution = this->present_solution;
+
+  // The diagonal coefficient is the same for all the stages of the sdirk
+  // schemes, the jacobian of the first stage can thus be reused by the others
+  const bool reuse_jacobian =
+    simulation_parameters.non_linear_solver.reuse_sdirk_jacobian;
+
   if (simulation_parameters.simulation_control.method ==
       Parameters::SimulationControl::TimeSteppingMethod::sdirk22)
     {
@@ -412,7 +509,8 @@ NavierStokesBase<dim, VectorType, DofsType>::iterate()
       PhysicsSolver<VectorType>::solve_non_linear_system(
         Parameters::SimulationControl::TimeSteppingMethod::sdirk22_2,
         false,
-        false);
+        false,
+        reuse_jacobian);
     }
 
   else if (simulation_parameters.simulation_control.method ==
@@ -428,19 +526,47 @@ NavierStokesBase<dim, VectorType, DofsType>::iterate()
       PhysicsSolver<VectorType>::solve_non_linear_system(
         Parameters::SimulationControl::TimeSteppingMethod::sdirk33_2,
         false,
-        false);
+        false,
+        reuse_jacobian);
 
       this->solution_m3 = present_solution;
 
       PhysicsSolver<VectorType>::solve_non_linear_system(
         Parameters::SimulationControl::TimeSteppingMethod::sdirk33_3,
         false,
-        false);
+        false,
+        reuse_jacobian);
     }
   else
     {
       PhysicsSolver<VectorType>::solve_non_linear_system(
         simulation_parameters.simulation_control.method, false, false);
+
+      // The time step is solved again with a smaller time step as long as its
+      // error is larger than the tolerance
+      if (simulation_parameters.simulation_control.adapt &&
+          simulation_parameters.simulation_control.time_step_control ==
+            Parameters::SimulationControl::TimeStepControl::error)
+        {
+          unsigned int number_of_rejections = 0;
+          while (estimate_time_step_error(
+                   simulation_parameters.simulation_control.method) > 1 &&
+                 number_of_rejections <
+                   simulation_parameters.simulation_control
+                     .max_time_step_rejections)
+            {
+              simulation_control->reject_time_step();
+              this->pcout << "Time step rejected, new time step : "
+                          << simulation_control->get_time_step() << std::endl;
+
+              present_solution = solution_m1;
+              PhysicsSolver<VectorType>::solve_non_linear_system(
+                simulation_parameters.simulation_control.method, false, false);
+              number_of_rejections++;
+            }
+        }
+
+      multiphysics->notify_fluid_solution_update();
       multiphysics->solve(simulation_parameters.simulation_control.method,
                           false);
     }
@@ -529,18 +655,35 @@ template <int dim, typename VectorType, typename DofsType>
 void
 NavierStokesBase<dim, VectorType, DofsType>::refine_mesh()
 {
+  bool mesh_refined = false;
   if (simulation_control->get_step_number() %
         this->simulation_parameters.mesh_adaptation.frequency ==
       0)
     {
       if (this->simulation_parameters.mesh_adaptation.type ==
           Parameters::MeshAdaptation::Type::kelly)
-        refine_mesh_kelly();
+        {
+          refine_mesh_kelly();
+          mesh_refined = true;
+        }
 
       else if (this->simulation_parameters.mesh_adaptation.type ==
                Parameters::MeshAdaptation::Type::uniform)
-        refine_mesh_uniform();
+        {
+          refine_mesh_uniform();
+          mesh_refined = true;
+        }
     }
+
+  // The refinement already repartitions the triangulation. Without the cell
+  // weights, the repartitioning would restore the same partition.
+  const unsigned int repartition_frequency =
+    this->simulation_parameters.mesh_adaptation.repartition_frequency;
+  if (!mesh_refined &&
+      this->simulation_parameters.mesh_adaptation.weighted_repartitioning &&
+      repartition_frequency > 0 &&
+      simulation_control->get_step_number() % repartition_frequency == 0)
+    repartition_mesh();
 }
 
 template <int dim, typename VectorType, typename DofsType>
@@ -625,60 +768,50 @@ NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_kelly()
 
   tria.prepare_coarsening_and_refinement();
 
-  // Solution transfer objects for all the solutions
-  parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer(
-    this->dof_handler);
-  parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer_m1(
-    this->dof_handler);
-  parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer_m2(
-    this->dof_handler);
-  parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer_m3(
-    this->dof_handler);
-  solution_transfer.prepare_for_coarsening_and_refinement(present_solution);
-  solution_transfer_m1.prepare_for_coarsening_and_refinement(this->solution_m1);
-  solution_transfer_m2.prepare_for_coarsening_and_refinement(this->solution_m2);
-  solution_transfer_m3.prepare_for_coarsening_and_refinement(this->solution_m3);
-
-  multiphysics->prepare_for_mesh_adaptation();
+  transfer_solutions_across_mesh_change(
+    [&]() { tria.execute_coarsening_and_refinement(); });
+}
 
+template <int dim, typename VectorType, typename DofsType>
+void
+NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_uniform()
+{
+  TimerOutput::Scope t(this->computing_timer, "refine");
 
-  tria.execute_coarsening_and_refinement();
-  this->setup_dofs();
+  transfer_solutions_across_mesh_change(
+    [&]() { this->triangulation->refine_global(1); });
+}
 
-  // Set up the vectors for the transfer
-  VectorType tmp(locally_owned_dofs, this->mpi_communicator);
-  VectorType tmp_m1(locally_owned_dofs, this->mpi_communicator);
-  VectorType tmp_m2(locally_owned_dofs, this->mpi_communicator);
-  VectorType tmp_m3(locally_owned_dofs, this->mpi_communicator);
+template <int dim, typename VectorType, typename DofsType>
+void
+NavierStokesBase<dim, VectorType, DofsType>::repartition_mesh()
+{
+  if (dynamic_cast<parallel::distributed::Triangulation<dim> *>(
+        this->triangulation.get()) == nullptr)
+    return;
 
-  // Interpolate the solution at time and previous time
-  solution_transfer.interpolate(tmp);
-  solution_transfer_m1.interpolate(tmp_m1);
-  solution_transfer_m2.interpolate(tmp_m2);
-  solution_transfer_m3.interpolate(tmp_m3);
+  auto &tria = *dynamic_cast<parallel::distributed::Triangulation<dim> *>(
+    this->triangulation.get());
 
-  // Distribute constraints
-  auto &nonzero_constraints = this->nonzero_constraints;
-  nonzero_constraints.distribute(tmp);
-  nonzero_constraints.distribute(tmp_m1);
-  nonzero_constraints.distribute(tmp_m2);
-  nonzero_constraints.distribute(tmp_m3);
+  TimerOutput::Scope t(this->computing_timer, "repartition");
 
-  // Fix on the new mesh
-  present_solution  = tmp;
-  this->solution_m1 = tmp_m1;
-  this->solution_m2 = tmp_m2;
-  this->solution_m3 = tmp_m3;
+  transfer_solutions_across_mesh_change([&]() { tria.repartition(); });
 
-  multiphysics->post_mesh_adaptation();
+  const auto minimum_maximum_cells =
+    Utilities::MPI::min_max_avg(tria.n_locally_owned_active_cells(),
+                                this->mpi_communicator);
+  this->pcout << "Minimum and maximum number of cells owned by the processors "
+                 "after repartitioning are "
+              << minimum_maximum_cells.min << " and "
+              << minimum_maximum_cells.max << std::endl;
 }
 
 template <int dim, typename VectorType, typename DofsType>
 void
-NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_uniform()
+NavierStokesBase<dim, VectorType, DofsType>::
+  transfer_solutions_across_mesh_change(
+    const std::function<void()> &change_mesh)
 {
-  TimerOutput::Scope t(this->computing_timer, "refine");
-
   // Solution transfer objects for all the solutions
   parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer(
     this->dof_handler);
@@ -696,10 +829,9 @@ NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_uniform()
 
   multiphysics->prepare_for_mesh_adaptation();
 
-  // Refine
-  this->triangulation->refine_global(1);
+  change_mesh();
 
-  setup_dofs();
+  this->setup_dofs();
 
   // Set up the vectors for the transfer
   VectorType tmp(locally_owned_dofs, this->mpi_communicator);
@@ -721,10 +853,10 @@ NavierStokesBase<dim, VectorType, DofsType>::refine_mesh_uniform()
   nonzero_constraints.distribute(tmp_m3);
 
   // Fix on the new mesh
-  present_solution  = tmp;
-  this->solution_m1 = tmp_m1;
-  this->solution_m2 = tmp_m2;
-  this->solution_m3 = tmp_m3;
+  this->present_solution = tmp;
+  this->solution_m1      = tmp_m1;
+  this->solution_m2      = tmp_m2;
+  this->solution_m3      = tmp_m3;
 
   multiphysics->post_mesh_adaptation();
 }
@@ -908,6 +1040,140 @@ NavierStokesBase<dim, VectorType, DofsType>::postprocess_fd(bool firstIter)
     this->write_output_results(present_solution);
 }
 
+template <int dim, typename VectorType, typename DofsType>
+void
+NavierStokesBase<dim, VectorType, DofsType>::define_non_zero_constraints()
+{
+  const MappingQ<dim> mapping(
+    this->velocity_fem_degree,
+    this->simulation_parameters.fem_parameters.qmapping_all);
+  FEValuesExtractors::Vector velocities(0);
+
+  // Non-zero constraints
+  auto &nonzero_constraints = this->get_nonzero_constraints();
+  {
+    nonzero_constraints.clear();
+
+    DoFTools::make_hanging_node_constraints(this->dof_handler,
+                                            nonzero_constraints);
+    for (unsigned int i_bc = 0;
+         i_bc < this->simulation_parameters.boundary_conditions.size;
+         ++i_bc)
+      {
+        if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
+            BoundaryConditions::BoundaryType::noslip)
+          {
+            VectorTools::interpolate_boundary_values(
+              mapping,
+              this->dof_handler,
+              this->simulation_parameters.boundary_conditions.id[i_bc],
+              dealii::Functions::ZeroFunction<dim>(dim + 1),
+              nonzero_constraints,
+              this->fe.component_mask(velocities));
+          }
+        else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
+                 BoundaryConditions::BoundaryType::slip)
+          {
+            std::set<types::boundary_id> no_normal_flux_boundaries;
+            no_normal_flux_boundaries.insert(
+              this->simulation_parameters.boundary_conditions.id[i_bc]);
+            VectorTools::compute_no_normal_flux_constraints(
+              this->dof_handler,
+              0,
+              no_normal_flux_boundaries,
+              nonzero_constraints);
+          }
+        else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
+                 BoundaryConditions::BoundaryType::function)
+          {
+            VectorTools::interpolate_boundary_values(
+              mapping,
+              this->dof_handler,
+              this->simulation_parameters.boundary_conditions.id[i_bc],
+              NavierStokesFunctionDefined<dim>(
+                &this->simulation_parameters.boundary_conditions
+                   .bcFunctions[i_bc]
+                   .u,
+                &this->simulation_parameters.boundary_conditions
+                   .bcFunctions[i_bc]
+                   .v,
+                &this->simulation_parameters.boundary_conditions
+                   .bcFunctions[i_bc]
+                   .w),
+              nonzero_constraints,
+              this->fe.component_mask(velocities));
+          }
+
+        else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
+                 BoundaryConditions::BoundaryType::periodic)
+          {
+            DoFTools::make_periodicity_constraints(
+              this->dof_handler,
+              this->simulation_parameters.boundary_conditions.id[i_bc],
+              this->simulation_parameters.boundary_conditions.periodic_id[i_bc],
+              this->simulation_parameters.boundary_conditions
+                .periodic_direction[i_bc],
+              nonzero_constraints);
+          }
+      }
+  }
+  nonzero_constraints.close();
+}
+
+template <int dim, typename VectorType, typename DofsType>
+void
+NavierStokesBase<dim, VectorType, DofsType>::define_zero_constraints()
+{
+  const MappingQ<dim> mapping(
+    this->velocity_fem_degree,
+    this->simulation_parameters.fem_parameters.qmapping_all);
+  FEValuesExtractors::Vector velocities(0);
+
+  this->zero_constraints.clear();
+  DoFTools::make_hanging_node_constraints(this->dof_handler,
+                                          this->zero_constraints);
+
+  for (unsigned int i_bc = 0;
+       i_bc < this->simulation_parameters.boundary_conditions.size;
+       ++i_bc)
+    {
+      if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
+          BoundaryConditions::BoundaryType::slip)
+        {
+          std::set<types::boundary_id> no_normal_flux_boundaries;
+          no_normal_flux_boundaries.insert(
+            this->simulation_parameters.boundary_conditions.id[i_bc]);
+          VectorTools::compute_no_normal_flux_constraints(
+            this->dof_handler,
+            0,
+            no_normal_flux_boundaries,
+            this->zero_constraints);
+        }
+      else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
+               BoundaryConditions::BoundaryType::periodic)
+        {
+          DoFTools::make_periodicity_constraints(
+            this->dof_handler,
+            this->simulation_parameters.boundary_conditions.id[i_bc],
+            this->simulation_parameters.boundary_conditions.periodic_id[i_bc],
+            this->simulation_parameters.boundary_conditions
+              .periodic_direction[i_bc],
+            this->zero_constraints);
+        }
+      else // noslip or function boundary condition
+        {
+          VectorTools::interpolate_boundary_values(
+            mapping,
+            this->dof_handler,
+            this->simulation_parameters.boundary_conditions.id[i_bc],
+            dealii::Functions::ZeroFunction<dim>(dim + 1),
+            this->zero_constraints,
+            this->fe.component_mask(velocities));
+        }
+    }
+  this->zero_constraints.close();
+}
+
 template <int dim, typename VectorType, typename DofsType>
 void
 NavierStokesBase<dim, VectorType, DofsType>::set_nodal_values()
@@ -1001,12 +1267,27 @@ NavierStokesBase<dim, VectorType, DofsType>::read_checkpoint()
   this->solution_m2      = distributed_system_m2;
   this->solution_m3      = distributed_system_m3;
 
+  // The restart files written before the number of previous solutions was
+  // saved are read as if no previous solution was available
+  const std::string previous_solutions_filename =
+    prefix + ".previoussolutions";
+  std::ifstream previous_solutions_input(previous_solutions_filename.c_str());
+  if (previous_solutions_input)
+    {
+      std::string buffer;
+      std::getline(previous_solutions_input, buffer);
+      previous_solutions_input >> buffer >> this->number_of_previous_solutions;
+    }
+  else
+    this->number_of_previous_solutions = 0;
+
   if (simulation_parameters.flow_control.enable_flow_control)
     {
       this->flow_control.read(prefix);
 
       this->flow_rate =
         calculate_flow_rate(this->dof_handler,
+                            this->boundary_faces,
                             present_solution,
                             simulation_parameters.flow_control.boundary_flow_id,
                             simulation_parameters.fem_parameters,
@@ -1233,6 +1514,12 @@ NavierStokesBase<dim, VectorType, DofsType>::write_checkpoint()
 
       if (simulation_parameters.flow_control.enable_flow_control)
         this->flow_control.save(prefix);
+
+      // The number of previous solutions sets the order of the first bdf
+      // time steps and of the extrapolation of the initial guess
+      std::ofstream output(prefix + ".previoussolutions");
+      output << "Previous solutions" << std::endl;
+      output << "Number " << this->number_of_previous_solutions << std::endl;
     }
 
   std::vector<const VectorType *> sol_set_transfer;
@@ -289,10 +289,40 @@ calculate_kinetic_energy<3, TrilinosWrappers::MPI::BlockVector>(
   const MPI_Comm &                          mpi_communicator);
 
 
+template <int dim>
+BoundaryFacesList<dim>
+find_locally_owned_boundary_faces(const DoFHandler<dim> &dof_handler)
+{
+  BoundaryFacesList<dim> boundary_faces;
+
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned() && cell->at_boundary())
+        {
+          for (unsigned int face = 0; face < GeometryInfo<dim>::faces_per_cell;
+               face++)
+            {
+              if (cell->face(face)->at_boundary())
+                boundary_faces[cell->face(face)->boundary_id()].emplace_back(
+                  cell, face);
+            }
+        }
+    }
+
+  return boundary_faces;
+}
+
+template BoundaryFacesList<2>
+find_locally_owned_boundary_faces(const DoFHandler<2> &dof_handler);
+template BoundaryFacesList<3>
+find_locally_owned_boundary_faces(const DoFHandler<3> &dof_handler);
+
+
 template <int dim, typename VectorType>
 std::vector<Tensor<1, dim>>
 calculate_forces(
   const DoFHandler<dim> &                              dof_handler,
+  const BoundaryFacesList<dim> &                       boundary_faces,
   const VectorType &                                   evaluation_point,
   const Parameters::PhysicalProperties &               physical_properties,
   const BoundaryConditions::NSBoundaryConditions<dim> &boundary_conditions,
@@ -312,9 +342,9 @@ calculate_forces(
   Tensor<1, dim>                   normal_vector;
   Tensor<2, dim>                   fluid_stress;
   Tensor<2, dim>                   fluid_pressure;
-  Tensor<1, dim>                   force;
 
-  std::vector<Tensor<1, dim>> force_vector(boundary_conditions.size);
+  // Forces on all the boundaries, flattened to be reduced at once
+  std::vector<double> local_forces(boundary_conditions.size * dim, 0.);
 
   FEFaceValues<dim> fe_face_values(mapping,
                                    fe,
@@ -325,59 +355,52 @@ calculate_forces(
 
   for (unsigned int i_bc = 0; i_bc < boundary_conditions.size; ++i_bc)
     {
-      unsigned int boundary_id = boundary_conditions.id[i_bc];
-      force                    = 0;
-      for (const auto &cell : dof_handler.active_cell_iterators())
+      const auto faces = boundary_faces.find(boundary_conditions.id[i_bc]);
+      if (faces == boundary_faces.end())
+        continue;
+
+      Tensor<1, dim> force;
+      for (const auto &[cell, face] : faces->second)
         {
-          if (cell->is_locally_owned())
+          fe_face_values.reinit(cell, face);
+          fe_face_values[velocities].get_function_gradients(evaluation_point,
+                                                            velocity_gradients);
+          fe_face_values[pressure].get_function_values(evaluation_point,
+                                                       pressure_values);
+          for (unsigned int q = 0; q < n_q_points; q++)
             {
-              if (cell->at_boundary())
+              normal_vector = -fe_face_values.normal_vector(q);
+              for (int d = 0; d < dim; ++d)
                 {
-                  for (unsigned int face = 0;
-                       face < GeometryInfo<dim>::faces_per_cell;
-                       face++)
-                    {
-                      if (cell->face(face)->at_boundary())
-                        {
-                          fe_face_values.reinit(cell, face);
-                          if (cell->face(face)->boundary_id() == boundary_id)
-                            {
-                              std::vector<Point<dim>> q_points =
-                                fe_face_values.get_quadrature_points();
-                              fe_face_values[velocities].get_function_gradients(
-                                evaluation_point, velocity_gradients);
-                              fe_face_values[pressure].get_function_values(
-                                evaluation_point, pressure_values);
-                              for (unsigned int q = 0; q < n_q_points; q++)
-                                {
-                                  normal_vector =
-                                    -fe_face_values.normal_vector(q);
-                                  for (int d = 0; d < dim; ++d)
-                                    {
-                                      fluid_pressure[d][d] = pressure_values[q];
-                                    }
-                                  fluid_stress =
-                                    viscosity *
-                                      (velocity_gradients[q] +
-                                       transpose(velocity_gradients[q])) -
-                                    fluid_pressure;
-                                  force += fluid_stress * normal_vector *
-                                           fe_face_values.JxW(q);
-                                }
-                            }
-                        }
-                    }
+                  fluid_pressure[d][d] = pressure_values[q];
                 }
+              fluid_stress =
+                viscosity * (velocity_gradients[q] +
+                             transpose(velocity_gradients[q])) -
+                fluid_pressure;
+              force += fluid_stress * normal_vector * fe_face_values.JxW(q);
             }
         }
-      force_vector[i_bc] = Utilities::MPI::sum(force, mpi_communicator);
+
+      for (int d = 0; d < dim; ++d)
+        local_forces[i_bc * dim + d] = force[d];
     }
+
+  std::vector<double> global_forces(local_forces.size());
+  Utilities::MPI::sum(local_forces, mpi_communicator, global_forces);
+
+  std::vector<Tensor<1, dim>> force_vector(boundary_conditions.size);
+  for (unsigned int i_bc = 0; i_bc < boundary_conditions.size; ++i_bc)
+    for (int d = 0; d < dim; ++d)
+      force_vector[i_bc][d] = global_forces[i_bc * dim + d];
+
   return force_vector;
 }
 
 template std::vector<Tensor<1, 2>>
 calculate_forces<2, TrilinosWrappers::MPI::Vector>(
   const DoFHandler<2> &                              dof_handler,
+  const BoundaryFacesList<2> &                       boundary_faces,
   const TrilinosWrappers::MPI::Vector &              evaluation_point,
   const Parameters::PhysicalProperties &             physical_properties,
   const BoundaryConditions::NSBoundaryConditions<2> &boundary_conditions,
@@ -385,6 +408,7 @@ calculate_forces<2, TrilinosWrappers::MPI::Vector>(
 template std::vector<Tensor<1, 3>>
 calculate_forces<3, TrilinosWrappers::MPI::Vector>(
   const DoFHandler<3> &                              dof_handler,
+  const BoundaryFacesList<3> &                       boundary_faces,
   const TrilinosWrappers::MPI::Vector &              evaluation_point,
   const Parameters::PhysicalProperties &             physical_properties,
   const BoundaryConditions::NSBoundaryConditions<3> &boundary_conditions,
@@ -393,6 +417,7 @@ calculate_forces<3, TrilinosWrappers::MPI::Vector>(
 template std::vector<Tensor<1, 2>>
 calculate_forces<2, TrilinosWrappers::MPI::BlockVector>(
   const DoFHandler<2> &                              dof_handler,
+  const BoundaryFacesList<2> &                       boundary_faces,
   const TrilinosWrappers::MPI::BlockVector &         evaluation_point,
   const Parameters::PhysicalProperties &             physical_properties,
   const BoundaryConditions::NSBoundaryConditions<2> &boundary_conditions,
@@ -401,6 +426,7 @@ calculate_forces<2, TrilinosWrappers::MPI::BlockVector>(
 template std::vector<Tensor<1, 3>>
 calculate_forces<3, TrilinosWrappers::MPI::BlockVector>(
   const DoFHandler<3> &                              dof_handler,
+  const BoundaryFacesList<3> &                       boundary_faces,
   const TrilinosWrappers::MPI::BlockVector &         evaluation_point,
   const Parameters::PhysicalProperties &             physical_properties,
   const BoundaryConditions::NSBoundaryConditions<3> &boundary_conditions,
@@ -411,6 +437,7 @@ template <int dim, typename VectorType>
 std::vector<Tensor<1, 3>>
 calculate_torques(
   const DoFHandler<dim> &                              dof_handler,
+  const BoundaryFacesList<dim> &                       boundary_faces,
   const VectorType &                                   evaluation_point,
   const Parameters::PhysicalProperties &               physical_properties,
   const Parameters::FEM &                              fem_parameters,
@@ -431,10 +458,10 @@ calculate_torques(
   Tensor<1, dim>                   normal_vector;
   Tensor<2, dim>                   fluid_stress;
   Tensor<2, dim>                   fluid_pressure;
-  // torque tensor had to be considered in 3D at all time...
-  Tensor<1, 3> torque;
 
-  std::vector<Tensor<1, 3>> torque_vector(boundary_conditions.size);
+  // Torques on all the boundaries (torque tensor had to be considered in 3D at
+  // all time), flattened to be reduced at once
+  std::vector<double> local_torques(boundary_conditions.size * 3, 0.);
 
   FEFaceValues<dim> fe_face_values(mapping,
                                    fe,
@@ -446,73 +473,70 @@ calculate_torques(
   for (unsigned int i_bc = 0; i_bc < boundary_conditions.size; ++i_bc)
     {
       unsigned int boundary_id = boundary_conditions.id[i_bc];
-      torque                   = 0;
-      Point<dim> center_of_rotation =
+      const auto   faces       = boundary_faces.find(boundary_id);
+      if (faces == boundary_faces.end())
+        continue;
+
+      Tensor<1, 3> torque;
+      Point<dim>   center_of_rotation =
         boundary_conditions.bcFunctions[boundary_id].cor;
-      for (const auto &cell : dof_handler.active_cell_iterators())
+      for (const auto &[cell, face] : faces->second)
         {
-          if (cell->is_locally_owned())
+          fe_face_values.reinit(cell, face);
+          const std::vector<Point<dim>> &q_points =
+            fe_face_values.get_quadrature_points();
+          fe_face_values[velocities].get_function_gradients(evaluation_point,
+                                                            velocity_gradients);
+          fe_face_values[pressure].get_function_values(evaluation_point,
+                                                       pressure_values);
+          for (unsigned int q = 0; q < n_q_points; q++)
             {
-              for (unsigned int face = 0;
-                   face < GeometryInfo<dim>::faces_per_cell;
-                   face++)
+              normal_vector = -fe_face_values.normal_vector(q);
+              for (int d = 0; d < dim; ++d)
                 {
-                  if (cell->face(face)->at_boundary())
-                    {
-                      fe_face_values.reinit(cell, face);
-                      if (cell->face(face)->boundary_id() == boundary_id)
-                        {
-                          std::vector<Point<dim>> q_points =
-                            fe_face_values.get_quadrature_points();
-                          fe_face_values[velocities].get_function_gradients(
-                            evaluation_point, velocity_gradients);
-                          fe_face_values[pressure].get_function_values(
-                            evaluation_point, pressure_values);
-                          for (unsigned int q = 0; q < n_q_points; q++)
-                            {
-                              normal_vector = -fe_face_values.normal_vector(q);
-                              for (int d = 0; d < dim; ++d)
-                                {
-                                  fluid_pressure[d][d] = pressure_values[q];
-                                }
-                              fluid_stress =
-                                viscosity * (velocity_gradients[q] +
-                                             transpose(velocity_gradients[q])) -
-                                fluid_pressure;
-                              auto force = fluid_stress * normal_vector *
-                                           fe_face_values.JxW(q);
-
-                              auto distance = q_points[q] - center_of_rotation;
-                              if (dim == 2)
-                                {
-                                  torque[0] = 0.;
-                                  torque[1] = 0.;
-                                  torque[2] += distance[0] * force[1] -
-                                               distance[1] * force[0];
-                                }
-                              else if (dim == 3)
-                                {
-                                  torque[0] += distance[1] * force[2] -
-                                               distance[2] * force[1];
-                                  torque[1] += distance[2] * force[0] -
-                                               distance[0] * force[2];
-                                  torque[2] += distance[0] * force[1] -
-                                               distance[1] * force[0];
-                                }
-                            }
-                        }
-                    }
+                  fluid_pressure[d][d] = pressure_values[q];
+                }
+              fluid_stress =
+                viscosity * (velocity_gradients[q] +
+                             transpose(velocity_gradients[q])) -
+                fluid_pressure;
+              auto force = fluid_stress * normal_vector * fe_face_values.JxW(q);
+
+              auto distance = q_points[q] - center_of_rotation;
+              if (dim == 2)
+                {
+                  torque[0] = 0.;
+                  torque[1] = 0.;
+                  torque[2] += distance[0] * force[1] - distance[1] * force[0];
+                }
+              else if (dim == 3)
+                {
+                  torque[0] += distance[1] * force[2] - distance[2] * force[1];
+                  torque[1] += distance[2] * force[0] - distance[0] * force[2];
+                  torque[2] += distance[0] * force[1] - distance[1] * force[0];
                 }
             }
         }
-      torque_vector[i_bc] = Utilities::MPI::sum(torque, mpi_communicator);
+
+      for (unsigned int d = 0; d < 3; ++d)
+        local_torques[i_bc * 3 + d] = torque[d];
     }
+
+  std::vector<double> global_torques(local_torques.size());
+  Utilities::MPI::sum(local_torques, mpi_communicator, global_torques);
+
+  std::vector<Tensor<1, 3>> torque_vector(boundary_conditions.size);
+  for (unsigned int i_bc = 0; i_bc < boundary_conditions.size; ++i_bc)
+    for (unsigned int d = 0; d < 3; ++d)
+      torque_vector[i_bc][d] = global_torques[i_bc * 3 + d];
+
   return torque_vector;
 }
 
 template std::vector<Tensor<1, 3>>
 calculate_torques<2, TrilinosWrappers::MPI::Vector>(
   const DoFHandler<2> &                              dof_handler,
+  const BoundaryFacesList<2> &                       boundary_faces,
   const TrilinosWrappers::MPI::Vector &              evaluation_point,
   const Parameters::PhysicalProperties &             physical_properties,
   const Parameters::FEM &                            fem_parameters,
@@ -521,6 +545,7 @@ calculate_torques<2, TrilinosWrappers::MPI::Vector>(
 template std::vector<Tensor<1, 3>>
 calculate_torques<3, TrilinosWrappers::MPI::Vector>(
   const DoFHandler<3> &                              dof_handler,
+  const BoundaryFacesList<3> &                       boundary_faces,
   const TrilinosWrappers::MPI::Vector &              evaluation_point,
   const Parameters::PhysicalProperties &             physical_properties,
   const Parameters::FEM &                            fem_parameters,
@@ -530,6 +555,7 @@ calculate_torques<3, TrilinosWrappers::MPI::Vector>(
 template std::vector<Tensor<1, 3>>
 calculate_torques<2, TrilinosWrappers::MPI::BlockVector>(
   const DoFHandler<2> &                              dof_handler,
+  const BoundaryFacesList<2> &                       boundary_faces,
   const TrilinosWrappers::MPI::BlockVector &         evaluation_point,
   const Parameters::PhysicalProperties &             physical_properties,
   const Parameters::FEM &                            fem_parameters,
@@ -539,6 +565,7 @@ calculate_torques<2, TrilinosWrappers::MPI::BlockVector>(
 template std::vector<Tensor<1, 3>>
 calculate_torques<3, TrilinosWrappers::MPI::BlockVector>(
   const DoFHandler<3> &                              dof_handler,
+  const BoundaryFacesList<3> &                       boundary_faces,
   const TrilinosWrappers::MPI::BlockVector &         evaluation_point,
   const Parameters::PhysicalProperties &             physical_properties,
   const Parameters::FEM &                            fem_parameters,
@@ -706,11 +733,12 @@ calculate_L2_error(const DoFHandler<3> &                     dof_handler,
 
 template <int dim, typename VectorType>
 std::pair<double, double>
-calculate_flow_rate(const DoFHandler<dim> &dof_handler,
-                    const VectorType &     present_solution,
-                    const unsigned int &   boundary_id,
-                    const Parameters::FEM &fem_parameters,
-                    const MPI_Comm &       mpi_communicator)
+calculate_flow_rate(const DoFHandler<dim> &       dof_handler,
+                    const BoundaryFacesList<dim> &boundary_faces,
+                    const VectorType &            present_solution,
+                    const unsigned int &          boundary_id,
+                    const Parameters::FEM &       fem_parameters,
+                    const MPI_Comm &              mpi_communicator)
 {
   const FiniteElement<dim> &fe = dof_handler.get_fe();
   const MappingQ<dim>       mapping(fe.degree, fem_parameters.qmapping_all);
@@ -726,45 +754,38 @@ calculate_flow_rate(const DoFHandler<dim> &dof_handler,
                                    update_values | update_quadrature_points |
                                      update_JxW_values | update_normal_vectors);
 
-  double flow_rate = 0;
-  double area      = 0;
+  // Flow rate and area, reduced at once
+  std::vector<double> flow_rate_and_area(2, 0.);
 
   // Calculating area and volumetric flow rate at the inlet flow
-  for (const auto &cell : dof_handler.active_cell_iterators())
+  const auto faces = boundary_faces.find(boundary_id);
+  if (faces != boundary_faces.end())
     {
-      if (cell->is_locally_owned() && cell->at_boundary())
+      for (const auto &[cell, face] : faces->second)
         {
-          for (unsigned int face = 0; face < GeometryInfo<dim>::faces_per_cell;
-               face++)
+          fe_face_values.reinit(cell, face);
+          fe_face_values[velocities].get_function_values(present_solution,
+                                                         velocity_values);
+          for (unsigned int q = 0; q < n_q_points; q++)
             {
-              if (cell->face(face)->at_boundary())
-                {
-                  fe_face_values.reinit(cell, face);
-                  if (cell->face(face)->boundary_id() == boundary_id)
-                    {
-                      for (unsigned int q = 0; q < n_q_points; q++)
-                        {
-                          area += fe_face_values.JxW(q);
-                          normal_vector = fe_face_values.normal_vector(q);
-                          fe_face_values[velocities].get_function_values(
-                            present_solution, velocity_values);
-                          flow_rate += velocity_values[q] * normal_vector *
-                                       fe_face_values.JxW(q);
-                        }
-                    }
-                }
+              normal_vector = fe_face_values.normal_vector(q);
+              flow_rate_and_area[0] +=
+                velocity_values[q] * normal_vector * fe_face_values.JxW(q);
+              flow_rate_and_area[1] += fe_face_values.JxW(q);
             }
         }
     }
 
-  area      = Utilities::MPI::sum(area, mpi_communicator);
-  flow_rate = Utilities::MPI::sum(flow_rate, mpi_communicator);
+  Utilities::MPI::sum(flow_rate_and_area,
+                      mpi_communicator,
+                      flow_rate_and_area);
 
-  return std::make_pair(flow_rate, area);
+  return std::make_pair(flow_rate_and_area[0], flow_rate_and_area[1]);
 }
 
 template std::pair<double, double>
 calculate_flow_rate(const DoFHandler<2> &                dof_handler,
+                    const BoundaryFacesList<2> &         boundary_faces,
                     const TrilinosWrappers::MPI::Vector &present_solution,
                     const unsigned int &                 boundary_id,
                     const Parameters::FEM &              fem_parameters,
@@ -772,6 +793,7 @@ calculate_flow_rate(const DoFHandler<2> &                dof_handler,
 
 template std::pair<double, double>
 calculate_flow_rate(const DoFHandler<3> &                dof_handler,
+                    const BoundaryFacesList<3> &         boundary_faces,
                     const TrilinosWrappers::MPI::Vector &present_solution,
                     const unsigned int &                 boundary_id,
                     const Parameters::FEM &              fem_parameters,
@@ -779,6 +801,7 @@ calculate_flow_rate(const DoFHandler<3> &                dof_handler,
 
 template std::pair<double, double>
 calculate_flow_rate(const DoFHandler<2> &                     dof_handler,
+                    const BoundaryFacesList<2> &              boundary_faces,
                     const TrilinosWrappers::MPI::BlockVector &present_solution,
                     const unsigned int &                      boundary_id,
                     const Parameters::FEM &                   fem_parameters,
@@ -786,6 +809,7 @@ calculate_flow_rate(const DoFHandler<2> &                     dof_handler,
 
 template std::pair<double, double>
 calculate_flow_rate(const DoFHandler<3> &                     dof_handler,
+                    const BoundaryFacesList<3> &              boundary_faces,
                     const TrilinosWrappers::MPI::BlockVector &present_solution,
                     const unsigned int &                      boundary_id,
                     const Parameters::FEM &                   fem_parameters,
@@ -0,0 +1,1156 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2020 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+
+ *
+ * Author: Bruno Blais, Polytechnique Montreal, 2020-
+ */
+
+#include "solvers/projection_navier_stokes.h"
+
+#include "core/bdf.h"
+#include "core/grids.h"
+#include "core/manifolds.h"
+#include "core/time_integration_utilities.h"
+
+namespace
+{
+  /**
+   * Copies the constraints of the dofs [begin, end) of the monolithic system
+   * to the constraints of a block whose dofs are numbered from zero. The
+   * constraints of a block must only involve dofs of this block.
+   */
+  void
+  extract_block_constraints(const AffineConstraints<double> &constraints,
+                            const types::global_dof_index    begin,
+                            const types::global_dof_index    end,
+                            AffineConstraints<double> &      block_constraints)
+  {
+    for (const auto &line : constraints.get_lines())
+      {
+        if (line.index < begin || line.index >= end ||
+            !block_constraints.can_store_line(line.index - begin))
+          continue;
+
+        const types::global_dof_index index = line.index - begin;
+        block_constraints.add_line(index);
+        for (const auto &entry : line.entries)
+          {
+            Assert(entry.first >= begin && entry.first < end,
+                   ExcMessage("The constraints couple two blocks"));
+            block_constraints.add_entry(index,
+                                        entry.first - begin,
+                                        entry.second);
+          }
+        block_constraints.set_inhomogeneity(index, line.inhomogeneity);
+      }
+  }
+} // namespace
+
+// Constructor for class ProjectionNavierStokesSolver
+template <int dim>
+ProjectionNavierStokesSolver<dim>::ProjectionNavierStokesSolver(
+  SimulationParameters<dim> &p_nsparam)
+  : NavierStokesBase<dim, TrilinosWrappers::MPI::Vector, IndexSet>(p_nsparam)
+{}
+
+template <int dim>
+ProjectionNavierStokesSolver<dim>::~ProjectionNavierStokesSolver()
+{
+  this->dof_handler.clear();
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::setup_dofs_fd()
+{
+  TimerOutput::Scope t(this->computing_timer, "setup_dofs");
+
+  // Clear the preconditioners before the matrices they are associated with
+  // are cleared
+  velocity_amg_preconditioner.reset();
+  velocity_mass_preconditioner.reset();
+  pressure_amg_preconditioner.reset();
+
+  velocity_matrix.clear();
+  velocity_mass_matrix.clear();
+  pressure_laplacian_matrix.clear();
+
+  this->dof_handler.distribute_dofs(this->fe);
+
+  // The velocity and the pressure dofs form two contiguous blocks
+  std::vector<unsigned int> block_component(dim + 1, 0);
+  block_component[dim] = 1;
+  DoFRenumbering::component_wise(this->dof_handler, block_component);
+  n_velocity_dofs =
+    DoFTools::count_dofs_per_fe_block(this->dof_handler, block_component)[0];
+  const types::global_dof_index n_dofs = this->dof_handler.n_dofs();
+  const types::global_dof_index n_pressure_dofs = n_dofs - n_velocity_dofs;
+
+  this->locally_owned_dofs = this->dof_handler.locally_owned_dofs();
+  DoFTools::extract_locally_relevant_dofs(this->dof_handler,
+                                          this->locally_relevant_dofs);
+
+  locally_owned_velocity_dofs =
+    this->locally_owned_dofs.get_view(0, n_velocity_dofs);
+  locally_relevant_velocity_dofs =
+    this->locally_relevant_dofs.get_view(0, n_velocity_dofs);
+  locally_owned_pressure_dofs =
+    this->locally_owned_dofs.get_view(n_velocity_dofs, n_dofs);
+  locally_relevant_pressure_dofs =
+    this->locally_relevant_dofs.get_view(n_velocity_dofs, n_dofs);
+
+  velocity_shape_functions.clear();
+  pressure_shape_functions.clear();
+  for (unsigned int i = 0; i < this->fe.dofs_per_cell; ++i)
+    {
+      if (this->fe.system_to_component_index(i).first < dim)
+        velocity_shape_functions.push_back(i);
+      else
+        pressure_shape_functions.push_back(i);
+    }
+
+  const MappingQ<dim> mapping(
+    this->velocity_fem_degree,
+    this->simulation_parameters.fem_parameters.qmapping_all);
+  FEValuesExtractors::Scalar pressure(dim);
+
+  // The velocity correction satisfies the homogeneous counterpart of the
+  // boundary conditions of the velocity
+  this->define_non_zero_constraints();
+  this->define_zero_constraints();
+  auto &nonzero_constraints = this->get_nonzero_constraints();
+
+  // Constraints of the pressure increment. The boundaries without boundary
+  // condition are outlets, on which the pressure increment vanishes. The
+  // boundary ids are gathered over all the cells, including the artificial
+  // ones, hence every processor finds the same outlets.
+  const std::vector<types::boundary_id> boundary_ids =
+    this->triangulation->get_boundary_ids();
+  std::set<types::boundary_id> outlet_boundaries(boundary_ids.begin(),
+                                                 boundary_ids.end());
+
+  AffineConstraints<double> pressure_increment_constraints;
+  DoFTools::make_hanging_node_constraints(this->dof_handler,
+                                          pressure_increment_constraints);
+  for (unsigned int i_bc = 0;
+       i_bc < this->simulation_parameters.boundary_conditions.size;
+       ++i_bc)
+    {
+      outlet_boundaries.erase(
+        this->simulation_parameters.boundary_conditions.id[i_bc]);
+
+      if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
+          BoundaryConditions::BoundaryType::periodic)
+        {
+          outlet_boundaries.erase(
+            this->simulation_parameters.boundary_conditions.periodic_id[i_bc]);
+          DoFTools::make_periodicity_constraints(
+            this->dof_handler,
+            this->simulation_parameters.boundary_conditions.id[i_bc],
+            this->simulation_parameters.boundary_conditions.periodic_id[i_bc],
+            this->simulation_parameters.boundary_conditions
+              .periodic_direction[i_bc],
+            pressure_increment_constraints,
+            this->fe.component_mask(pressure));
+        }
+    }
+  for (const auto outlet_id : outlet_boundaries)
+    VectorTools::interpolate_boundary_values(
+      mapping,
+      this->dof_handler,
+      outlet_id,
+      dealii::Functions::ZeroFunction<dim>(dim + 1),
+      pressure_increment_constraints,
+      this->fe.component_mask(pressure));
+  pressure_increment_constraints.close();
+
+  velocity_constraints.clear();
+  velocity_constraints.reinit(locally_relevant_velocity_dofs);
+  extract_block_constraints(nonzero_constraints,
+                            0,
+                            n_velocity_dofs,
+                            velocity_constraints);
+  velocity_constraints.close();
+
+  velocity_correction_constraints.clear();
+  velocity_correction_constraints.reinit(locally_relevant_velocity_dofs);
+  extract_block_constraints(this->zero_constraints,
+                            0,
+                            n_velocity_dofs,
+                            velocity_correction_constraints);
+  velocity_correction_constraints.close();
+
+  pressure_constraints.clear();
+  pressure_constraints.reinit(locally_relevant_pressure_dofs);
+  extract_block_constraints(pressure_increment_constraints,
+                            n_velocity_dofs,
+                            n_dofs,
+                            pressure_constraints);
+  // Without outlet, the pressure increment is only defined up to a constant
+  if (outlet_boundaries.empty() && pressure_constraints.can_store_line(0) &&
+      !pressure_constraints.is_constrained(0))
+    pressure_constraints.add_line(0);
+  pressure_constraints.close();
+
+  // The constant modes of the velocity are the first entries of the locally
+  // owned constant modes since the velocity dofs are numbered first
+  std::vector<bool> velocity_components(dim + 1, true);
+  velocity_components[dim] = false;
+  DoFTools::extract_constant_modes(this->dof_handler,
+                                   velocity_components,
+                                   velocity_constant_modes);
+  for (auto &mode : velocity_constant_modes)
+    mode.resize(locally_owned_velocity_dofs.n_elements());
+
+  this->present_solution.reinit(this->locally_owned_dofs,
+                                this->locally_relevant_dofs,
+                                this->mpi_communicator);
+  this->solution_m1.reinit(this->locally_owned_dofs,
+                           this->locally_relevant_dofs,
+                           this->mpi_communicator);
+  this->solution_m2.reinit(this->locally_owned_dofs,
+                           this->locally_relevant_dofs,
+                           this->mpi_communicator);
+  this->solution_m3.reinit(this->locally_owned_dofs,
+                           this->locally_relevant_dofs,
+                           this->mpi_communicator);
+
+  // The evaluation point holds the pressure increment in the layout of the
+  // monolithic system, with ghost values, to evaluate its gradient
+  this->evaluation_point.reinit(this->locally_owned_dofs,
+                                this->locally_relevant_dofs,
+                                this->mpi_communicator);
+  this->newton_update.reinit(this->locally_owned_dofs, this->mpi_communicator);
+  this->system_rhs.reinit(this->locally_owned_dofs, this->mpi_communicator);
+  this->local_evaluation_point.reinit(this->locally_owned_dofs,
+                                      this->mpi_communicator);
+
+  velocity_rhs.reinit(locally_owned_velocity_dofs, this->mpi_communicator);
+  velocity_solution.reinit(locally_owned_velocity_dofs,
+                           this->mpi_communicator);
+  velocity_correction_rhs.reinit(locally_owned_velocity_dofs,
+                                 this->mpi_communicator);
+  velocity_correction.reinit(locally_owned_velocity_dofs,
+                             this->mpi_communicator);
+  pressure_rhs.reinit(locally_owned_pressure_dofs, this->mpi_communicator);
+  pressure_increment.reinit(locally_owned_pressure_dofs,
+                            this->mpi_communicator);
+
+  // Sparsity patterns of the velocity and the pressure blocks
+  std::vector<types::global_dof_index> local_dof_indices(
+    this->fe.dofs_per_cell);
+  std::vector<types::global_dof_index> velocity_dof_indices(
+    velocity_shape_functions.size());
+  std::vector<types::global_dof_index> pressure_dof_indices(
+    pressure_shape_functions.size());
+
+  DynamicSparsityPattern velocity_dsp(n_velocity_dofs,
+                                      n_velocity_dofs,
+                                      locally_relevant_velocity_dofs);
+  DynamicSparsityPattern pressure_dsp(n_pressure_dofs,
+                                      n_pressure_dofs,
+                                      locally_relevant_pressure_dofs);
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int k = 0; k < velocity_shape_functions.size(); ++k)
+            velocity_dof_indices[k] =
+              local_dof_indices[velocity_shape_functions[k]];
+          for (unsigned int k = 0; k < pressure_shape_functions.size(); ++k)
+            pressure_dof_indices[k] =
+              local_dof_indices[pressure_shape_functions[k]] - n_velocity_dofs;
+
+          // The velocity system and the velocity mass matrix share the
+          // sparsity pattern
+          velocity_constraints.add_entries_local_to_global(velocity_dof_indices,
+                                                           velocity_dsp,
+                                                           false);
+          velocity_correction_constraints.add_entries_local_to_global(
+            velocity_dof_indices, velocity_dsp, false);
+          pressure_constraints.add_entries_local_to_global(pressure_dof_indices,
+                                                           pressure_dsp,
+                                                           false);
+        }
+    }
+  SparsityTools::distribute_sparsity_pattern(velocity_dsp,
+                                             locally_owned_velocity_dofs,
+                                             this->mpi_communicator,
+                                             locally_relevant_velocity_dofs);
+  SparsityTools::distribute_sparsity_pattern(pressure_dsp,
+                                             locally_owned_pressure_dofs,
+                                             this->mpi_communicator,
+                                             locally_relevant_pressure_dofs);
+  velocity_matrix.reinit(locally_owned_velocity_dofs,
+                         locally_owned_velocity_dofs,
+                         velocity_dsp,
+                         this->mpi_communicator);
+  velocity_mass_matrix.reinit(locally_owned_velocity_dofs,
+                              locally_owned_velocity_dofs,
+                              velocity_dsp,
+                              this->mpi_communicator);
+  pressure_laplacian_matrix.reinit(locally_owned_pressure_dofs,
+                                   locally_owned_pressure_dofs,
+                                   pressure_dsp,
+                                   this->mpi_communicator);
+
+  assemble_velocity_mass_matrix();
+  assemble_pressure_laplacian();
+
+  if (this->simulation_parameters.post_processing.calculate_average_velocities)
+    {
+      AssertThrow(this->simulation_parameters.mesh_adaptation.type ==
+                    Parameters::MeshAdaptation::Type::none,
+                  ExcMessage(
+                    "Time-averaging velocities and calculating reynolds "
+                    "stresses are currently unavailable for mesh "
+                    "adaptation."));
+
+      this->average_velocities.initialize_vectors(this->locally_owned_dofs,
+                                                  this->locally_relevant_dofs,
+                                                  this->fe.n_dofs_per_vertex(),
+                                                  this->mpi_communicator);
+
+      if (this->simulation_parameters.restart_parameters.checkpoint)
+        {
+          this->average_velocities.initialize_checkpoint_vectors(
+            this->locally_owned_dofs,
+            this->locally_relevant_dofs,
+            this->mpi_communicator);
+        }
+    }
+
+  double global_volume = GridTools::volume(*this->triangulation);
+
+  this->pcout << "   Number of active cells:       "
+              << this->triangulation->n_global_active_cells() << std::endl
+              << "   Number of degrees of freedom: "
+              << this->dof_handler.n_dofs() << std::endl;
+  this->pcout << "   Volume of triangulation:      " << global_volume
+              << std::endl;
+
+
+  this->multiphysics->set_dof_handler(PhysicsID::fluid_dynamics,
+                                      &this->dof_handler);
+  this->multiphysics->set_solution(PhysicsID::fluid_dynamics,
+                                   &this->present_solution);
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::set_initial_condition_fd(
+  Parameters::InitialConditionType initial_condition_type,
+  bool                             restart)
+{
+  if (restart)
+    {
+      this->pcout << "************************" << std::endl;
+      this->pcout << "---> Simulation Restart " << std::endl;
+      this->pcout << "************************" << std::endl;
+      this->read_checkpoint();
+    }
+  else if (initial_condition_type == Parameters::InitialConditionType::nodal)
+    {
+      this->set_nodal_values();
+      this->finish_time_step_fd();
+    }
+  else
+    {
+      throw std::runtime_error(
+        "Projection NS - Only the nodal initial condition is supported");
+    }
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::assemble_velocity_system(
+  const unsigned int order)
+{
+  TimerOutput::Scope t(this->computing_timer, "assemble_velocity_system");
+
+  velocity_matrix = 0;
+  velocity_rhs    = 0;
+
+  const double viscosity =
+    this->simulation_parameters.physical_properties.viscosity;
+  Function<dim> *l_forcing_function = this->forcing_function;
+
+  QGauss<dim>         quadrature_formula(this->number_quadrature_points);
+  const MappingQ<dim> mapping(
+    this->velocity_fem_degree,
+    this->simulation_parameters.fem_parameters.qmapping_all);
+  FEValues<dim> fe_values(mapping,
+                          this->fe,
+                          quadrature_formula,
+                          update_values | update_quadrature_points |
+                            update_JxW_values | update_gradients);
+
+  const unsigned int dofs_per_cell = this->fe.dofs_per_cell;
+  const unsigned int n_q_points    = quadrature_formula.size();
+  const unsigned int n_velocity_shape_functions =
+    velocity_shape_functions.size();
+
+  const FEValuesExtractors::Vector velocities(0);
+  const FEValuesExtractors::Scalar pressure(dim);
+
+  FullMatrix<double> local_matrix(n_velocity_shape_functions,
+                                  n_velocity_shape_functions);
+  Vector<double>     local_rhs(n_velocity_shape_functions);
+
+  std::vector<Vector<double>> rhs_force(n_q_points, Vector<double>(dim + 1));
+
+  std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+  std::vector<types::global_dof_index> velocity_dof_indices(
+    n_velocity_shape_functions);
+
+  std::vector<Tensor<1, dim>> phi_u(n_velocity_shape_functions);
+  std::vector<Tensor<2, dim>> grad_phi_u(n_velocity_shape_functions);
+  std::vector<double>         div_phi_u(n_velocity_shape_functions);
+
+  // The time derivative is discretized with the BDF scheme and the convective
+  // velocity is extrapolated from the same previous time steps, which
+  // preserves the order of the BDF scheme
+  const std::vector<double> time_steps_vector =
+    this->simulation_control->get_time_steps_vector();
+  const double         dt  = time_steps_vector[0];
+  const double         sdt = 1. / dt;
+  const Vector<double> bdf_coefs =
+    bdf_coefficients(order, time_steps_vector);
+  const Vector<double> extrapolation_coefs =
+    extrapolation_coefficients(order - 1, time_steps_vector);
+
+  std::vector<const TrilinosWrappers::MPI::Vector *> previous_solutions = {
+    &this->solution_m1, &this->solution_m2, &this->solution_m3};
+  previous_solutions.resize(order);
+
+  std::vector<std::vector<Tensor<1, dim>>> previous_velocity_values(
+    order, std::vector<Tensor<1, dim>>(n_q_points));
+  std::vector<double>         previous_pressure_values(n_q_points);
+  std::vector<Tensor<1, dim>> previous_pressure_gradients(n_q_points);
+
+  Tensor<1, dim> force;
+
+  // Element size
+  double h;
+
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          fe_values.reinit(cell);
+
+          if (dim == 2)
+            h = std::sqrt(4. * cell->measure() / M_PI) /
+                this->velocity_fem_degree;
+          else if (dim == 3)
+            h = pow(6 * cell->measure() / M_PI, 1. / 3.) /
+                this->velocity_fem_degree;
+
+          local_matrix = 0;
+          local_rhs    = 0;
+
+          for (unsigned int i = 0; i < order; ++i)
+            fe_values[velocities].get_function_values(
+              *previous_solutions[i], previous_velocity_values[i]);
+
+          // The pressure of the previous time step is explicit
+          fe_values[pressure].get_function_values(this->solution_m1,
+                                                  previous_pressure_values);
+          fe_values[pressure].get_function_gradients(
+            this->solution_m1, previous_pressure_gradients);
+
+          if (l_forcing_function)
+            l_forcing_function->vector_value_list(
+              fe_values.get_quadrature_points(), rhs_force);
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              const double JxW = fe_values.JxW(q);
+
+              // Extrapolated convective velocity and contribution of the
+              // previous time steps to the time derivative
+              Tensor<1, dim> velocity;
+              Tensor<1, dim> previous_time_derivative;
+              for (unsigned int i = 0; i < order; ++i)
+                {
+                  velocity +=
+                    extrapolation_coefs[i] * previous_velocity_values[i][q];
+                  previous_time_derivative +=
+                    bdf_coefs[i + 1] * previous_velocity_values[i][q];
+                }
+
+              for (int d = 0; d < dim; ++d)
+                force[d] = rhs_force[q](d);
+              force += this->beta;
+
+              const double u_mag =
+                std::max(velocity.norm(), 1e-12 * SUPG_u_scale);
+              const double tau =
+                1. / std::sqrt(std::pow(sdt, 2) + std::pow(2. * u_mag / h, 2) +
+                               9 * std::pow(4 * viscosity / (h * h), 2));
+
+              for (unsigned int k = 0; k < n_velocity_shape_functions; ++k)
+                {
+                  const unsigned int shape = velocity_shape_functions[k];
+                  phi_u[k]      = fe_values[velocities].value(shape, q);
+                  grad_phi_u[k] = fe_values[velocities].gradient(shape, q);
+                  div_phi_u[k]  = fe_values[velocities].divergence(shape, q);
+                }
+
+              // Part of the strong residual which does not depend on the
+              // velocity of the time step. The viscous term of the strong
+              // residual is neglected.
+              const Tensor<1, dim> explicit_residual =
+                previous_time_derivative + previous_pressure_gradients[q] -
+                force;
+
+              for (unsigned int i = 0; i < n_velocity_shape_functions; ++i)
+                {
+                  const Tensor<1, dim> supg_i =
+                    tau * (grad_phi_u[i] * velocity);
+
+                  for (unsigned int j = 0; j < n_velocity_shape_functions; ++j)
+                    {
+                      const Tensor<1, dim> strong_jac =
+                        bdf_coefs[0] * phi_u[j] + grad_phi_u[j] * velocity;
+
+                      local_matrix(i, j) +=
+                        (viscosity *
+                           scalar_product(grad_phi_u[j], grad_phi_u[i]) +
+                         strong_jac * phi_u[i] + strong_jac * supg_i) *
+                        JxW;
+                    }
+
+                  local_rhs(i) +=
+                    ((force - previous_time_derivative) * phi_u[i] +
+                     previous_pressure_values[q] * div_phi_u[i] -
+                     explicit_residual * supg_i) *
+                    JxW;
+                }
+            }
+
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int k = 0; k < n_velocity_shape_functions; ++k)
+            velocity_dof_indices[k] =
+              local_dof_indices[velocity_shape_functions[k]];
+
+          velocity_constraints.distribute_local_to_global(local_matrix,
+                                                          local_rhs,
+                                                          velocity_dof_indices,
+                                                          velocity_matrix,
+                                                          velocity_rhs);
+        }
+    }
+
+  velocity_matrix.compress(VectorOperation::add);
+  velocity_rhs.compress(VectorOperation::add);
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::assemble_velocity_mass_matrix()
+{
+  TimerOutput::Scope t(this->computing_timer, "assemble_velocity_mass_matrix");
+
+  velocity_mass_matrix = 0;
+
+  QGauss<dim>         quadrature_formula(this->number_quadrature_points);
+  const MappingQ<dim> mapping(
+    this->velocity_fem_degree,
+    this->simulation_parameters.fem_parameters.qmapping_all);
+  FEValues<dim> fe_values(mapping,
+                          this->fe,
+                          quadrature_formula,
+                          update_values | update_JxW_values);
+
+  const unsigned int dofs_per_cell = this->fe.dofs_per_cell;
+  const unsigned int n_q_points    = quadrature_formula.size();
+  const unsigned int n_velocity_shape_functions =
+    velocity_shape_functions.size();
+
+  const FEValuesExtractors::Vector velocities(0);
+
+  FullMatrix<double> local_matrix(n_velocity_shape_functions,
+                                  n_velocity_shape_functions);
+  std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+  std::vector<types::global_dof_index> velocity_dof_indices(
+    n_velocity_shape_functions);
+  std::vector<Tensor<1, dim>> phi_u(n_velocity_shape_functions);
+
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          fe_values.reinit(cell);
+          local_matrix = 0;
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              const double JxW = fe_values.JxW(q);
+              for (unsigned int k = 0; k < n_velocity_shape_functions; ++k)
+                phi_u[k] =
+                  fe_values[velocities].value(velocity_shape_functions[k], q);
+
+              for (unsigned int i = 0; i < n_velocity_shape_functions; ++i)
+                for (unsigned int j = 0; j < n_velocity_shape_functions; ++j)
+                  local_matrix(i, j) += phi_u[i] * phi_u[j] * JxW;
+            }
+
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int k = 0; k < n_velocity_shape_functions; ++k)
+            velocity_dof_indices[k] =
+              local_dof_indices[velocity_shape_functions[k]];
+
+          velocity_correction_constraints.distribute_local_to_global(
+            local_matrix, velocity_dof_indices, velocity_mass_matrix);
+        }
+    }
+  velocity_mass_matrix.compress(VectorOperation::add);
+
+  // The mass matrix is well conditioned, a Jacobi preconditioner is enough
+  velocity_mass_preconditioner =
+    std::make_shared<TrilinosWrappers::PreconditionJacobi>();
+  velocity_mass_preconditioner->initialize(velocity_mass_matrix);
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::assemble_pressure_laplacian()
+{
+  TimerOutput::Scope t(this->computing_timer, "assemble_pressure_laplacian");
+
+  pressure_laplacian_matrix = 0;
+
+  QGauss<dim>         quadrature_formula(this->number_quadrature_points);
+  const MappingQ<dim> mapping(
+    this->velocity_fem_degree,
+    this->simulation_parameters.fem_parameters.qmapping_all);
+  FEValues<dim> fe_values(mapping,
+                          this->fe,
+                          quadrature_formula,
+                          update_gradients | update_JxW_values);
+
+  const unsigned int dofs_per_cell = this->fe.dofs_per_cell;
+  const unsigned int n_q_points    = quadrature_formula.size();
+  const unsigned int n_pressure_shape_functions =
+    pressure_shape_functions.size();
+
+  FullMatrix<double> local_matrix(n_pressure_shape_functions,
+                                  n_pressure_shape_functions);
+  std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+  std::vector<types::global_dof_index> pressure_dof_indices(
+    n_pressure_shape_functions);
+  std::vector<Tensor<1, dim>> grad_phi_p(n_pressure_shape_functions);
+
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          fe_values.reinit(cell);
+          local_matrix = 0;
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              const double JxW = fe_values.JxW(q);
+              for (unsigned int k = 0; k < n_pressure_shape_functions; ++k)
+                grad_phi_p[k] =
+                  fe_values.shape_grad(pressure_shape_functions[k], q);
+
+              for (unsigned int i = 0; i < n_pressure_shape_functions; ++i)
+                for (unsigned int j = 0; j < n_pressure_shape_functions; ++j)
+                  local_matrix(i, j) += grad_phi_p[i] * grad_phi_p[j] * JxW;
+            }
+
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int k = 0; k < n_pressure_shape_functions; ++k)
+            pressure_dof_indices[k] =
+              local_dof_indices[pressure_shape_functions[k]] - n_velocity_dofs;
+
+          pressure_constraints.distribute_local_to_global(
+            local_matrix, pressure_dof_indices, pressure_laplacian_matrix);
+        }
+    }
+  pressure_laplacian_matrix.compress(VectorOperation::add);
+
+  TrilinosWrappers::PreconditionAMG::AdditionalData pressure_amg_data;
+  pressure_amg_data.elliptic              = true;
+  pressure_amg_data.higher_order_elements = this->pressure_fem_degree > 1;
+  pressure_amg_data.n_cycles =
+    this->simulation_parameters.linear_solver.amg_n_cycles;
+  pressure_amg_data.w_cycle =
+    this->simulation_parameters.linear_solver.amg_w_cycles;
+  pressure_amg_data.aggregation_threshold =
+    this->simulation_parameters.linear_solver.amg_aggregation_threshold;
+  pressure_amg_data.smoother_sweeps =
+    this->simulation_parameters.linear_solver.amg_smoother_sweeps;
+  pressure_amg_data.smoother_overlap =
+    this->simulation_parameters.linear_solver.amg_smoother_overlap;
+  pressure_amg_preconditioner =
+    std::make_shared<TrilinosWrappers::PreconditionAMG>();
+  pressure_amg_preconditioner->initialize(pressure_laplacian_matrix,
+                                          pressure_amg_data);
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::assemble_pressure_rhs(
+  const unsigned int order)
+{
+  TimerOutput::Scope t(this->computing_timer, "assemble_pressure_rhs");
+
+  pressure_rhs = 0;
+
+  const Vector<double> bdf_coefs =
+    bdf_coefficients(order, this->simulation_control->get_time_steps_vector());
+
+  QGauss<dim>         quadrature_formula(this->number_quadrature_points);
+  const MappingQ<dim> mapping(
+    this->velocity_fem_degree,
+    this->simulation_parameters.fem_parameters.qmapping_all);
+  FEValues<dim> fe_values(mapping,
+                          this->fe,
+                          quadrature_formula,
+                          update_values | update_gradients |
+                            update_JxW_values);
+
+  const unsigned int dofs_per_cell = this->fe.dofs_per_cell;
+  const unsigned int n_q_points    = quadrature_formula.size();
+  const unsigned int n_pressure_shape_functions =
+    pressure_shape_functions.size();
+
+  const FEValuesExtractors::Vector velocities(0);
+
+  Vector<double>                       local_rhs(n_pressure_shape_functions);
+  std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+  std::vector<types::global_dof_index> pressure_dof_indices(
+    n_pressure_shape_functions);
+  std::vector<double> velocity_divergences(n_q_points);
+
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          fe_values.reinit(cell);
+          local_rhs = 0;
+
+          fe_values[velocities].get_function_divergences(this->present_solution,
+                                                         velocity_divergences);
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              const double JxW = fe_values.JxW(q);
+              for (unsigned int i = 0; i < n_pressure_shape_functions; ++i)
+                local_rhs(i) -=
+                  bdf_coefs[0] * velocity_divergences[q] *
+                  fe_values.shape_value(pressure_shape_functions[i], q) * JxW;
+            }
+
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int k = 0; k < n_pressure_shape_functions; ++k)
+            pressure_dof_indices[k] =
+              local_dof_indices[pressure_shape_functions[k]] - n_velocity_dofs;
+
+          pressure_constraints.distribute_local_to_global(local_rhs,
+                                                          pressure_dof_indices,
+                                                          pressure_rhs);
+        }
+    }
+  pressure_rhs.compress(VectorOperation::add);
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::assemble_velocity_correction_rhs(
+  const unsigned int order)
+{
+  TimerOutput::Scope t(this->computing_timer,
+                       "assemble_velocity_correction_rhs");
+
+  velocity_correction_rhs = 0;
+
+  const Vector<double> bdf_coefs =
+    bdf_coefficients(order, this->simulation_control->get_time_steps_vector());
+
+  QGauss<dim>         quadrature_formula(this->number_quadrature_points);
+  const MappingQ<dim> mapping(
+    this->velocity_fem_degree,
+    this->simulation_parameters.fem_parameters.qmapping_all);
+  FEValues<dim> fe_values(mapping,
+                          this->fe,
+                          quadrature_formula,
+                          update_values | update_gradients |
+                            update_JxW_values);
+
+  const unsigned int dofs_per_cell = this->fe.dofs_per_cell;
+  const unsigned int n_q_points    = quadrature_formula.size();
+  const unsigned int n_velocity_shape_functions =
+    velocity_shape_functions.size();
+
+  const FEValuesExtractors::Vector velocities(0);
+  const FEValuesExtractors::Scalar pressure(dim);
+
+  Vector<double>                       local_rhs(n_velocity_shape_functions);
+  std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+  std::vector<types::global_dof_index> velocity_dof_indices(
+    n_velocity_shape_functions);
+  std::vector<Tensor<1, dim>> pressure_increment_gradients(n_q_points);
+
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_locally_owned())
+        {
+          fe_values.reinit(cell);
+          local_rhs = 0;
+
+          fe_values[pressure].get_function_gradients(
+            this->evaluation_point, pressure_increment_gradients);
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              const double JxW = fe_values.JxW(q);
+              for (unsigned int i = 0; i < n_velocity_shape_functions; ++i)
+                local_rhs(i) -=
+                  pressure_increment_gradients[q] *
+                  fe_values[velocities].value(velocity_shape_functions[i], q) *
+                  JxW / bdf_coefs[0];
+            }
+
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int k = 0; k < n_velocity_shape_functions; ++k)
+            velocity_dof_indices[k] =
+              local_dof_indices[velocity_shape_functions[k]];
+
+          velocity_correction_constraints.distribute_local_to_global(
+            local_rhs, velocity_dof_indices, velocity_correction_rhs);
+        }
+    }
+  velocity_correction_rhs.compress(VectorOperation::add);
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::solve_velocity_system()
+{
+  // The convective velocity changes at every time step, hence the AMG
+  // preconditioner of the velocity is rebuilt at every time step
+  {
+    TimerOutput::Scope t(this->computing_timer, "setup_velocity_AMG");
+
+    const bool elliptic              = false;
+    bool       higher_order_elements = false;
+    if (this->velocity_fem_degree > 1)
+      higher_order_elements = true;
+    const unsigned int n_cycles =
+      this->simulation_parameters.linear_solver.amg_n_cycles;
+    const bool w_cycle =
+      this->simulation_parameters.linear_solver.amg_w_cycles;
+    const double aggregation_threshold =
+      this->simulation_parameters.linear_solver.amg_aggregation_threshold;
+    const unsigned int smoother_sweeps =
+      this->simulation_parameters.linear_solver.amg_smoother_sweeps;
+    const unsigned int smoother_overlap =
+      this->simulation_parameters.linear_solver.amg_smoother_overlap;
+    const bool                                        output_details = false;
+    const char *                                      smoother_type  = "ILU";
+    const char *                                      coarse_type    = "ILU";
+    TrilinosWrappers::PreconditionAMG::AdditionalData preconditionerOptions(
+      elliptic,
+      higher_order_elements,
+      n_cycles,
+      w_cycle,
+      aggregation_threshold,
+      velocity_constant_modes,
+      smoother_sweeps,
+      smoother_overlap,
+      output_details,
+      smoother_type,
+      coarse_type);
+
+    Teuchos::ParameterList              parameter_ml;
+    std::unique_ptr<Epetra_MultiVector> distributed_constant_modes;
+    preconditionerOptions.set_parameters(parameter_ml,
+                                         distributed_constant_modes,
+                                         velocity_matrix);
+    const double ilu_fill =
+      this->simulation_parameters.linear_solver.amg_precond_ilu_fill;
+    const double ilu_atol =
+      this->simulation_parameters.linear_solver.amg_precond_ilu_atol;
+    const double ilu_rtol =
+      this->simulation_parameters.linear_solver.amg_precond_ilu_rtol;
+    parameter_ml.set("smoother: ifpack level-of-fill", ilu_fill);
+    parameter_ml.set("smoother: ifpack absolute threshold", ilu_atol);
+    parameter_ml.set("smoother: ifpack relative threshold", ilu_rtol);
+
+    parameter_ml.set("coarse: ifpack level-of-fill", ilu_fill);
+    parameter_ml.set("coarse: ifpack absolute threshold", ilu_atol);
+    parameter_ml.set("coarse: ifpack relative threshold", ilu_rtol);
+    velocity_amg_preconditioner =
+      std::make_shared<TrilinosWrappers::PreconditionAMG>();
+    velocity_amg_preconditioner->initialize(velocity_matrix, parameter_ml);
+  }
+
+  TimerOutput::Scope t(this->computing_timer, "solve_velocity_system");
+
+  const double linear_solver_tolerance =
+    std::max(this->simulation_parameters.linear_solver.relative_residual *
+               velocity_rhs.l2_norm(),
+             this->simulation_parameters.linear_solver.minimum_residual);
+
+  SolverControl solver_control(
+    this->simulation_parameters.linear_solver.max_iterations,
+    linear_solver_tolerance,
+    true,
+    true);
+
+  TrilinosWrappers::SolverGMRES::AdditionalData solver_parameters(
+    false, this->simulation_parameters.linear_solver.max_krylov_vectors);
+
+  TrilinosWrappers::SolverGMRES solver(solver_control, solver_parameters);
+
+  solver.solve(velocity_matrix,
+               velocity_solution,
+               velocity_rhs,
+               *velocity_amg_preconditioner);
+
+  if (this->simulation_parameters.linear_solver.verbosity !=
+      Parameters::Verbosity::quiet)
+    {
+      this->pcout << "  -Velocity solver took : " << solver_control.last_step()
+                  << " steps " << std::endl;
+    }
+
+  velocity_constraints.distribute(velocity_solution);
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::solve_pressure_system()
+{
+  TimerOutput::Scope t(this->computing_timer, "solve_pressure_system");
+
+  const double linear_solver_tolerance =
+    std::max(this->simulation_parameters.linear_solver.relative_residual *
+               pressure_rhs.l2_norm(),
+             this->simulation_parameters.linear_solver.minimum_residual);
+
+  SolverControl solver_control(
+    this->simulation_parameters.linear_solver.max_iterations,
+    linear_solver_tolerance,
+    true,
+    true);
+
+  TrilinosWrappers::SolverCG solver(solver_control);
+
+  pressure_increment = 0;
+  solver.solve(pressure_laplacian_matrix,
+               pressure_increment,
+               pressure_rhs,
+               *pressure_amg_preconditioner);
+
+  if (this->simulation_parameters.linear_solver.verbosity !=
+      Parameters::Verbosity::quiet)
+    {
+      this->pcout << "  -Pressure solver took : " << solver_control.last_step()
+                  << " steps " << std::endl;
+    }
+
+  pressure_constraints.distribute(pressure_increment);
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::solve_velocity_correction()
+{
+  TimerOutput::Scope t(this->computing_timer, "solve_velocity_correction");
+
+  const double linear_solver_tolerance =
+    std::max(this->simulation_parameters.linear_solver.relative_residual *
+               velocity_correction_rhs.l2_norm(),
+             this->simulation_parameters.linear_solver.minimum_residual);
+
+  SolverControl solver_control(
+    this->simulation_parameters.linear_solver.max_iterations,
+    linear_solver_tolerance,
+    true,
+    true);
+
+  TrilinosWrappers::SolverCG solver(solver_control);
+
+  velocity_correction = 0;
+  solver.solve(velocity_mass_matrix,
+               velocity_correction,
+               velocity_correction_rhs,
+               *velocity_mass_preconditioner);
+
+  if (this->simulation_parameters.linear_solver.verbosity !=
+      Parameters::Verbosity::quiet)
+    {
+      this->pcout << "  -Velocity correction solver took : "
+                  << solver_control.last_step() << " steps " << std::endl;
+    }
+
+  velocity_correction_constraints.distribute(velocity_correction);
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::iterate()
+{
+  const Parameters::SimulationControl::TimeSteppingMethod method =
+    this->simulation_parameters.simulation_control.method;
+
+  // The order of the BDF scheme is limited by the number of previous
+  // solutions, this replaces the startup of the high order BDF schemes
+  const unsigned int order =
+    std::max(1U,
+             std::min(bdf_order(method), this->number_of_previous_solutions));
+
+  auto &local_evaluation_point = this->local_evaluation_point;
+  local_evaluation_point       = this->present_solution;
+
+  const unsigned int n_locally_owned_velocity_dofs =
+    locally_owned_velocity_dofs.n_elements();
+
+  // Velocity step, the velocity of the previous time step is the initial
+  // guess of the iterative solver
+  assemble_velocity_system(order);
+  std::copy(local_evaluation_point.begin(),
+            local_evaluation_point.begin() + n_locally_owned_velocity_dofs,
+            velocity_solution.begin());
+  solve_velocity_system();
+  std::copy(velocity_solution.begin(),
+            velocity_solution.end(),
+            local_evaluation_point.begin());
+  this->present_solution = local_evaluation_point;
+
+  // Pressure-correction step
+  assemble_pressure_rhs(order);
+  solve_pressure_system();
+
+  // Velocity correction step, u = u* - grad phi / alpha_0. The gradient of the
+  // pressure increment is evaluated from the monolithic layout.
+  this->newton_update = 0;
+  std::copy(pressure_increment.begin(),
+            pressure_increment.end(),
+            this->newton_update.begin() + n_locally_owned_velocity_dofs);
+  this->evaluation_point = this->newton_update;
+  assemble_velocity_correction_rhs(order);
+  solve_velocity_correction();
+
+  std::transform(velocity_correction.begin(),
+                 velocity_correction.end(),
+                 local_evaluation_point.begin(),
+                 local_evaluation_point.begin(),
+                 std::plus<double>());
+  std::transform(pressure_increment.begin(),
+                 pressure_increment.end(),
+                 local_evaluation_point.begin() + n_locally_owned_velocity_dofs,
+                 local_evaluation_point.begin() + n_locally_owned_velocity_dofs,
+                 std::plus<double>());
+  this->present_solution = local_evaluation_point;
+
+  this->multiphysics->notify_fluid_solution_update();
+  this->multiphysics->solve(method, false);
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::first_iteration()
+{
+  iterate();
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::assemble_matrix_and_rhs(
+  const Parameters::SimulationControl::TimeSteppingMethod)
+{
+  throw std::runtime_error(
+    "Projection NS - The projection solver does not assemble a monolithic "
+    "system");
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::assemble_rhs(
+  const Parameters::SimulationControl::TimeSteppingMethod)
+{
+  throw std::runtime_error(
+    "Projection NS - The projection solver does not assemble a monolithic "
+    "system");
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::solve_linear_system(const bool,
+                                                       const bool)
+{
+  throw std::runtime_error(
+    "Projection NS - The projection solver does not solve a monolithic "
+    "system");
+}
+
+template <int dim>
+void
+ProjectionNavierStokesSolver<dim>::solve()
+{
+  const Parameters::SimulationControl::TimeSteppingMethod method =
+    this->simulation_parameters.simulation_control.method;
+  AssertThrow(is_bdf(method) &&
+                method !=
+                  Parameters::SimulationControl::TimeSteppingMethod::steady_bdf,
+              ExcMessage(
+                "The projection solver only supports the bdf1, bdf2 and bdf3 "
+                "time-stepping methods"));
+
+  read_mesh_and_manifolds(
+    this->triangulation,
+    this->simulation_parameters.mesh,
+    this->simulation_parameters.manifolds_parameters,
+    this->simulation_parameters.restart_parameters.restart,
+    this->simulation_parameters.boundary_conditions);
+
+  this->setup_dofs();
+  this->set_initial_condition(
+    this->simulation_parameters.initial_condition->type,
+    this->simulation_parameters.restart_parameters.restart);
+
+  while (this->simulation_control->integrate())
+    {
+      this->simulation_control->print_progression(this->pcout);
+      this->dynamic_flow_control();
+
+      if (this->simulation_control->is_at_start())
+        this->first_iteration();
+      else
+        {
+          NavierStokesBase<dim, TrilinosWrappers::MPI::Vector, IndexSet>::
+            refine_mesh();
+          this->iterate();
+        }
+      this->postprocess(false);
+      this->finish_time_step();
+    }
+
+
+  this->finish_simulation();
+}
+
+
+// Pre-compile the 2D and 3D projection solver to ensure that the library is
+// valid before we actually compile the solver
+template class ProjectionNavierStokesSolver<2>;
+template class ProjectionNavierStokesSolver<3>;
@@ -0,0 +1,86 @@
+/**
+ * @brief This code tests the coefficients of the polynomial extrapolation
+ * of the solution from the previous time steps.
+ */
+
+// Lethe
+#include <core/bdf.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+
+void
+test()
+{
+  std::vector<double> dt(4, 0.1);
+  dt[1] = 0.2;
+  dt[2] = 0.3;
+  dt[3] = 0.4;
+  deallog << "Time steps ";
+  for (unsigned int i = 0; i < dt.size(); ++i)
+    {
+      deallog << dt[i] << " ";
+    }
+  deallog << std::endl;
+
+  Vector<double> order0_coefficients = extrapolation_coefficients(0, dt);
+  deallog << "Order 0 : " << order0_coefficients[0] << std::endl;
+
+  Vector<double> order1_coefficients = extrapolation_coefficients(1, dt);
+  deallog << "Order 1 : " << order1_coefficients[0] << " "
+          << order1_coefficients[1] << std::endl;
+
+  Vector<double> order2_coefficients = extrapolation_coefficients(2, dt);
+  deallog << "Order 2 : " << order2_coefficients[0] << " "
+          << order2_coefficients[1] << " " << order2_coefficients[2]
+          << std::endl;
+
+  // The extrapolation of a linear function is exact for order 1 and above
+  const double time_0 = -dt[0];
+  const double time_1 = -dt[0] - dt[1];
+  const double time_2 = -dt[0] - dt[1] - dt[2];
+  const double linear_extrapolation =
+    order2_coefficients[0] * (1. + 2. * time_0) +
+    order2_coefficients[1] * (1. + 2. * time_1) +
+    order2_coefficients[2] * (1. + 2. * time_2);
+  deallog << "Linear function extrapolation : " << linear_extrapolation
+          << std::endl;
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
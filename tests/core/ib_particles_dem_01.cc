@@ -0,0 +1,123 @@
+/**
+ * @brief This code tests the integration of the motion of immersed boundary
+ * particles with the non-linear contact model. Two identical particles
+ * collide head-on, then a particle with a tangential velocity bounces on the
+ * bottom wall of a cube. The normal velocity after a collision must be close
+ * to the opposite of the approach velocity multiplied by the restitution
+ * coefficient, and the friction on the wall must set the particle in rotation.
+ */
+
+// Deal.II includes
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+// Lethe
+#include <core/ib_particles_dem.h>
+#include <core/parameters.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+
+void
+test()
+{
+  Parameters::IBParticles<3> parameters;
+  parameters.contact_substeps             = 100;
+  parameters.gravity                      = 0;
+  parameters.youngs_modulus               = 1e6;
+  parameters.poisson_ratio                = 0.3;
+  parameters.restitution_coefficient      = 0.9;
+  parameters.friction_coefficient         = 0.3;
+  parameters.wall_youngs_modulus          = 1e6;
+  parameters.wall_poisson_ratio           = 0.3;
+  parameters.wall_restitution_coefficient = 0.9;
+  parameters.wall_friction_coefficient    = 0.3;
+
+  const double dt = 0.01;
+
+  IBParticle<3> particle;
+  particle.radius  = 0.1;
+  particle.density = 1000;
+
+  // Head-on collision of two particles
+  {
+    IBParticlesDEM<3> particles_dem(parameters, 1);
+
+    std::vector<IBParticle<3>> particles(2, particle);
+    particles[0].position    = Point<3>(0.4, 0.5, 0.5);
+    particles[0].velocity[0] = 0.1;
+    particles[1].position    = Point<3>(0.602, 0.5, 0.5);
+    particles[1].velocity[0] = -0.1;
+
+    for (unsigned int step = 0; step < 20; ++step)
+      particles_dem.integrate(particles, dt);
+
+    deallog << "Particle-particle collision" << std::endl;
+    deallog << "Velocities : " << particles[0].velocity[0] << " "
+            << particles[1].velocity[0] << std::endl;
+    deallog << "Positions : " << particles[0].position[0] << " "
+            << particles[1].position[0] << std::endl;
+  }
+
+  // Oblique collision of a particle with the bottom wall of a cube
+  {
+    Triangulation<3> triangulation;
+    GridGenerator::hyper_cube(triangulation, 0, 1);
+
+    IBParticlesDEM<3> particles_dem(parameters, 1);
+    particles_dem.update_walls(triangulation);
+
+    std::vector<IBParticle<3>> particles(1, particle);
+    particles[0].position    = Point<3>(0.5, 0.5, 0.15);
+    particles[0].velocity[0] = 0.2;
+    particles[0].velocity[2] = -0.5;
+
+    for (unsigned int step = 0; step < 30; ++step)
+      particles_dem.integrate(particles, dt);
+
+    deallog << "Particle-wall collision" << std::endl;
+    deallog << "Velocity : " << particles[0].velocity[0] << " "
+            << particles[0].velocity[2] << std::endl;
+    deallog << "Angular velocity : " << particles[0].omega[1] << std::endl;
+    deallog << "Position : " << particles[0].position[0] << " "
+            << particles[0].position[2] << std::endl;
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @brief This code tests the restart of the integration of the motion of
+ * immersed boundary particles. A particle bounces on the bottom wall of a
+ * cube with a tangential velocity. The history of the contacts is saved
+ * during the collision and read by a new integrator, which continues the
+ * integration from a copy of the particles. The restarted integration must
+ * be identical to the uninterrupted one.
+ */
+
+// Deal.II includes
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+// Lethe
+#include <core/ib_particles_dem.h>
+#include <core/parameters.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+
+void
+test()
+{
+  Parameters::IBParticles<3> parameters;
+  parameters.contact_substeps             = 100;
+  parameters.gravity                      = 0;
+  parameters.youngs_modulus               = 1e6;
+  parameters.poisson_ratio                = 0.3;
+  parameters.restitution_coefficient      = 0.9;
+  parameters.friction_coefficient         = 0.3;
+  parameters.wall_youngs_modulus          = 1e6;
+  parameters.wall_poisson_ratio           = 0.3;
+  parameters.wall_restitution_coefficient = 0.9;
+  parameters.wall_friction_coefficient    = 0.3;
+
+  const double dt = 0.01;
+
+  Triangulation<3> triangulation;
+  GridGenerator::hyper_cube(triangulation, 0, 1);
+
+  IBParticle<3> particle;
+  particle.radius      = 0.1;
+  particle.density     = 1000;
+  particle.position    = Point<3>(0.5, 0.5, 0.15);
+  particle.velocity[0] = 0.2;
+  particle.velocity[2] = -0.5;
+
+  IBParticlesDEM<3> particles_dem(parameters, 1);
+  particles_dem.update_walls(triangulation);
+
+  std::vector<IBParticle<3>> particles(1, particle);
+
+  // The particle touches the wall after 10 time steps and the contact lasts
+  // about 5 time steps, the history is saved during the contact
+  for (unsigned int step = 0; step < 12; ++step)
+    particles_dem.integrate(particles, dt);
+  particles_dem.save("restart");
+
+  IBParticlesDEM<3> restarted_particles_dem(parameters, 1);
+  restarted_particles_dem.update_walls(triangulation);
+  restarted_particles_dem.read("restart");
+
+  std::vector<IBParticle<3>> restarted_particles(particles);
+
+  for (unsigned int step = 12; step < 30; ++step)
+    {
+      particles_dem.integrate(particles, dt);
+      restarted_particles_dem.integrate(restarted_particles, dt);
+    }
+
+  deallog << "Uninterrupted integration" << std::endl;
+  deallog << "Velocity : " << particles[0].velocity[0] << " "
+          << particles[0].velocity[2] << std::endl;
+  deallog << "Angular velocity : " << particles[0].omega[1] << std::endl;
+  deallog << "Position : " << particles[0].position[0] << " "
+          << particles[0].position[2] << std::endl;
+
+  deallog << "Restarted integration" << std::endl;
+  deallog << "Velocity : " << restarted_particles[0].velocity[0] << " "
+          << restarted_particles[0].velocity[2] << std::endl;
+  deallog << "Angular velocity : " << restarted_particles[0].omega[1]
+          << std::endl;
+  deallog << "Position : " << restarted_particles[0].position[0] << " "
+          << restarted_particles[0].position[2] << std::endl;
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,105 @@
+/**
+ * @brief Tests the Newton non-linear solver when the jacobian matrix of the
+ * previous solve is reused. The system is first solved with a fresh jacobian,
+ * the solution is then perturbed and the system is solved again with the
+ * jacobian matrix of the first solve.
+ */
+
+// Lethe
+#include <core/parameters.h>
+
+// Tests (with common definitions)
+#include <../tests/core/non_linear_test_system_01.h>
+#include <../tests/tests.h>
+
+void
+test()
+{
+  Parameters::NonLinearSolver params{
+    Parameters::Verbosity::quiet,
+    Parameters::NonLinearSolver::SolverType::newton,
+    1e-8,  // tolerance
+    0.9,   // relative tolerance
+    10,    // maxIter
+    4,     // display precision
+    1,     // skip iterations
+    false, // extrapolate initial guess
+    true   // reuse sdirk jacobian
+  };
+
+  deallog << "Creating solver" << std::endl;
+
+  // Create an instantiation of the Test Class
+  std::unique_ptr<TestClass> solver = std::make_unique<TestClass>(params);
+
+
+  deallog << "Solving non-linear system " << std::endl;
+  // Solve the non-linear system of equation
+  solver->solve_non_linear_system(
+    Parameters::SimulationControl::TimeSteppingMethod::steady, true, true);
+
+  auto &present_solution = solver->get_present_solution();
+  deallog << "The final solution is : " << present_solution[0] << " "
+          << present_solution[1] << std::endl;
+  deallog << "Number of jacobian assemblies : "
+          << solver->get_number_of_matrix_assemblies() << std::endl;
+
+  // Perturb the solution and solve again with the jacobian of the first solve
+  present_solution[0] = 2;
+  present_solution[1] = 0;
+
+  deallog << "Solving non-linear system with the previous jacobian "
+          << std::endl;
+  solver->solve_non_linear_system(
+    Parameters::SimulationControl::TimeSteppingMethod::steady,
+    false,
+    true,
+    true);
+
+  deallog << "The final solution is : " << present_solution[0] << " "
+          << present_solution[1] << std::endl;
+
+  // The previous jacobian converges without stalling, hence it is never
+  // assembled again
+  deallog << "Number of jacobian assemblies : "
+          << solver->get_number_of_matrix_assemblies() << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(
+        argc, argv, numbers::invalid_unsigned_int);
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
@@ -44,6 +44,7 @@ class TestClass : public PhysicsSolver<Vector<double>>
 public:
   TestClass(Parameters::NonLinearSolver &params)
     : PhysicsSolver(params)
+    , number_of_matrix_assemblies(0)
   {
     // Initialize the vectors needed for the Physics Solver
     evaluation_point.reinit(2);
@@ -64,6 +65,7 @@ public:
     const Parameters::SimulationControl::TimeSteppingMethod
     /*time_stepping_method*/) override
   {
+    number_of_matrix_assemblies++;
     system_matrix.reinit(2);
     // System
     // x_0*x_0 +x_1 = 0
@@ -145,8 +147,18 @@ public:
     return dummy_constraints;
   };
 
+  /**
+   * @brief Number of times the jacobian matrix has been assembled
+   */
+  unsigned int
+  get_number_of_matrix_assemblies() const
+  {
+    return number_of_matrix_assemblies;
+  };
+
 
 private:
+  unsigned int              number_of_matrix_assemblies;
   LAPACKFullMatrix<double>  system_matrix;
   AffineConstraints<double> dummy_constraints;
   Vector<double>            system_rhs;
@@ -0,0 +1,96 @@
+/**
+ * @brief Check the location of points in the active cells of a DoFHandler
+ * with the cached point locator, with and without hint cells, and after the
+ * refinement of the triangulation.
+ */
+
+// Deal.II includes
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+// Lethe
+#include <core/point_locator.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+void
+test()
+{
+  Triangulation<2> tria;
+  GridGenerator::hyper_cube(tria, 0, 1);
+  tria.refine_global(2);
+
+  FE_Q<2>       fe(1);
+  DoFHandler<2> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  PointLocator<2> point_locator(dof_handler);
+
+  // Location without hint
+  const auto cell = point_locator.find_cell(Point<2>(0.3, 0.6));
+  deallog << "Cell center : " << cell->center() << std::endl;
+
+  // Location of a point in a neighbor of the hint
+  const auto neighbor = point_locator.find_cell(Point<2>(0.55, 0.6), cell);
+  deallog << "Neighbor center : " << neighbor->center() << std::endl;
+
+  // Location of a point outside of the domain
+  if (point_locator.find_cell(Point<2>(1.5, 0.5)) == dof_handler.end())
+    deallog << "Point outside of the domain not found" << std::endl;
+
+  // Batched location
+  std::vector<Point<2>> points{Point<2>(0.1, 0.1),
+                               Point<2>(0.2, 0.1),
+                               Point<2>(0.3, 0.1)};
+
+  std::vector<DoFHandler<2>::active_cell_iterator> cells;
+  point_locator.find_cells(points, cells);
+  for (const auto &batch_cell : cells)
+    deallog << "Batch center : " << batch_cell->center() << std::endl;
+
+  // The locator must be updated after the refinement of the triangulation
+  tria.refine_global(1);
+  dof_handler.distribute_dofs(fe);
+  const auto refined_cell = point_locator.find_cell(Point<2>(0.3, 0.6));
+  deallog << "Refined cell center : " << refined_cell->center() << std::endl;
+}
+
+int
+main()
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+}
@@ -0,0 +1,126 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2020 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+
+*
+* Author: Bruno Blais, Polytechnique Montreal, 2020-
+*/
+
+/**
+ * @brief This test checks the time step control based on the time
+ * integration error: the rejection of a time step, the PI controller
+ * and the bound on the growth of the time step.
+ */
+
+// Lethe
+#include <core/parameters.h>
+#include <core/simulation_control.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+void
+print_time_step(SimulationControlTransient &simulation_control)
+{
+  deallog << "Iteration : " << simulation_control.get_step_number()
+          << "    Time : " << simulation_control.get_current_time()
+          << "    Time step : " << simulation_control.get_time_step()
+          << std::endl;
+}
+
+void
+test()
+{
+  Parameters::SimulationControl simulation_control_parameters;
+
+  simulation_control_parameters.dt     = 0.1;
+  simulation_control_parameters.adapt  = true;
+  simulation_control_parameters.maxCFL = 1;
+  simulation_control_parameters.method =
+    Parameters::SimulationControl::TimeSteppingMethod::bdf1;
+  simulation_control_parameters.time_step_control =
+    Parameters::SimulationControl::TimeStepControl::error;
+
+  simulation_control_parameters.adaptative_time_step_scaling = 2;
+  simulation_control_parameters.timeEnd                      = 10;
+  simulation_control_parameters.number_mesh_adaptation       = 0;
+  simulation_control_parameters.output_name                  = "test";
+  simulation_control_parameters.subdivision                  = 7;
+  simulation_control_parameters.output_folder                = "canard";
+  simulation_control_parameters.output_frequency             = 8;
+
+  SimulationControlTransient simulation_control(simulation_control_parameters);
+
+  simulation_control.integrate();
+  print_time_step(simulation_control);
+
+  // The error is four times the tolerance, the time step is rejected
+  simulation_control.set_time_step_error(4, 1);
+  simulation_control.reject_time_step();
+  deallog << "Rejected" << std::endl;
+  print_time_step(simulation_control);
+
+  // Accepted time steps, the time step grows with the PI controller
+  simulation_control.set_time_step_error(0.25, 1);
+  simulation_control.integrate();
+  print_time_step(simulation_control);
+
+  simulation_control.set_time_step_error(0.5, 1);
+  simulation_control.integrate();
+  print_time_step(simulation_control);
+
+  // The time step is kept when no error estimate is provided
+  simulation_control.integrate();
+  print_time_step(simulation_control);
+
+  // The growth of the time step is bound by the scaling
+  simulation_control.set_time_step_error(1e-6, 1);
+  simulation_control.integrate();
+  print_time_step(simulation_control);
+}
+
+int
+main()
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+}
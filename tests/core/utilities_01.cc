@@ -0,0 +1,83 @@
+/**
+ * @brief This code tests the Fibonacci lattice of directions on the unit
+ * sphere. The directions must be unit vectors and, since every direction
+ * represents the same area, the second moment of the directions integrated
+ * over the sphere must converge to 4 pi / 3 in every direction.
+ */
+
+// Lethe
+#include <core/utilities.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+
+void
+test()
+{
+  deallog << "Exact second moment : " << 4. * numbers::PI / 3. << std::endl;
+
+  for (const unsigned int n_points : {100, 1000})
+    {
+      const std::vector<Tensor<1, 3>> directions =
+        fibonacci_sphere_directions(n_points);
+
+      const double da = 4. * numbers::PI / n_points;
+
+      double       max_norm_error = 0;
+      Tensor<1, 3> second_moment;
+      for (const auto &direction : directions)
+        {
+          max_norm_error =
+            std::max(max_norm_error, std::abs(direction.norm() - 1.));
+          for (unsigned int d = 0; d < 3; ++d)
+            second_moment[d] += direction[d] * direction[d] * da;
+        }
+
+      deallog << "Number of directions : " << directions.size() << std::endl;
+      deallog << "Unit directions : " << (max_norm_error < 1e-12) << std::endl;
+      deallog << "Second moment : ";
+      for (unsigned int d = 0; d < 3; ++d)
+        {
+          deallog << second_moment[d] << " ";
+        }
+      deallog << std::endl;
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
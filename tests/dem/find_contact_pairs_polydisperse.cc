@@ -0,0 +1,191 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2020 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief One large particle and three small particles are inserted manually.
+ * We check that the polydisperse broad search only keeps the pairs which are
+ * within their per-pair cutoff distance (sum of the radii and the skin),
+ * while the monodisperse broad search keeps all the pairs of adjacent cells.
+ */
+
+// Deal.II includes
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle.h>
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/particle_iterator.h>
+
+// Lethe
+#include <dem/dem_properties.h>
+#include <dem/find_cell_neighbors.h>
+#include <dem/pp_broad_search.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+#include <set>
+
+using namespace dealii;
+
+// Returns the number of unique candidate pairs
+unsigned int
+count_candidate_pairs(
+  const std::unordered_map<int, std::vector<int>> &contact_pair_candidates)
+{
+  unsigned int number_of_pairs = 0;
+  for (const auto &candidates : contact_pair_candidates)
+    number_of_pairs += candidates.second.size();
+  return number_of_pairs;
+}
+
+template <int dim>
+void
+test()
+{
+  // Generate a cube triangulation and refine it twice globally
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  int                                       hyper_cube_length = 1;
+  GridGenerator::hyper_cube(triangulation,
+                            -1 * hyper_cube_length,
+                            hyper_cube_length,
+                            true);
+  int refinement_number = 2;
+  triangulation.refine_global(refinement_number);
+  MappingQ<dim> mapping(1);
+
+  Particles::ParticleHandler<dim> particle_handler(
+    triangulation, mapping, DEM::get_number_properties());
+
+  // Finding cell neighbors list, it is required for finding the broad search
+  // pairs
+  std::vector<std::vector<typename Triangulation<dim>::active_cell_iterator>>
+    local_neighbor_list;
+  std::vector<std::vector<typename Triangulation<dim>::active_cell_iterator>>
+    ghost_neighbor_list;
+
+  FindCellNeighbors<dim> cell_neighbor_object;
+  cell_neighbor_object.find_cell_neighbors(triangulation,
+                                           local_neighbor_list,
+                                           ghost_neighbor_list);
+
+  // Inserting one large particle (id 0) and three small particles. Particles 0
+  // and 3 are in the same cell, particles 1 and 2 are in the adjacent cell in
+  // x direction
+  const std::vector<Point<dim>> positions = {{-0.3, 0.1, 0.1},
+                                             {0.15, 0.1, 0.1},
+                                             {0.2, 0.1, 0.1},
+                                             {-0.05, 0.1, 0.1}};
+  const std::vector<double>     diameters = {0.4, 0.04, 0.04, 0.04};
+
+  for (unsigned int id = 0; id < positions.size(); ++id)
+    {
+      std::pair<typename Triangulation<dim>::active_cell_iterator, Point<dim>>
+        particle_info = GridTools::find_active_cell_around_point(mapping,
+                                                                 triangulation,
+                                                                 positions[id]);
+      Particles::Particle<dim> particle(positions[id],
+                                        particle_info.second,
+                                        id);
+      Particles::ParticleIterator<dim> particle_iterator =
+        particle_handler.insert_particle(particle, particle_info.first);
+      particle_iterator->get_properties()[DEM::PropertiesIndex::dp] =
+        diameters[id];
+    }
+
+  // The skin corresponds to a neighborhood threshold of 1.3
+  const double maximum_particle_diameter = 0.4;
+  const double contact_search_skin       = 0.3 * maximum_particle_diameter;
+
+  PPBroadSearch<dim>                        broad_search_object;
+  std::unordered_map<int, std::vector<int>> local_contact_pair_candidates;
+  std::unordered_map<int, std::vector<int>> ghost_contact_pair_candidates;
+
+  broad_search_object.find_particle_particle_contact_pairs(
+    particle_handler,
+    &local_neighbor_list,
+    &ghost_neighbor_list,
+    local_contact_pair_candidates,
+    ghost_contact_pair_candidates);
+
+  deallog << "Number of candidate pairs (monodisperse search): "
+          << count_candidate_pairs(local_contact_pair_candidates) << std::endl;
+
+  broad_search_object.find_particle_particle_contact_pairs_polydisperse(
+    particle_handler,
+    &local_neighbor_list,
+    &ghost_neighbor_list,
+    maximum_particle_diameter,
+    contact_search_skin,
+    local_contact_pair_candidates,
+    ghost_contact_pair_candidates);
+
+  deallog << "Number of candidate pairs (polydisperse search): "
+          << count_candidate_pairs(local_contact_pair_candidates) << std::endl;
+
+  // Output of the pairs, sorted to be independent of the order of the cells
+  std::set<std::pair<int, int>> candidate_pairs;
+  for (const auto &[particle_one_id, candidates] :
+       local_contact_pair_candidates)
+    for (const int particle_two_id : candidates)
+      candidate_pairs.insert({std::min(particle_one_id, particle_two_id),
+                              std::max(particle_one_id, particle_two_id)});
+
+  for (const auto &pair : candidate_pairs)
+    deallog << "A pair is detected: particle " << pair.first
+            << " and particle " << pair.second << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      initlog();
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(
+        argc, argv, numbers::invalid_unsigned_int);
+      test<3>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
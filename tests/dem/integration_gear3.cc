@@ -95,6 +95,9 @@ test()
   pit->get_properties()[DEM::PropertiesIndex::force_x]          = 0;
   pit->get_properties()[DEM::PropertiesIndex::force_y]          = 0;
   pit->get_properties()[DEM::PropertiesIndex::force_z]          = 0;
+  pit->get_properties()[DEM::PropertiesIndex::fem_force_x]      = 0;
+  pit->get_properties()[DEM::PropertiesIndex::fem_force_y]      = 0;
+  pit->get_properties()[DEM::PropertiesIndex::fem_force_z]      = 0;
   pit->get_properties()[DEM::PropertiesIndex::omega_x]          = 0;
   pit->get_properties()[DEM::PropertiesIndex::omega_y]          = 0;
   pit->get_properties()[DEM::PropertiesIndex::omega_z]          = 0;
@@ -109,6 +109,9 @@ test()
   pit0->get_properties()[DEM::PropertiesIndex::force_x]     = 0;
   pit0->get_properties()[DEM::PropertiesIndex::force_y]     = 0;
   pit0->get_properties()[DEM::PropertiesIndex::force_z]     = 0;
+  pit0->get_properties()[DEM::PropertiesIndex::fem_force_x] = 0;
+  pit0->get_properties()[DEM::PropertiesIndex::fem_force_y] = 0;
+  pit0->get_properties()[DEM::PropertiesIndex::fem_force_z] = 0;
   pit0->get_properties()[DEM::PropertiesIndex::mass]        = particle_mass;
   pit0->get_properties()[DEM::PropertiesIndex::mom_inertia] = 1;
 
@@ -160,6 +163,9 @@ test()
   pit1->get_properties()[DEM::PropertiesIndex::force_x]     = 0;
   pit1->get_properties()[DEM::PropertiesIndex::force_y]     = 0;
   pit1->get_properties()[DEM::PropertiesIndex::force_z]     = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::fem_force_x] = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::fem_force_y] = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::fem_force_z] = 0;
   pit1->get_properties()[DEM::PropertiesIndex::mass]        = particle_mass;
   pit1->get_properties()[DEM::PropertiesIndex::mom_inertia] = 1;
 
@@ -208,6 +214,9 @@ test()
   pit2->get_properties()[DEM::PropertiesIndex::force_x]     = 0;
   pit2->get_properties()[DEM::PropertiesIndex::force_y]     = 0;
   pit2->get_properties()[DEM::PropertiesIndex::force_z]     = 0;
+  pit2->get_properties()[DEM::PropertiesIndex::fem_force_x] = 0;
+  pit2->get_properties()[DEM::PropertiesIndex::fem_force_y] = 0;
+  pit2->get_properties()[DEM::PropertiesIndex::fem_force_z] = 0;
   pit2->get_properties()[DEM::PropertiesIndex::mass]        = particle_mass;
   pit2->get_properties()[DEM::PropertiesIndex::mom_inertia] = 1;
 
@@ -251,6 +260,9 @@ test()
   pit3->get_properties()[DEM::PropertiesIndex::force_x]     = 0;
   pit3->get_properties()[DEM::PropertiesIndex::force_y]     = 0;
   pit3->get_properties()[DEM::PropertiesIndex::force_z]     = 0;
+  pit3->get_properties()[DEM::PropertiesIndex::fem_force_x] = 0;
+  pit3->get_properties()[DEM::PropertiesIndex::fem_force_y] = 0;
+  pit3->get_properties()[DEM::PropertiesIndex::fem_force_z] = 0;
   pit3->get_properties()[DEM::PropertiesIndex::mass]        = particle_mass;
   pit3->get_properties()[DEM::PropertiesIndex::mom_inertia] = 1;
 
@@ -301,6 +313,9 @@ test()
   pit4->get_properties()[DEM::PropertiesIndex::force_x]     = 0;
   pit4->get_properties()[DEM::PropertiesIndex::force_y]     = 0;
   pit4->get_properties()[DEM::PropertiesIndex::force_z]     = 0;
+  pit4->get_properties()[DEM::PropertiesIndex::fem_force_x] = 0;
+  pit4->get_properties()[DEM::PropertiesIndex::fem_force_y] = 0;
+  pit4->get_properties()[DEM::PropertiesIndex::fem_force_z] = 0;
   pit4->get_properties()[DEM::PropertiesIndex::mass]        = particle_mass;
   pit4->get_properties()[DEM::PropertiesIndex::mom_inertia] = 1;
 
@@ -348,6 +363,9 @@ test()
   pit5->get_properties()[DEM::PropertiesIndex::force_x]     = 0;
   pit5->get_properties()[DEM::PropertiesIndex::force_y]     = 0;
   pit5->get_properties()[DEM::PropertiesIndex::force_z]     = 0;
+  pit5->get_properties()[DEM::PropertiesIndex::fem_force_x] = 0;
+  pit5->get_properties()[DEM::PropertiesIndex::fem_force_y] = 0;
+  pit5->get_properties()[DEM::PropertiesIndex::fem_force_z] = 0;
   pit5->get_properties()[DEM::PropertiesIndex::mass]        = particle_mass;
   pit5->get_properties()[DEM::PropertiesIndex::mom_inertia] = 1;
 
@@ -128,6 +128,9 @@ test()
   pit1->get_properties()[DEM::PropertiesIndex::force_x]     = 0;
   pit1->get_properties()[DEM::PropertiesIndex::force_y]     = 0;
   pit1->get_properties()[DEM::PropertiesIndex::force_z]     = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::fem_force_x] = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::fem_force_y] = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::fem_force_z] = 0;
   pit1->get_properties()[DEM::PropertiesIndex::omega_x]     = 0;
   pit1->get_properties()[DEM::PropertiesIndex::omega_y]     = 0;
   pit1->get_properties()[DEM::PropertiesIndex::omega_z]     = 0;
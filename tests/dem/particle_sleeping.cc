@@ -0,0 +1,208 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2020 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief This test checks the deactivation (sleeping) of particles at rest
+ * and the waking up of a sleeping particle by a moving neighbor.
+ */
+
+// Deal.II includes
+#include <deal.II/base/parameter_handler.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle.h>
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/particle_iterator.h>
+#include <deal.II/particles/property_pool.h>
+
+// Lethe
+#include <dem/dem_properties.h>
+#include <dem/dem_solver_parameters.h>
+#include <dem/particle_sleeping.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+using namespace dealii;
+
+template <int dim>
+Particles::ParticleIterator<dim>
+insert_particle(parallel::distributed::Triangulation<dim> &tr,
+                Particles::ParticleHandler<dim> &          particle_handler,
+                const Point<dim> &                         position,
+                const int                                  id,
+                const double                               velocity)
+{
+  Particles::Particle<dim> particle(position, position, id);
+  typename Triangulation<dim>::active_cell_iterator particle_cell =
+    GridTools::find_active_cell_around_point(tr, particle.get_location());
+  Particles::ParticleIterator<dim> pit =
+    particle_handler.insert_particle(particle, particle_cell);
+
+  for (unsigned int i = 0; i < DEM::get_number_properties(); ++i)
+    pit->get_properties()[i] = 0;
+  pit->get_properties()[DEM::PropertiesIndex::dp]          = 0.005;
+  pit->get_properties()[DEM::PropertiesIndex::rho]         = 2500;
+  pit->get_properties()[DEM::PropertiesIndex::v_x]         = velocity;
+  pit->get_properties()[DEM::PropertiesIndex::mass]        = 1;
+  pit->get_properties()[DEM::PropertiesIndex::mom_inertia] = 1;
+
+  return pit;
+}
+
+template <int dim>
+void
+test()
+{
+  // Creating the mesh and refinement
+  parallel::distributed::Triangulation<dim> tr(MPI_COMM_WORLD);
+  int                                       hyper_cube_length = 1;
+  GridGenerator::hyper_cube(tr,
+                            -1 * hyper_cube_length,
+                            hyper_cube_length,
+                            true);
+  int refinement_number = 2;
+  tr.refine_global(refinement_number);
+  MappingQ<dim> mapping(1);
+
+  // Defining sleeping parameters
+  DEMSolverParameters<dim> dem_parameters;
+  dem_parameters.model_parameters.sleeping_velocity_threshold     = 1e-4;
+  dem_parameters.model_parameters.sleeping_acceleration_threshold = 1e-2;
+  dem_parameters.model_parameters.sleeping_steps                  = 3;
+
+  // Defining particle handler
+  Particles::ParticleHandler<dim> particle_handler(
+    tr, mapping, DEM::get_number_properties());
+
+  // Particles 0 and 1 are at rest and adjacent, particle 2 is moving
+  Particles::ParticleIterator<dim> pit0 =
+    insert_particle<dim>(tr, particle_handler, Point<dim>(0, 0, 0), 0, 0);
+  Particles::ParticleIterator<dim> pit1 =
+    insert_particle<dim>(tr, particle_handler, Point<dim>(0.005, 0, 0), 1, 0);
+  Particles::ParticleIterator<dim> pit2 =
+    insert_particle<dim>(tr, particle_handler, Point<dim>(0.5, 0, 0), 2, 0.1);
+
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    local_adjacent_particles;
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    ghost_adjacent_particles;
+  std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+    pw_pairs_in_contact;
+  std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+    pfw_pairs_in_contact;
+  std::unordered_map<int, particle_point_line_contact_info_struct<dim>>
+    particle_points_in_contact, particle_lines_in_contact;
+
+  pp_contact_info_struct<dim> contact_info_01;
+  contact_info_01.particle_one   = pit0;
+  contact_info_01.particle_two   = pit1;
+  local_adjacent_particles[0][1] = contact_info_01;
+
+  ParticleSleeping<dim> particle_sleeping_object(dem_parameters);
+
+  for (unsigned int step = 1; step <= 3; ++step)
+    {
+      particle_sleeping_object.update_sleeping_particles(
+        particle_handler,
+        local_adjacent_particles,
+        ghost_adjacent_particles,
+        pw_pairs_in_contact,
+        pfw_pairs_in_contact,
+        particle_points_in_contact,
+        particle_lines_in_contact);
+
+      deallog << "Step " << step << ", number of sleeping particles: "
+              << particle_sleeping_object.get_sleeping_particles().size()
+              << std::endl;
+    }
+
+  deallog << "Number of active contacts of particle 0: "
+          << local_adjacent_particles[0].size() << std::endl;
+
+  // Particle 2 moves next to particle 1
+  pp_contact_info_struct<dim> contact_info_12;
+  contact_info_12.particle_one   = pit1;
+  contact_info_12.particle_two   = pit2;
+  local_adjacent_particles[1][2] = contact_info_12;
+
+  particle_sleeping_object.update_sleeping_particles(particle_handler,
+                                                     local_adjacent_particles,
+                                                     ghost_adjacent_particles,
+                                                     pw_pairs_in_contact,
+                                                     pfw_pairs_in_contact,
+                                                     particle_points_in_contact,
+                                                     particle_lines_in_contact);
+
+  deallog << "Number of sleeping particles after the impact: "
+          << particle_sleeping_object.get_sleeping_particles().size()
+          << std::endl;
+  deallog << "Number of active contacts of particle 0: "
+          << local_adjacent_particles[0].size() << std::endl;
+
+  // The sleeping particle 0 leaves the domain, its contacts are removed by
+  // the contact search and its sleeping state must be removed as well
+  local_adjacent_particles.erase(0);
+  particle_handler.remove_particle(pit0);
+  particle_sleeping_object.remove_lost_particles(particle_handler);
+
+  deallog << "Number of sleeping particles after the deletion: "
+          << particle_sleeping_object.get_sleeping_particles().size()
+          << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      initlog();
+      test<3>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
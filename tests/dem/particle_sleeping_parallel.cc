@@ -0,0 +1,223 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2020 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief This test checks that a sleeping particle is woken up by an awake
+ * ghost particle. Particle 0 is owned by the first processor and goes to
+ * sleep, particle 1 is owned by the second processor and moves towards it.
+ */
+
+// Deal.II includes
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle.h>
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/particle_iterator.h>
+
+// Lethe
+#include <dem/dem_properties.h>
+#include <dem/dem_solver_parameters.h>
+#include <dem/particle_sleeping.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+using namespace dealii;
+
+template <int dim>
+void
+insert_particle(parallel::distributed::Triangulation<dim> &tr,
+                Particles::ParticleHandler<dim> &          particle_handler,
+                const Point<dim> &                         position,
+                const int                                  id,
+                const double                               velocity)
+{
+  Particles::Particle<dim> particle(position, position, id);
+  typename Triangulation<dim>::active_cell_iterator particle_cell =
+    GridTools::find_active_cell_around_point(tr, particle.get_location());
+
+  // Each particle is only inserted by the processor which owns its cell
+  if (!particle_cell->is_locally_owned())
+    return;
+
+  Particles::ParticleIterator<dim> pit =
+    particle_handler.insert_particle(particle, particle_cell);
+
+  for (unsigned int i = 0; i < DEM::get_number_properties(); ++i)
+    pit->get_properties()[i] = 0;
+  pit->get_properties()[DEM::PropertiesIndex::dp]          = 0.005;
+  pit->get_properties()[DEM::PropertiesIndex::rho]         = 2500;
+  pit->get_properties()[DEM::PropertiesIndex::v_y]         = velocity;
+  pit->get_properties()[DEM::PropertiesIndex::mass]        = 1;
+  pit->get_properties()[DEM::PropertiesIndex::mom_inertia] = 1;
+}
+
+template <int dim>
+void
+test()
+{
+  // Creating the mesh and refinement. The mesh is split at y = 0 between the
+  // two processors
+  parallel::distributed::Triangulation<dim> tr(MPI_COMM_WORLD);
+  int                                       hyper_cube_length = 1;
+  GridGenerator::hyper_cube(tr,
+                            -1 * hyper_cube_length,
+                            hyper_cube_length,
+                            true);
+  int refinement_number = 2;
+  tr.refine_global(refinement_number);
+  MappingQ<dim> mapping(1);
+
+  // Defining sleeping parameters
+  DEMSolverParameters<dim> dem_parameters;
+  dem_parameters.model_parameters.sleeping_velocity_threshold     = 1e-4;
+  dem_parameters.model_parameters.sleeping_acceleration_threshold = 1e-2;
+  dem_parameters.model_parameters.sleeping_steps                  = 3;
+
+  // Defining particle handler
+  Particles::ParticleHandler<dim> particle_handler(
+    tr, mapping, DEM::get_number_properties());
+
+  // Particle 0 is at rest below the interface between the processors,
+  // particle 1 moves downwards above it
+  insert_particle<dim>(tr, particle_handler, Point<dim>(0, -0.003), 0, 0);
+  insert_particle<dim>(tr, particle_handler, Point<dim>(0, 0.003), 1, -0.5);
+
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    local_adjacent_particles;
+  std::unordered_map<int, std::unordered_map<int, pp_contact_info_struct<dim>>>
+    ghost_adjacent_particles;
+  std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+    pw_pairs_in_contact;
+  std::unordered_map<int, std::map<int, pw_contact_info_struct<dim>>>
+    pfw_pairs_in_contact;
+  std::unordered_map<int, particle_point_line_contact_info_struct<dim>>
+    particle_points_in_contact, particle_lines_in_contact;
+
+  ParticleSleeping<dim> particle_sleeping_object(dem_parameters);
+
+  for (unsigned int step = 1; step <= 3; ++step)
+    {
+      particle_sleeping_object.update_sleeping_particles(
+        particle_handler,
+        local_adjacent_particles,
+        ghost_adjacent_particles,
+        pw_pairs_in_contact,
+        pfw_pairs_in_contact,
+        particle_points_in_contact,
+        particle_lines_in_contact);
+
+      deallog << "Step " << step << ", number of sleeping particles: "
+              << Utilities::MPI::sum(static_cast<unsigned int>(
+                                       particle_sleeping_object
+                                         .get_sleeping_particles()
+                                         .size()),
+                                     MPI_COMM_WORLD)
+              << std::endl;
+    }
+
+  // Particle 1 reaches particle 0, the contact is a local-ghost pair on the
+  // processor which owns particle 0
+  particle_handler.exchange_ghost_particles();
+
+  std::unordered_map<int, Particles::ParticleIterator<dim>>
+    local_particle_container;
+  std::unordered_map<int, Particles::ParticleIterator<dim>>
+    ghost_particle_container;
+  for (auto particle = particle_handler.begin();
+       particle != particle_handler.end();
+       ++particle)
+    local_particle_container[particle->get_id()] = particle;
+  for (auto particle = particle_handler.begin_ghost();
+       particle != particle_handler.end_ghost();
+       ++particle)
+    ghost_particle_container[particle->get_id()] = particle;
+
+  if (local_particle_container.count(0) > 0 &&
+      ghost_particle_container.count(1) > 0)
+    {
+      pp_contact_info_struct<dim> contact_info;
+      contact_info.particle_one      = local_particle_container.at(0);
+      contact_info.particle_two      = ghost_particle_container.at(1);
+      ghost_adjacent_particles[0][1] = contact_info;
+    }
+
+  deallog << "Number of local-ghost contacts: "
+          << Utilities::MPI::sum(static_cast<unsigned int>(
+                                   ghost_adjacent_particles.size()),
+                                 MPI_COMM_WORLD)
+          << std::endl;
+
+  particle_sleeping_object.update_sleeping_particles(particle_handler,
+                                                     local_adjacent_particles,
+                                                     ghost_adjacent_particles,
+                                                     pw_pairs_in_contact,
+                                                     pfw_pairs_in_contact,
+                                                     particle_points_in_contact,
+                                                     particle_lines_in_contact);
+
+  deallog << "Number of sleeping particles after the impact: "
+          << Utilities::MPI::sum(static_cast<unsigned int>(
+                                   particle_sleeping_object
+                                     .get_sleeping_particles()
+                                     .size()),
+                                 MPI_COMM_WORLD)
+          << std::endl;
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      mpi_initlog();
+      test<2>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
@@ -118,21 +118,24 @@ test(double coefficient_of_restitution)
     GridTools::find_active_cell_around_point(tr, particle.get_location());
   Particles::ParticleIterator<dim> pit1 =
     particle_handler.insert_particle(particle, particle_cell);
-  pit1->get_properties()[DEM::PropertiesIndex::type]    = 0;
-  pit1->get_properties()[DEM::PropertiesIndex::dp]      = particle_diameter;
-  pit1->get_properties()[DEM::PropertiesIndex::rho]     = particle_density;
-  pit1->get_properties()[DEM::PropertiesIndex::v_x]     = -0.1;
-  pit1->get_properties()[DEM::PropertiesIndex::v_y]     = 0;
-  pit1->get_properties()[DEM::PropertiesIndex::v_z]     = 0;
-  pit1->get_properties()[DEM::PropertiesIndex::acc_x]   = 0;
-  pit1->get_properties()[DEM::PropertiesIndex::acc_y]   = 0;
-  pit1->get_properties()[DEM::PropertiesIndex::acc_z]   = 0;
-  pit1->get_properties()[DEM::PropertiesIndex::force_x] = 0;
-  pit1->get_properties()[DEM::PropertiesIndex::force_y] = 0;
-  pit1->get_properties()[DEM::PropertiesIndex::force_z] = 0;
-  pit1->get_properties()[DEM::PropertiesIndex::omega_x] = 0;
-  pit1->get_properties()[DEM::PropertiesIndex::omega_y] = 0;
-  pit1->get_properties()[DEM::PropertiesIndex::omega_z] = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::type]        = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::dp]          = particle_diameter;
+  pit1->get_properties()[DEM::PropertiesIndex::rho]         = particle_density;
+  pit1->get_properties()[DEM::PropertiesIndex::v_x]         = -0.1;
+  pit1->get_properties()[DEM::PropertiesIndex::v_y]         = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::v_z]         = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::acc_x]       = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::acc_y]       = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::acc_z]       = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::force_x]     = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::force_y]     = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::force_z]     = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::fem_force_x] = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::fem_force_y] = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::fem_force_z] = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::omega_x]     = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::omega_y]     = 0;
+  pit1->get_properties()[DEM::PropertiesIndex::omega_z]     = 0;
   pit1->get_properties()[DEM::PropertiesIndex::mass] =
     M_PI * particle_diameter * particle_diameter * particle_diameter / 6;
   pit1->get_properties()[DEM::PropertiesIndex::mom_inertia] = 1;
@@ -0,0 +1,214 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2020 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief This test checks the void fraction calculated from particles with
+ * the particle centroid method and its projection onto a Q1 space with the
+ * pcm (lumped) and pcm_projection (smoothed L2 projection) modes.
+ */
+
+// Deal.II includes
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/particles/particle.h>
+#include <deal.II/particles/particle_handler.h>
+
+// Lethe
+#include <dem/dem_properties.h>
+#include <fem-dem/void_fraction.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+#include <algorithm>
+
+using namespace dealii;
+
+template <int dim>
+void
+insert_particle(parallel::distributed::Triangulation<dim> &tr,
+                Particles::ParticleHandler<dim> &          particle_handler,
+                const Point<dim> &                         position,
+                const int                                  id,
+                const double                               diameter)
+{
+  Particles::Particle<dim> particle(position, position, id);
+  typename Triangulation<dim>::active_cell_iterator particle_cell =
+    GridTools::find_active_cell_around_point(tr, particle.get_location());
+  Particles::ParticleIterator<dim> pit =
+    particle_handler.insert_particle(particle, particle_cell);
+
+  for (unsigned int i = 0; i < DEM::get_number_properties(); ++i)
+    pit->get_properties()[i] = 0;
+  pit->get_properties()[DEM::PropertiesIndex::dp] = diameter;
+}
+
+template <int dim>
+void
+print_nodal_void_fraction(const DoFHandler<dim> &              dof_handler,
+                          const Mapping<dim> &                 mapping,
+                          const TrilinosWrappers::MPI::Vector &void_fraction)
+{
+  std::map<types::global_dof_index, Point<dim>> support_points;
+  DoFTools::map_dofs_to_support_points(mapping, dof_handler, support_points);
+
+  // The nodes are sorted by their location to be independent of the dof
+  // numbering
+  std::vector<std::pair<Point<dim>, double>> nodal_values;
+  for (const auto &support_point : support_points)
+    nodal_values.emplace_back(support_point.second,
+                              void_fraction(support_point.first));
+  std::sort(nodal_values.begin(),
+            nodal_values.end(),
+            [](const std::pair<Point<dim>, double> &a,
+               const std::pair<Point<dim>, double> &b) {
+              return a.first[1] < b.first[1] ||
+                     (a.first[1] == b.first[1] && a.first[0] < b.first[0]);
+            });
+
+  for (const auto &nodal_value : nodal_values)
+    deallog << "Node " << nodal_value.first
+            << ", void fraction: " << nodal_value.second << std::endl;
+}
+
+template <int dim>
+void
+test()
+{
+  // Four square cells of area 0.25
+  parallel::distributed::Triangulation<dim> tr(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tr, 0, 1, true);
+  tr.refine_global(1);
+  MappingQ<dim> mapping(1);
+
+  Particles::ParticleHandler<dim> particle_handler(
+    tr, mapping, DEM::get_number_properties());
+
+  // The lower left cell contains a particle of area 0.125, the lower right
+  // cell two particles of area 0.0625 and the upper right cell a particle of
+  // area 0.0625. The upper left cell is empty.
+  const double large_diameter = std::sqrt(0.5 / M_PI);
+  const double small_diameter = std::sqrt(0.25 / M_PI);
+  insert_particle<dim>(
+    tr, particle_handler, Point<dim>(0.25, 0.25), 0, large_diameter);
+  insert_particle<dim>(
+    tr, particle_handler, Point<dim>(0.6, 0.25), 1, small_diameter);
+  insert_particle<dim>(
+    tr, particle_handler, Point<dim>(0.9, 0.25), 2, small_diameter);
+  insert_particle<dim>(
+    tr, particle_handler, Point<dim>(0.75, 0.75), 3, small_diameter);
+
+  Vector<double> cell_void_fraction;
+  calculate_cell_void_fraction(tr, particle_handler, cell_void_fraction);
+
+  for (const auto &cell : tr.active_cell_iterators())
+    deallog << "Cell " << cell->center() << ", void fraction: "
+            << cell_void_fraction[cell->active_cell_index()] << std::endl;
+
+  FE_Q<dim>       fe(1);
+  DoFHandler<dim> dof_handler(tr);
+  dof_handler.distribute_dofs(fe);
+
+  const IndexSet locally_owned_dofs = dof_handler.locally_owned_dofs();
+  IndexSet       locally_relevant_dofs;
+  DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
+
+  AffineConstraints<double> constraints;
+  constraints.reinit(locally_relevant_dofs);
+  constraints.close();
+
+  const QGauss<dim> quadrature(2);
+
+  // Lumped projection: average of the void fraction of the adjacent cells
+  VoidFractionProjection<dim> lumped_projection(
+    dof_handler, constraints, Parameters::VoidFractionMode::pcm, 0);
+  lumped_projection.setup(locally_owned_dofs,
+                          locally_relevant_dofs,
+                          MPI_COMM_WORLD);
+
+  TrilinosWrappers::MPI::Vector void_fraction(locally_owned_dofs,
+                                              MPI_COMM_WORLD);
+  lumped_projection.project(
+    mapping, quadrature, cell_void_fraction, void_fraction, 100, 1e-12);
+
+  deallog << "pcm" << std::endl;
+  print_nodal_void_fraction(dof_handler, mapping, void_fraction);
+
+  // Smoothed L2 projection
+  VoidFractionProjection<dim> smoothed_projection(
+    dof_handler,
+    constraints,
+    Parameters::VoidFractionMode::pcm_projection,
+    0.25);
+  smoothed_projection.setup(locally_owned_dofs,
+                            locally_relevant_dofs,
+                            MPI_COMM_WORLD);
+
+  void_fraction = 0;
+  smoothed_projection.project(
+    mapping, quadrature, cell_void_fraction, void_fraction, 100, 1e-12);
+
+  deallog << "pcm_projection" << std::endl;
+  print_nodal_void_fraction(dof_handler, mapping, void_fraction);
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      initlog();
+      test<2>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
@@ -0,0 +1,206 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2020 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief This test checks that the cached operator of the smoothed projection
+ * of the void fraction (pcm_projection) is reused while the mesh does not
+ * change and assembled again after the mesh is refined.
+ */
+
+// Deal.II includes
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+// Lethe
+#include <fem-dem/void_fraction.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+#include <algorithm>
+
+using namespace dealii;
+
+template <int dim>
+void
+print_nodal_void_fraction(const DoFHandler<dim> &              dof_handler,
+                          const Mapping<dim> &                 mapping,
+                          const TrilinosWrappers::MPI::Vector &void_fraction)
+{
+  std::map<types::global_dof_index, Point<dim>> support_points;
+  DoFTools::map_dofs_to_support_points(mapping, dof_handler, support_points);
+
+  // The nodes are sorted by their location to be independent of the dof
+  // numbering
+  std::vector<std::pair<Point<dim>, double>> nodal_values;
+  for (const auto &support_point : support_points)
+    nodal_values.emplace_back(support_point.second,
+                              void_fraction(support_point.first));
+  std::sort(nodal_values.begin(),
+            nodal_values.end(),
+            [](const std::pair<Point<dim>, double> &a,
+               const std::pair<Point<dim>, double> &b) {
+              return a.first[1] < b.first[1] ||
+                     (a.first[1] == b.first[1] && a.first[0] < b.first[0]);
+            });
+
+  for (const auto &nodal_value : nodal_values)
+    deallog << "Node " << nodal_value.first
+            << ", void fraction: " << nodal_value.second << std::endl;
+}
+
+template <int dim>
+void
+set_cell_void_fraction(const Triangulation<dim> &tr,
+                       const bool                upper_left_cell_is_empty,
+                       Vector<double> &          cell_void_fraction)
+{
+  // The void fraction is constant over each quarter of the domain. The lower
+  // quarters have a void fraction of 0.5, the upper quarters of 1 and 0.75.
+  cell_void_fraction.reinit(tr.n_active_cells());
+  for (const auto &cell : tr.active_cell_iterators())
+    {
+      const Point<dim> center = cell->center();
+      double           void_fraction;
+      if (center[1] < 0.5)
+        void_fraction = 0.5;
+      else if ((center[0] < 0.5) == upper_left_cell_is_empty)
+        void_fraction = 1;
+      else
+        void_fraction = 0.75;
+      cell_void_fraction[cell->active_cell_index()] = void_fraction;
+    }
+}
+
+template <int dim>
+void
+test()
+{
+  parallel::distributed::Triangulation<dim> tr(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tr, 0, 1, true);
+  tr.refine_global(1);
+  MappingQ<dim> mapping(1);
+
+  FE_Q<dim>       fe(1);
+  DoFHandler<dim> dof_handler(tr);
+  dof_handler.distribute_dofs(fe);
+
+  IndexSet locally_owned_dofs = dof_handler.locally_owned_dofs();
+  IndexSet locally_relevant_dofs;
+  DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
+
+  AffineConstraints<double> constraints;
+  constraints.reinit(locally_relevant_dofs);
+  constraints.close();
+
+  const QGauss<dim> quadrature(2);
+
+  VoidFractionProjection<dim> projection(
+    dof_handler,
+    constraints,
+    Parameters::VoidFractionMode::pcm_projection,
+    0.25);
+  projection.setup(locally_owned_dofs, locally_relevant_dofs, MPI_COMM_WORLD);
+
+  Vector<double>                cell_void_fraction;
+  TrilinosWrappers::MPI::Vector void_fraction(locally_owned_dofs,
+                                              MPI_COMM_WORLD);
+
+  // First projection, which assembles the operator
+  set_cell_void_fraction(tr, true, cell_void_fraction);
+  projection.project(
+    mapping, quadrature, cell_void_fraction, void_fraction, 100, 1e-12);
+
+  deallog << "First projection" << std::endl;
+  print_nodal_void_fraction(dof_handler, mapping, void_fraction);
+
+  // The particles of the upper right quarter move to the upper left quarter.
+  // The cached operator is reused and the previous void fraction is the
+  // initial guess.
+  set_cell_void_fraction(tr, false, cell_void_fraction);
+  projection.project(
+    mapping, quadrature, cell_void_fraction, void_fraction, 100, 1e-12);
+
+  deallog << "Second projection" << std::endl;
+  print_nodal_void_fraction(dof_handler, mapping, void_fraction);
+
+  // The operator is assembled again on the refined mesh
+  tr.refine_global(1);
+  dof_handler.distribute_dofs(fe);
+
+  locally_owned_dofs = dof_handler.locally_owned_dofs();
+  DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
+
+  constraints.clear();
+  constraints.reinit(locally_relevant_dofs);
+  constraints.close();
+
+  projection.setup(locally_owned_dofs, locally_relevant_dofs, MPI_COMM_WORLD);
+  void_fraction.reinit(locally_owned_dofs, MPI_COMM_WORLD);
+
+  set_cell_void_fraction(tr, false, cell_void_fraction);
+  projection.project(
+    mapping, quadrature, cell_void_fraction, void_fraction, 100, 1e-12);
+
+  deallog << "Projection on the refined mesh" << std::endl;
+  print_nodal_void_fraction(dof_handler, mapping, void_fraction);
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+      initlog();
+      test<2>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}